@@ -53,4 +53,7 @@
 
 #define MBEDTLS_AES_ROM_TABLES
 
+/* The SSL module allocates from a heap per socket. */
+#define MBEDTLS_PLATFORM_MEMORY
+
 #endif
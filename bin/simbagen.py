@@ -444,6 +444,9 @@ class SoamDb(object):
 
         self.formats.append(original_fmtstr)
         generated_id = self.generate_id()
+        # Argument conversions, used to decode binary log records.
+        conversions = ''.join(re.findall(r'%-?[0-9]*?l?([dsuxcf])',
+                                         soam_fmtstr))
         soam_fmtstr = '"\\x{:02x}\\x{:02x}"'.format(
             (generated_id >> 8) & 0xff,
             generated_id & 0xff) + soam_fmtstr
@@ -453,6 +456,9 @@ class SoamDb(object):
         self.decoder_format_strings += 'FMT: 0x{:x} {}\n'.format(
             generated_id,
             decoder_fmtstr)
+        self.decoder_format_strings += 'ARG: 0x{:x} "{}"\n'.format(
+            generated_id,
+            conversions)
 
     def parse_cmd(self, fin):
         command = fin.readline().strip()
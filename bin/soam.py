@@ -24,6 +24,7 @@ except ImportError:
 
 import traceback
 import _thread
+import os
 from socket_device import SocketDevice
 
 try:
@@ -33,6 +34,12 @@ except ImportError:
 
 from errnos import human_readable_errno
 
+# The binary log record decoder is located in the make folder.
+sys.path.append(os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                             '..',
+                             'make'))
+import logdecoder
+
 __version__ = '2.0'
 
 # SOAM protocol definitions.
@@ -47,6 +54,7 @@ SOAM_TYPE_DATABASE_ID_REQUEST          = 8
 SOAM_TYPE_DATABASE_ID_RESPONSE         = 9
 SOAM_TYPE_DATABASE_REQUEST             = 10
 SOAM_TYPE_DATABASE_RESPONSE            = 11
+SOAM_TYPE_LOG_POINT_BINARY             = 12
 SOAM_TYPE_INVALID_TYPE                 = 15
 
 SOAM_SEGMENT_SIZE_MIN = 7
@@ -152,6 +160,7 @@ class Database(object):
 
     def __init__(self):
         self.formats = {}
+        self.arguments = {}
         self.commands = {}
         self.command_id_to_string = {}
 
@@ -176,6 +185,8 @@ class Database(object):
 
             if kind == 'FMT:':
                 self.formats[identity] = string
+            elif kind == 'ARG:':
+                self.arguments[identity] = string
             elif kind == 'CMD:':
                 self.commands[string] = identity
                 self.command_id_to_string[identity] = string
@@ -306,6 +317,10 @@ class ReaderThread(threading.Thread):
             elif packet_type == SOAM_TYPE_LOG_POINT:
                 formatted_string = format_log_point(self.client.database, packet)
                 print(formatted_string, end='', file=self.ostream)
+            elif packet_type == SOAM_TYPE_LOG_POINT_BINARY:
+                for formatted_string in logdecoder.decode(self.client.database,
+                                                          packet):
+                    print(formatted_string, end='', file=self.ostream)
             elif packet_type in [SOAM_TYPE_COMMAND_RESPONSE_DATA_PRINTF,
                                  SOAM_TYPE_COMMAND_RESPONSE_DATA_BINARY]:
                 response_data.append((packet_type, transaction_id, packet))
@@ -339,6 +339,9 @@ static int init(void)
                (fat16_write_t)sd_write_block,
                &sd,
                0);
+    fat16_set_multi_block_callbacks(&fs,
+                                    (fat16_read_blocks_t)sd_read_blocks,
+                                    (fat16_write_blocks_t)sd_write_blocks);
 
     if (fat16_mount(&fs) != 0) {
         std_printf(FSTR("Failed to mount FAT16 file system.\r\n"));
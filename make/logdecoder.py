@@ -0,0 +1,223 @@
+#!/usr/bin/env python
+#
+# Decode binary log records, written by the log module when
+# CONFIG_LOG_BINARY is set, to text.
+#
+
+from __future__ import print_function
+
+import sys
+import struct
+import argparse
+
+
+# Format identifier of records with a text message.
+FORMAT_ID_TEXT = 0x0000
+
+LEVELS = ['fatal', 'error', 'warning', 'info', 'debug']
+
+
+class TruncatedError(Exception):
+    """A record ended before all its fields were read.
+
+    """
+
+    pass
+
+
+def unescape(string):
+    string = string.replace('\\n', '\n')
+    string = string.replace('\\r', '\r')
+    string = string.replace('\\t', '\t')
+    string = string.replace('\\v', '\v')
+    string = string.replace('\\\\', '\\')
+
+    return string
+
+
+class Database(object):
+    """Format strings and their argument conversions, read from a SOAM
+    database file.
+
+    """
+
+    def __init__(self, fin):
+        self.formats = {}
+        self.arguments = {}
+
+        for line in fin:
+            # Ignore comments.
+            if line.startswith('#'):
+                continue
+
+            kind, identity, string = line.strip().split(' ', 2)
+            identity = int(identity, 0)
+            string = unescape(string[1:-1])
+
+            if kind == 'FMT:':
+                self.formats[identity] = string
+            elif kind == 'ARG:':
+                self.arguments[identity] = string
+
+
+class Reader(object):
+
+    def __init__(self, data):
+        self.data = bytearray(data)
+        self.pos = 0
+
+    def is_empty(self):
+        return self.pos == len(self.data)
+
+    def read(self, size):
+        if self.pos + size > len(self.data):
+            raise TruncatedError()
+
+        data = self.data[self.pos:self.pos + size]
+        self.pos += size
+
+        return data
+
+    def read_byte(self):
+        return self.read(1)[0]
+
+    def read_varint(self):
+        value = 0
+        shift = 0
+
+        while True:
+            byte = self.read_byte()
+            value |= ((byte & 0x7f) << shift)
+            shift += 7
+
+            if (byte & 0x80) == 0:
+                return value
+
+    def read_signed(self):
+        value = self.read_varint()
+
+        return (value >> 1) ^ -(value & 1)
+
+    def read_string(self):
+        end = self.data.find(b'\x00', self.pos)
+
+        if end == -1:
+            raise TruncatedError()
+
+        string = self.data[self.pos:end].decode('ascii', 'replace')
+        self.pos = end + 1
+
+        return string
+
+    def read_float(self):
+        return struct.unpack('>f', bytes(self.read(4)))[0]
+
+
+def read_argument(reader, conversion):
+    if conversion == 'd':
+        return str(reader.read_signed())
+    elif conversion == 'u':
+        return str(reader.read_varint())
+    elif conversion == 'x':
+        return '{:x}'.format(reader.read_varint())
+    elif conversion == 'c':
+        return chr(reader.read_varint() & 0xff)
+    elif conversion == 's':
+        return reader.read_string()
+    elif conversion == 'f':
+        return '{:f}'.format(reader.read_float())
+    else:
+        raise ValueError('{}: bad conversion'.format(conversion))
+
+
+def format_message(database, identity, reader):
+    try:
+        fmt = database.formats[identity]
+        conversions = database.arguments[identity]
+    except KeyError:
+        return 'Unknown format identifier 0x{:04x}.\r\n'.format(identity)
+
+    args = []
+
+    # Arguments that did not fit in the record are missing.
+    try:
+        for conversion in conversions:
+            args.append(read_argument(reader, conversion))
+    except TruncatedError:
+        args += ['?'] * (len(conversions) - len(args))
+
+    return fmt.format(*args)
+
+
+def decode_record(database, payload):
+    """Decode given binary log record payload to a text log entry.
+
+    """
+
+    reader = Reader(payload)
+    identity = struct.unpack('>H', bytes(reader.read(2)))[0]
+    level = reader.read_byte()
+    seconds = reader.read_varint()
+    milliseconds = reader.read_varint()
+    thread_name = reader.read_string()
+    name = reader.read_string()
+
+    if identity == FORMAT_ID_TEXT:
+        message = reader.read_string()
+    else:
+        message = format_message(database, identity, reader)
+
+    try:
+        level = LEVELS[level]
+    except IndexError:
+        level = str(level)
+
+    return '{}.{:03}:{}:{}:{}: {}'.format(seconds,
+                                           milliseconds,
+                                           level,
+                                           thread_name,
+                                           name,
+                                           message)
+
+
+def decode(database, data):
+    """Decode given binary log records, each prefixed by its payload
+    size. Yields one text log entry per record.
+
+    """
+
+    reader = Reader(data)
+
+    while not reader.is_empty():
+        size = reader.read_varint()
+        yield decode_record(database, reader.read(size))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode binary log records to text.')
+    parser.add_argument('database',
+                        help='SOAM database file of the application.')
+    parser.add_argument('infile',
+                        nargs='?',
+                        help='Binary log records file, or standard input.')
+    args = parser.parse_args()
+
+    with open(args.database) as fin:
+        database = Database(fin)
+
+    if args.infile is None:
+        data = getattr(sys.stdin, 'buffer', sys.stdin).read()
+    else:
+        with open(args.infile, 'rb') as fin:
+            data = fin.read()
+
+    try:
+        for entry in decode(database, data):
+            sys.stdout.write(entry)
+    except TruncatedError:
+        sys.exit('error: the last log record is truncated')
+
+
+if __name__ == '__main__':
+    main()
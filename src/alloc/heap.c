@@ -39,6 +39,19 @@ struct heap_buffer_header_t {
     int count;
 };
 
+struct module_t {
+    int initialized;
+    struct heap_t *heaps_p;
+#if CONFIG_HEAP_FS_COMMANDS == 1
+    struct fs_command_t cmd_stats;
+#    if CONFIG_HEAP_TRACE == 1
+    struct fs_command_t cmd_trace;
+#    endif
+#endif
+};
+
+static struct module_t module;
+
 static void *alloc_fixed_size(struct heap_t *self_p,
                               size_t size)
 {
@@ -56,7 +69,7 @@ static void *alloc_fixed_size(struct heap_t *self_p,
                 next_p = self_p->next_p;
 
                 /* Out of memory?. */
-                left = (self_p->size - (next_p - (char *)self_p->buf_p));
+                left = ((char *)self_p->dynamic.begin_p - next_p);
 
                 if (left < (sizeof(*header_p) + fixed_p->size)) {
                     break;
@@ -82,48 +95,260 @@ static void *alloc_fixed_size(struct heap_t *self_p,
     return (NULL);
 }
 
-static void *alloc_dynamic_size(struct heap_t *self_p,
-                                size_t size)
+/**
+ * Dynamic buffer sizes are multiples of the alignment, leaving the
+ * two least significant bits of the size for the flags below.
+ */
+#define DYNAMIC_ALIGNMENT (sizeof(void *) < 4 ? 4 : sizeof(void *))
+
+/* The block is free. */
+#define DYNAMIC_FREE                                      0x1
+
+/* The physically previous block is free. */
+#define DYNAMIC_PREV_FREE                                 0x2
+
+#define DYNAMIC_FLAGS                (DYNAMIC_FREE | DYNAMIC_PREV_FREE)
+
+/* A free block stores the previous free list pointer at its
+   beginning and its size at its end. */
+#define DYNAMIC_SIZE_MIN                                        \
+    (DIV_CEIL(sizeof(void *) + sizeof(size_t), (DYNAMIC_ALIGNMENT)) \
+     * DYNAMIC_ALIGNMENT)
+
+/* Sizes below this limit are all in the first first level class. */
+#define DYNAMIC_FL_SHIFT                                    6
+
+#define SIZE(header_p) ((header_p)->size & ~(size_t)DYNAMIC_FLAGS)
+
+#define PREV_FREE_P(header_p)                                   \
+    (*(struct heap_buffer_header_t **)&(header_p)[1])
+
+#define FOOTER(header_p, size)                                          \
+    (((size_t *)((char *)&(header_p)[1] + (size)))[-1])
+
+#define NEXT_BLOCK(header_p, size)                                      \
+    ((struct heap_buffer_header_t *)((char *)&(header_p)[1] + (size)))
+
+static int fls_size(size_t size)
 {
-    struct heap_buffer_header_t *header_p, *prev_p;
-    size_t left;
-    char *next_p;
+    return (8 * sizeof(unsigned long) - 1 - __builtin_clzl(size));
+}
 
-    /* Allocate from the free list. */
-    header_p = self_p->dynamic.free_p;
-    prev_p = NULL;
+/**
+ * Map given block size to its first and second level class.
+ */
+static void mapping_insert(size_t size, int *fl_p, int *sl_p)
+{
+    int fl;
+    int sl;
 
-    while (header_p != NULL) {
-        if (size <= header_p->size) {
-            header_p->count = 1;
+    if (size < (1 << DYNAMIC_FL_SHIFT)) {
+        fl = 0;
+        sl = (size >> (DYNAMIC_FL_SHIFT - HEAP_DYNAMIC_SL_COUNT_LOG2));
+    } else {
+        fl = fls_size(size);
+        sl = ((size >> (fl - HEAP_DYNAMIC_SL_COUNT_LOG2))
+              - HEAP_DYNAMIC_SL_COUNT);
+        fl -= (DYNAMIC_FL_SHIFT - 1);
+
+        if (fl >= HEAP_DYNAMIC_FL_COUNT) {
+            fl = (HEAP_DYNAMIC_FL_COUNT - 1);
+            sl = (HEAP_DYNAMIC_SL_COUNT - 1);
+        }
+    }
 
-            if (prev_p != NULL) {
-                prev_p->u.next_p = header_p->u.next_p;
-            } else {
-                self_p->dynamic.free_p = header_p->u.next_p;
+    *fl_p = fl;
+    *sl_p = sl;
+}
+
+/**
+ * Map given requested size to the first class where all blocks are
+ * big enough, that is, round the size up to the next class.
+ */
+static void mapping_search(size_t size, int *fl_p, int *sl_p)
+{
+    if (size < (1 << DYNAMIC_FL_SHIFT)) {
+        size += ((1 << (DYNAMIC_FL_SHIFT - HEAP_DYNAMIC_SL_COUNT_LOG2)) - 1);
+    } else {
+        size += ((1 << (fls_size(size) - HEAP_DYNAMIC_SL_COUNT_LOG2)) - 1);
+    }
+
+    mapping_insert(size, fl_p, sl_p);
+}
+
+static void dynamic_insert(struct heap_dynamic_t *dynamic_p,
+                           struct heap_buffer_header_t *header_p)
+{
+    int fl;
+    int sl;
+    struct heap_buffer_header_t *head_p;
+
+    mapping_insert(SIZE(header_p), &fl, &sl);
+    head_p = dynamic_p->free_p[fl][sl];
+    header_p->u.next_p = head_p;
+    PREV_FREE_P(header_p) = NULL;
+
+    if (head_p != NULL) {
+        PREV_FREE_P(head_p) = header_p;
+    }
+
+    dynamic_p->free_p[fl][sl] = header_p;
+    dynamic_p->fl_bitmap |= (1UL << fl);
+    dynamic_p->sl_bitmap[fl] |= (1 << sl);
+}
+
+static void dynamic_remove(struct heap_dynamic_t *dynamic_p,
+                           struct heap_buffer_header_t *header_p)
+{
+    int fl;
+    int sl;
+    struct heap_buffer_header_t *next_p;
+    struct heap_buffer_header_t *prev_p;
+
+    mapping_insert(SIZE(header_p), &fl, &sl);
+    next_p = header_p->u.next_p;
+    prev_p = PREV_FREE_P(header_p);
+
+    if (next_p != NULL) {
+        PREV_FREE_P(next_p) = prev_p;
+    }
+
+    if (prev_p != NULL) {
+        prev_p->u.next_p = next_p;
+    } else {
+        dynamic_p->free_p[fl][sl] = next_p;
+
+        if (next_p == NULL) {
+            dynamic_p->sl_bitmap[fl] &= ~(1 << sl);
+
+            if (dynamic_p->sl_bitmap[fl] == 0) {
+                dynamic_p->fl_bitmap &= ~(1UL << fl);
             }
+        }
+    }
+}
+
+/**
+ * Find a free block of at least given size in constant time. Only
+ * the last class may contain blocks smaller than the searched size,
+ * as it holds all big blocks.
+ */
+static struct heap_buffer_header_t *dynamic_find(
+    struct heap_dynamic_t *dynamic_p,
+    size_t size)
+{
+    int fl;
+    int sl;
+    unsigned long fl_map;
+    unsigned int sl_map;
+    struct heap_buffer_header_t *header_p;
 
-            header_p->u.fixed_p = NULL;
+    mapping_search(size, &fl, &sl);
+    sl_map = (dynamic_p->sl_bitmap[fl] & (~0U << sl));
 
-            return (&header_p[1]);
+    if (sl_map == 0) {
+        fl_map = (dynamic_p->fl_bitmap & (~0UL << (fl + 1)));
+
+        if (fl_map == 0) {
+            return (NULL);
         }
 
-        prev_p = header_p;
+        fl = (__builtin_ffsl(fl_map) - 1);
+        sl_map = dynamic_p->sl_bitmap[fl];
+    }
+
+    sl = (__builtin_ffs(sl_map) - 1);
+    header_p = dynamic_p->free_p[fl][sl];
+
+    while ((header_p != NULL) && (SIZE(header_p) < size)) {
         header_p = header_p->u.next_p;
     }
 
-    next_p = self_p->next_p;
+    return (header_p);
+}
+
+/**
+ * Search the class of given size for a block that is big enough. Used
+ * as a last resort when out of memory, as the class may contain
+ * blocks both smaller and bigger than the searched size.
+ */
+static struct heap_buffer_header_t *dynamic_find_exact(
+    struct heap_dynamic_t *dynamic_p,
+    size_t size)
+{
+    int fl;
+    int sl;
+    struct heap_buffer_header_t *header_p;
+
+    mapping_insert(size, &fl, &sl);
+    header_p = dynamic_p->free_p[fl][sl];
+
+    while ((header_p != NULL) && (SIZE(header_p) < size)) {
+        header_p = header_p->u.next_p;
+    }
+
+    return (header_p);
+}
+
+static void *alloc_dynamic_size(struct heap_t *self_p,
+                                size_t size)
+{
+    struct heap_dynamic_t *dynamic_p;
+    struct heap_buffer_header_t *header_p;
+    struct heap_buffer_header_t *next_p;
+    struct heap_buffer_header_t *rest_p;
+    size_t block_size;
+    size_t rest_size;
+    size_t left;
+
+    dynamic_p = &self_p->dynamic;
+    size = (DIV_CEIL(size, (DYNAMIC_ALIGNMENT)) * DYNAMIC_ALIGNMENT);
+
+    if (size < DYNAMIC_SIZE_MIN) {
+        size = DYNAMIC_SIZE_MIN;
+    }
+
+    header_p = dynamic_find(dynamic_p, size);
+
+    if (header_p == NULL) {
+        left = ((char *)dynamic_p->begin_p - (char *)self_p->next_p);
 
-    /* Allocate new memory. */
-    left = (self_p->size - (next_p - (char *)self_p->buf_p));
+        if (left < (sizeof(*header_p) + size)) {
+            header_p = dynamic_find_exact(dynamic_p, size);
 
-    if (left < (sizeof(*header_p) + size)) {
-        return (NULL);
+            if (header_p == NULL) {
+                return (NULL);
+            }
+        }
     }
 
-    header_p = self_p->next_p;
-    next_p += (sizeof(*header_p) + size);
-    self_p->next_p = next_p;
+    if (header_p != NULL) {
+        dynamic_remove(dynamic_p, header_p);
+        block_size = SIZE(header_p);
+        next_p = NEXT_BLOCK(header_p, block_size);
+
+        /* Split the block if the rest is big enough for a block of
+           its own. */
+        if (block_size >= (size + sizeof(*header_p) + DYNAMIC_SIZE_MIN)) {
+            rest_p = NEXT_BLOCK(header_p, size);
+            rest_size = (block_size - size - sizeof(*header_p));
+            rest_p->size = (rest_size | DYNAMIC_FREE);
+            rest_p->count = 0;
+            FOOTER(rest_p, rest_size) = rest_size;
+            dynamic_insert(dynamic_p, rest_p);
+        } else {
+            size = block_size;
+
+            if ((void *)next_p < dynamic_p->end_p) {
+                next_p->size &= ~(size_t)DYNAMIC_PREV_FREE;
+            }
+        }
+    } else {
+        /* Allocate new memory. */
+        header_p = (struct heap_buffer_header_t *)
+            ((char *)dynamic_p->begin_p - sizeof(*header_p) - size);
+        dynamic_p->begin_p = header_p;
+    }
 
     /* Initialize the allocated buffer. */
     header_p->u.fixed_p = NULL;
@@ -149,8 +374,305 @@ static int free_fixed_size(struct heap_t *self_p,
 static int free_dynamic_buffer(struct heap_t *self_p,
                                struct heap_buffer_header_t *header_p)
 {
-    header_p->u.next_p = self_p->dynamic.free_p;
-    self_p->dynamic.free_p = header_p;
+    struct heap_dynamic_t *dynamic_p;
+    struct heap_buffer_header_t *next_p;
+    struct heap_buffer_header_t *prev_p;
+    size_t size;
+
+    dynamic_p = &self_p->dynamic;
+    size = SIZE(header_p);
+    next_p = NEXT_BLOCK(header_p, size);
+
+    /* Merge with the next block if free. */
+    if ((void *)next_p < dynamic_p->end_p) {
+        if (next_p->size & DYNAMIC_FREE) {
+            dynamic_remove(dynamic_p, next_p);
+            size += (sizeof(*header_p) + SIZE(next_p));
+            next_p = NEXT_BLOCK(header_p, size);
+        }
+    }
+
+    /* Merge with the previous block if free. */
+    if (header_p->size & DYNAMIC_PREV_FREE) {
+        prev_p = (struct heap_buffer_header_t *)
+            ((char *)header_p - ((size_t *)header_p)[-1] - sizeof(*header_p));
+        dynamic_remove(dynamic_p, prev_p);
+        size += (sizeof(*header_p) + SIZE(prev_p));
+        header_p = prev_p;
+    }
+
+    if (header_p == dynamic_p->begin_p) {
+        /* Give the lowest block back to the unused memory between
+           the fixed size buffers and the dynamic buffers. */
+        dynamic_p->begin_p = next_p;
+
+        if ((void *)next_p < dynamic_p->end_p) {
+            next_p->size &= ~(size_t)DYNAMIC_PREV_FREE;
+        }
+    } else {
+        header_p->size = (size | DYNAMIC_FREE);
+        FOOTER(header_p, size) = size;
+        dynamic_insert(dynamic_p, header_p);
+
+        if ((void *)next_p < dynamic_p->end_p) {
+            next_p->size |= DYNAMIC_PREV_FREE;
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Number of bytes occupied by given allocated buffer, including its
+ * header.
+ */
+static size_t buffer_size(struct heap_buffer_header_t *header_p)
+{
+    size_t size;
+
+    if (header_p->u.fixed_p != NULL) {
+        size = header_p->u.fixed_p->size;
+    } else {
+        size = SIZE(header_p);
+    }
+
+    return (sizeof(*header_p) + size);
+}
+
+#if CONFIG_HEAP_TRACE == 1
+
+static void trace_record(struct heap_t *self_p,
+                         void *caller_p,
+                         void *buf_p,
+                         size_t size)
+{
+    struct heap_trace_entry_t *entry_p;
+    struct time_t now;
+
+    sys_uptime(&now);
+    entry_p = &self_p->trace.entries[self_p->trace.count
+                                     % CONFIG_HEAP_TRACE_LENGTH];
+    entry_p->caller_p = caller_p;
+    entry_p->buf_p = buf_p;
+    entry_p->size = size;
+    entry_p->timestamp = (1000 * now.seconds + now.nanoseconds / 1000000);
+    self_p->trace.count++;
+}
+
+#endif
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+
+static void print_stats(struct heap_t *self_p,
+                        void *chout_p)
+{
+    struct heap_stats_t stats;
+    struct heap_buffer_header_t *header_p;
+    size_t free_lengths[HEAP_FIXED_SIZES_MAX];
+    size_t dynamic_free_count;
+    size_t dynamic_free_size;
+    size_t dynamic_free_size_max;
+    size_t unused;
+    int fl;
+    int sl;
+    int i;
+
+    mutex_lock(&self_p->mutex);
+
+    stats = self_p->stats;
+    unused = ((char *)self_p->dynamic.begin_p - (char *)self_p->next_p);
+
+    for (i = 0; i < HEAP_FIXED_SIZES_MAX; i++) {
+        free_lengths[i] = 0;
+        header_p = self_p->fixed[i].free_p;
+
+        while (header_p != NULL) {
+            free_lengths[i]++;
+            header_p = header_p->u.next_p;
+        }
+    }
+
+    dynamic_free_count = 0;
+    dynamic_free_size = 0;
+    dynamic_free_size_max = 0;
+
+    for (fl = 0; fl < HEAP_DYNAMIC_FL_COUNT; fl++) {
+        for (sl = 0; sl < HEAP_DYNAMIC_SL_COUNT; sl++) {
+            header_p = self_p->dynamic.free_p[fl][sl];
+
+            while (header_p != NULL) {
+                dynamic_free_count++;
+                dynamic_free_size += SIZE(header_p);
+
+                if (SIZE(header_p) > dynamic_free_size_max) {
+                    dynamic_free_size_max = SIZE(header_p);
+                }
+
+                header_p = header_p->u.next_p;
+            }
+        }
+    }
+
+    mutex_unlock(&self_p->mutex);
+
+    std_fprintf(chout_p,
+                OSTR("%s:\r\n"
+                     "  size: %lu\r\n"
+                     "  used: %lu\r\n"
+                     "  used_max: %lu\r\n"
+                     "  unused: %lu\r\n"
+                     "  allocs: %lu\r\n"
+                     "  frees: %lu\r\n"
+                     "  failed_allocs: %lu\r\n"
+                     "  fixed:\r\n"
+                     "           SIZE  FREE\r\n"),
+                self_p->name_p,
+                (unsigned long)self_p->size,
+                (unsigned long)stats.used,
+                (unsigned long)stats.used_max,
+                (unsigned long)unused,
+                (unsigned long)stats.allocs,
+                (unsigned long)stats.frees,
+                (unsigned long)stats.failed_allocs);
+
+    for (i = 0; i < HEAP_FIXED_SIZES_MAX; i++) {
+        std_fprintf(chout_p,
+                    OSTR("    %11lu %5lu\r\n"),
+                    (unsigned long)self_p->fixed[i].size,
+                    (unsigned long)free_lengths[i]);
+    }
+
+    std_fprintf(chout_p,
+                OSTR("  dynamic:\r\n"
+                     "    free_blocks: %lu\r\n"
+                     "    free_size: %lu\r\n"
+                     "    free_size_max: %lu\r\n"),
+                (unsigned long)dynamic_free_count,
+                (unsigned long)dynamic_free_size,
+                (unsigned long)dynamic_free_size_max);
+}
+
+static int cmd_stats_cb(int argc,
+                        const char *argv[],
+                        void *chout_p,
+                        void *chin_p,
+                        void *arg_p,
+                        void *call_arg_p)
+{
+    struct heap_t *heap_p;
+
+    heap_p = module.heaps_p;
+
+    while (heap_p != NULL) {
+        print_stats(heap_p, chout_p);
+        heap_p = heap_p->next_heap_p;
+    }
+
+    return (0);
+}
+
+#    if CONFIG_HEAP_TRACE == 1
+
+static int cmd_trace_cb(int argc,
+                        const char *argv[],
+                        void *chout_p,
+                        void *chin_p,
+                        void *arg_p,
+                        void *call_arg_p)
+{
+    struct heap_t *heap_p;
+    struct heap_trace_entry_t entries[CONFIG_HEAP_TRACE_LENGTH];
+    uint32_t count;
+    uint32_t i;
+    struct heap_trace_entry_t *entry_p;
+
+    heap_p = module.heaps_p;
+
+    while (heap_p != NULL) {
+        mutex_lock(&heap_p->mutex);
+        memcpy(&entries[0], &heap_p->trace.entries[0], sizeof(entries));
+        count = heap_p->trace.count;
+        mutex_unlock(&heap_p->mutex);
+
+        std_fprintf(chout_p,
+                    OSTR("%s:\r\n"
+                         "   TIMESTAMP      CALLER      BUFFER   SIZE\r\n"),
+                    heap_p->name_p);
+
+        /* Oldest entry first. */
+        if (count > CONFIG_HEAP_TRACE_LENGTH) {
+            i = (count - CONFIG_HEAP_TRACE_LENGTH);
+        } else {
+            i = 0;
+        }
+
+        for (; i < count; i++) {
+            entry_p = &entries[i % CONFIG_HEAP_TRACE_LENGTH];
+            std_fprintf(chout_p,
+                        OSTR("%12lu  0x%08lx  0x%08lx  %5lu %s\r\n"),
+                        (unsigned long)entry_p->timestamp,
+                        (unsigned long)(uintptr_t)entry_p->caller_p,
+                        (unsigned long)(uintptr_t)entry_p->buf_p,
+                        (unsigned long)entry_p->size,
+                        (entry_p->size == 0
+                         ? "free"
+                         : (entry_p->buf_p == NULL ? "failed" : "alloc")));
+        }
+
+        heap_p = heap_p->next_heap_p;
+    }
+
+    return (0);
+}
+
+#    endif
+
+#endif
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+
+/**
+ * Register given heap counter as /alloc/heap/<heap name>/<name>.
+ */
+static void counter_register(struct heap_counter_t *self_p,
+                             const char *heap_name_p,
+                             const char *name_p)
+{
+    std_snprintf(&self_p->path[0],
+                 sizeof(self_p->path),
+                 FSTR("/alloc/heap/%s/%s"),
+                 heap_name_p,
+                 name_p);
+    fs_counter_init(&self_p->counter, &self_p->path[0], 0);
+    fs_counter_register(&self_p->counter);
+}
+
+#endif
+
+int heap_module_init(void)
+{
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+    fs_command_init(&module.cmd_stats,
+                    CSTR("/alloc/heap/stats"),
+                    cmd_stats_cb,
+                    NULL);
+    fs_command_register(&module.cmd_stats);
+
+#    if CONFIG_HEAP_TRACE == 1
+    fs_command_init(&module.cmd_trace,
+                    CSTR("/alloc/heap/trace"),
+                    cmd_trace_cb,
+                    NULL);
+    fs_command_register(&module.cmd_trace);
+#    endif
+#endif
 
     return (0);
 }
@@ -165,6 +687,7 @@ int heap_init(struct heap_t *self_p,
     ASSERTN(size > 0, EINVAL);
 
     int i;
+    uintptr_t end_p;
 
     self_p->buf_p = buf_p;
     self_p->size = size;
@@ -175,11 +698,65 @@ int heap_init(struct heap_t *self_p,
         self_p->fixed[i].size = sizes[i];
     }
 
-    self_p->dynamic.free_p = NULL;
+    memset(&self_p->dynamic, 0, sizeof(self_p->dynamic));
+    end_p = ((uintptr_t)buf_p + size);
+    end_p -= (end_p % DYNAMIC_ALIGNMENT);
+    self_p->dynamic.begin_p = (void *)end_p;
+    self_p->dynamic.end_p = (void *)end_p;
+    memset(&self_p->stats, 0, sizeof(self_p->stats));
+
+#if CONFIG_HEAP_TRACE == 1
+    self_p->trace.count = 0;
+#endif
+#if CONFIG_HEAP_FS_COMMANDS == 1
+    self_p->counters.allocs.counter.value = 0;
+    self_p->counters.frees.counter.value = 0;
+    self_p->counters.failed_allocs.counter.value = 0;
+#endif
 
     return (mutex_init(&self_p->mutex));
 }
 
+int heap_register(struct heap_t *self_p,
+                  const char *name_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(name_p != NULL, EINVAL);
+#if CONFIG_HEAP_FS_COMMANDS == 1
+    ASSERTN(strlen(name_p) <= HEAP_NAME_MAX, EINVAL);
+#endif
+
+    self_p->name_p = name_p;
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+    counter_register(&self_p->counters.allocs, name_p, "allocs");
+    counter_register(&self_p->counters.frees, name_p, "frees");
+    counter_register(&self_p->counters.failed_allocs,
+                     name_p,
+                     "failed_allocs");
+#endif
+
+    sys_lock();
+    self_p->next_heap_p = module.heaps_p;
+    module.heaps_p = self_p;
+    sys_unlock();
+
+    return (0);
+}
+
+int heap_get_stats(struct heap_t *self_p,
+                   struct heap_stats_t *stats_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(stats_p != NULL, EINVAL);
+
+    mutex_lock(&self_p->mutex);
+    *stats_p = self_p->stats;
+    mutex_unlock(&self_p->mutex);
+
+    return (0);
+}
+
 void *heap_alloc(struct heap_t *self_p,
                  size_t size)
 {
@@ -196,6 +773,30 @@ void *heap_alloc(struct heap_t *self_p,
         buf_p = alloc_dynamic_size(self_p, size);
     }
 
+    if (buf_p != NULL) {
+        self_p->stats.allocs++;
+        self_p->stats.used += buffer_size(
+            &((struct heap_buffer_header_t *)buf_p)[-1]);
+
+        if (self_p->stats.used > self_p->stats.used_max) {
+            self_p->stats.used_max = self_p->stats.used;
+        }
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+        fs_counter_increment(&self_p->counters.allocs.counter, 1);
+#endif
+    } else {
+        self_p->stats.failed_allocs++;
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+        fs_counter_increment(&self_p->counters.failed_allocs.counter, 1);
+#endif
+    }
+
+#if CONFIG_HEAP_TRACE == 1
+    trace_record(self_p, __builtin_return_address(0), buf_p, size);
+#endif
+
     mutex_unlock(&self_p->mutex);
 
     return (buf_p);
@@ -220,6 +821,16 @@ int heap_free(struct heap_t *self_p,
 
         /* Free when count is zero. */
         if (count == 0) {
+            self_p->stats.frees++;
+            self_p->stats.used -= buffer_size(header_p);
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+            fs_counter_increment(&self_p->counters.frees.counter, 1);
+#endif
+#if CONFIG_HEAP_TRACE == 1
+            trace_record(self_p, __builtin_return_address(0), buf_p, 0);
+#endif
+
             if (header_p->u.fixed_p != NULL) {
                 count = free_fixed_size(self_p, header_p);
             } else {
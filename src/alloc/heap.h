@@ -43,10 +43,88 @@ struct heap_fixed_t {
     size_t size;
 };
 
+/**
+ * Number of first level size classes of the dynamic allocator. Each
+ * first level class spans a power of two, and free blocks bigger than
+ * the last class are all kept in the last class.
+ */
+#define HEAP_DYNAMIC_FL_COUNT 16
+
+/**
+ * Number of second level size classes per first level class, as a
+ * power of two.
+ */
+#define HEAP_DYNAMIC_SL_COUNT_LOG2 2
+#define HEAP_DYNAMIC_SL_COUNT (1 << HEAP_DYNAMIC_SL_COUNT_LOG2)
+
+/**
+ * The dynamic allocator is a two level segregated fit allocator
+ * (TLSF). Blocks are carved from the end of the heap memory buffer
+ * towards the fixed size buffers, which are allocated from the
+ * beginning of it.
+ */
 struct heap_dynamic_t {
-    void *free_p;
+    /* Lowest address of the dynamic region. */
+    void *begin_p;
+    /* End of the dynamic region. */
+    void *end_p;
+    /* One bit per first level class with at least one free block. */
+    uint32_t fl_bitmap;
+    /* One bit per second level class with at least one free block. */
+    uint8_t sl_bitmap[HEAP_DYNAMIC_FL_COUNT];
+    /* Free list heads. */
+    void *free_p[HEAP_DYNAMIC_FL_COUNT][HEAP_DYNAMIC_SL_COUNT];
+};
+
+/**
+ * Heap statistics.
+ */
+struct heap_stats_t {
+    /** Number of bytes currently allocated, including headers. */
+    size_t used;
+    /** High-water mark of used. */
+    size_t used_max;
+    /** Number of successful allocations. */
+    uint32_t allocs;
+    /** Number of buffers freed. */
+    uint32_t frees;
+    /** Number of allocations that failed due to lack of memory. */
+    uint32_t failed_allocs;
+};
+
+#if CONFIG_HEAP_TRACE == 1
+
+/**
+ * An entry in the allocation trace.
+ */
+struct heap_trace_entry_t {
+    /** Return address of the heap_alloc() or heap_free() call. */
+    void *caller_p;
+    /** Allocated or freed buffer, or NULL on allocation failure. */
+    void *buf_p;
+    /** Requested size, or zero(0) for a free. */
+    size_t size;
+    /** Uptime in milliseconds. */
+    uint32_t timestamp;
+};
+
+#endif
+
+#if CONFIG_HEAP_FS_COMMANDS == 1
+
+/* Longest heap name in file system counter paths. */
+#define HEAP_NAME_MAX                                      16
+
+/**
+ * A file system counter of a heap, ``/alloc/heap/<name>/<counter>``.
+ */
+struct heap_counter_t {
+    struct fs_counter_t counter;
+    char path[sizeof("/alloc/heap//failed_allocs") + HEAP_NAME_MAX];
 };
 
+#endif
+
 /**
  * The heap struct.
  */
@@ -57,8 +135,37 @@ struct heap_t {
     struct heap_fixed_t fixed[HEAP_FIXED_SIZES_MAX];
     struct heap_dynamic_t dynamic;
     struct mutex_t mutex;
+    struct heap_stats_t stats;
+#if CONFIG_HEAP_TRACE == 1
+    struct {
+        struct heap_trace_entry_t entries[CONFIG_HEAP_TRACE_LENGTH];
+        /* Total number of recorded entries. */
+        uint32_t count;
+    } trace;
+#endif
+    /* Registered heaps. */
+    const char *name_p;
+    struct heap_t *next_heap_p;
+#if CONFIG_HEAP_FS_COMMANDS == 1
+    struct {
+        struct heap_counter_t allocs;
+        struct heap_counter_t frees;
+        struct heap_counter_t failed_allocs;
+    } counters;
+#endif
 };
 
+/**
+ * Initialize the heap module. This function must be called before
+ * calling any other function in this module.
+ *
+ * The module will only be initialized once even if this function is
+ * called multiple times.
+ *
+ * @return zero(0) or negative error code
+ */
+int heap_module_init(void);
+
 /**
  * Initialize given heap.
  *
@@ -73,12 +180,45 @@ int heap_init(struct heap_t *self_p,
               size_t size,
               size_t sizes[HEAP_FIXED_SIZES_MAX]);
 
+/**
+ * Register given initialized heap under given name, making it visible
+ * in the file system command ``/alloc/heap/stats`` and, if enabled,
+ * ``/alloc/heap/trace``. Its allocation, free and failed allocation
+ * counts are registered as the file system counters
+ * ``/alloc/heap/<name>/allocs``, ``/alloc/heap/<name>/frees`` and
+ * ``/alloc/heap/<name>/failed_allocs``. A heap can only be registered
+ * once, but it may be initialized again after it has been registered,
+ * which resets its counters.
+ *
+ * @param[in] self_p Heap to register.
+ * @param[in] name_p Heap name.
+ *
+ * @return zero(0) or negative error code.
+ */
+int heap_register(struct heap_t *self_p,
+                  const char *name_p);
+
+/**
+ * Get a copy of the statistics of given heap.
+ *
+ * @param[in] self_p Heap to get statistics of.
+ * @param[out] stats_p Statistics of the heap.
+ *
+ * @return zero(0) or negative error code.
+ */
+int heap_get_stats(struct heap_t *self_p,
+                   struct heap_stats_t *stats_p);
+
 /**
  * Allocate a buffer of given size from given heap. Tries to allocate
  * a fixed size buffer, and allocates a buffer from the dynamic heap
  * if the requested buffer size is greater than the biggest fixed size
  * buffer.
  *
+ * Dynamic buffers are allocated and freed in constant time. Big free
+ * buffers are split on allocation, and neighbouring free buffers are
+ * merged when freed.
+ *
  * @param[in] self_p Heap to allocate from.
  * @param[in] size Number of bytes to allocate.
  *
@@ -289,6 +289,17 @@
 #    endif
 #endif
 
+/**
+ * Run all threads as coroutines on one host thread on Linux, instead
+ * of one host thread per thread. A context switch is a stack switch
+ * in user space rather than a handshake between host threads, and
+ * thread stacks are real stacks. All stacks are given 16 kB extra
+ * space for host library calls.
+ */
+#ifndef CONFIG_LINUX_THRD_COROUTINES
+#    define CONFIG_LINUX_THRD_COROUTINES                    0
+#endif
+
 /**
  * Enable linux driver implementations as TCP sockets. Can be used to
  * simulate driver communication in an application running on linux.
@@ -900,6 +911,17 @@
 #    endif
 #endif
 
+/**
+ * Initialize the heap module at system startup.
+ */
+#ifndef CONFIG_MODULE_INIT_HEAP
+#    if defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_MODULE_INIT_HEAP                     0
+#    else
+#        define CONFIG_MODULE_INIT_HEAP                     1
+#    endif
+#endif
+
 /**
  * Initialize the settings module at system startup.
  */
@@ -1380,6 +1402,17 @@
 #    endif
 #endif
 
+/**
+ * Heap module debug file system commands and counters.
+ */
+#ifndef CONFIG_HEAP_FS_COMMANDS
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO) || defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_HEAP_FS_COMMANDS                     0
+#    else
+#        define CONFIG_HEAP_FS_COMMANDS                     1
+#    endif
+#endif
+
 /**
  * Debug file system command to read from a i2c bus.
  */
@@ -1424,6 +1457,80 @@
 #    endif
 #endif
 
+/**
+ * Deferred logging. `log_object_print()` only copies the format
+ * string pointer, the time and the arguments into a buffer, and a low
+ * priority thread formats the log entries and writes them to the log
+ * handlers. Log entries may then also be written from interrupt
+ * context with `log_object_print_isr()`.
+ */
+#ifndef CONFIG_LOG_DEFERRED
+#    define CONFIG_LOG_DEFERRED                             0
+#endif
+
+/**
+ * Size in bytes of the deferred log entries buffer. Entries are
+ * dropped when it is full.
+ */
+#ifndef CONFIG_LOG_DEFERRED_BUFFER_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_LOG_DEFERRED_BUFFER_SIZE           256
+#    else
+#        define CONFIG_LOG_DEFERRED_BUFFER_SIZE          2048
+#    endif
+#endif
+
+/**
+ * Maximum number of characters of a ``%s`` argument copied into the
+ * deferred log entries buffer. Longer strings are truncated.
+ */
+#ifndef CONFIG_LOG_DEFERRED_STRING_MAX
+#    define CONFIG_LOG_DEFERRED_STRING_MAX                 32
+#endif
+
+/**
+ * Deferred log thread priority.
+ */
+#ifndef CONFIG_LOG_DEFERRED_PRIO
+#    define CONFIG_LOG_DEFERRED_PRIO                      100
+#endif
+
+/**
+ * Deferred log thread stack size in words.
+ */
+#ifndef CONFIG_LOG_DEFERRED_STACK_SIZE
+#    if defined(ARCH_LINUX) || defined(ARCH_ESP32)
+#        define CONFIG_LOG_DEFERRED_STACK_SIZE           4096
+#    else
+#        define CONFIG_LOG_DEFERRED_STACK_SIZE            768
+#    endif
+#endif
+
+/**
+ * Binary logging. `log_object_print()` writes each log entry as a
+ * compact binary record with a format string identifier and the
+ * packed arguments, instead of formatting it. Identifiers are
+ * assigned at build time to format strings created with `OSTR()` in
+ * applications built with ``SOAM=yes``. Other messages are formatted
+ * on target and added to the record as text. The records are decoded
+ * by ``make/logdecoder.py`` and ``soam.py``.
+ */
+#ifndef CONFIG_LOG_BINARY
+#    define CONFIG_LOG_BINARY                               0
+#endif
+
+/**
+ * Maximum size in bytes of a binary log record. Longer records are
+ * truncated.
+ */
+#ifndef CONFIG_LOG_BINARY_RECORD_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_LOG_BINARY_RECORD_SIZE              64
+#    else
+#        define CONFIG_LOG_BINARY_RECORD_SIZE             128
+#    endif
+#endif
+
 /**
  * Debug file system command to list all network interfaces.
  */
@@ -1709,6 +1816,18 @@
 #    define CONFIG_MONITOR_THREAD_PERIOD_US           2000000
 #endif
 
+/**
+ * Support for priority inheritance in mutexes, see
+ * `mutex_set_prio_inherit()`. Adds a few bytes to each thread.
+ */
+#ifndef CONFIG_MUTEX_PRIO_INHERIT
+#    if defined(ARCH_AVR)
+#        define CONFIG_MUTEX_PRIO_INHERIT                   0
+#    else
+#        define CONFIG_MUTEX_PRIO_INHERIT                   1
+#    endif
+#endif
+
 /**
  * Use a preemptive scheduler.
  */
@@ -1808,6 +1927,36 @@
 #    endif
 #endif
 
+/**
+ * Number of 512 bytes blocks in the FAT16 block cache. Dirty blocks
+ * are written to the storage device when replaced, and when a file
+ * is synchronized or the file system is unmounted.
+ */
+#ifndef CONFIG_FAT16_CACHE_BLOCKS
+#    if defined(ARCH_AVR)
+#        define CONFIG_FAT16_CACHE_BLOCKS                   1
+#    else
+#        define CONFIG_FAT16_CACHE_BLOCKS                   4
+#    endif
+#endif
+
+/**
+ * Size in bytes of the FAT16 free cluster bitmap, built when the file
+ * system is mounted. It has one bit per cluster, so 8192 bytes covers
+ * the largest FAT16 volume. A smaller bitmap covers the first
+ * clusters of the volume, and free clusters after them are searched
+ * for in the FAT. The bitmap is not used if zero(0).
+ */
+#ifndef CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE
+#    if defined(ARCH_LINUX)
+#        define CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE    8192
+#    elif defined(ARCH_AVR)
+#        define CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE      64
+#    else
+#        define CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE     512
+#    endif
+#endif
+
 /**
  * Generic file system.
  */
@@ -2001,16 +2150,20 @@
 #endif
 
 /**
- * Non-volatile memory software EEPROM block 0 size. Must be a
- * multiple of ``CONFIG_NVM_EEPROM_SOFT_CHUNK_SIZE``.
+ * Non-volatile memory software EEPROM block 0 size. Must fit the
+ * block header and one record more than there are lines in a chunk,
+ * and be at most 64 KiB. A record is eight bytes plus
+ * ``CONFIG_EEPROM_SOFT_LINE_SIZE``.
  */
 #ifndef CONFIG_NVM_EEPROM_SOFT_BLOCK_0_SIZE
 #    define CONFIG_NVM_EEPROM_SOFT_BLOCK_0_SIZE         16384
 #endif
 
 /**
- * Non-volatile memory software EEPROM block 1 size. Must be a
- * multiple of ``CONFIG_NVM_EEPROM_SOFT_CHUNK_SIZE``.
+ * Non-volatile memory software EEPROM block 1 size. Must fit the
+ * block header and one record more than there are lines in a chunk,
+ * and be at most 64 KiB. A record is eight bytes plus
+ * ``CONFIG_EEPROM_SOFT_LINE_SIZE``.
  */
 #ifndef CONFIG_NVM_EEPROM_SOFT_BLOCK_1_SIZE
 #    define CONFIG_NVM_EEPROM_SOFT_BLOCK_1_SIZE         16384
@@ -2161,10 +2314,28 @@
 #endif
 
 /**
- * System tick frequency in Hertz.
+ * Only process system ticks when a timer expires instead of
+ * periodically. The system tick thread sleeps until the next timer
+ * expiry, as calculated by the timer module, and then catches up on
+ * all passed ticks. Only supported on Linux, and must not be combined
+ * with the preemptive scheduler. An idle process does not consume any
+ * CPU time, and a higher tick frequency is affordable.
+ */
+#ifndef CONFIG_SYSTEM_TICKLESS
+#    define CONFIG_SYSTEM_TICKLESS                          0
+#endif
+
+/**
+ * System tick frequency in Hertz. Frequencies above 1000 Hz must be
+ * divisors of 1000000. The tickless Linux port defaults to 10 kHz for
+ * sub-millisecond sleeps and timeouts.
  */
 #ifndef CONFIG_SYSTEM_TICK_FREQUENCY
-#    define CONFIG_SYSTEM_TICK_FREQUENCY                  100
+#    if defined(ARCH_LINUX) && (CONFIG_SYSTEM_TICKLESS == 1)
+#        define CONFIG_SYSTEM_TICK_FREQUENCY            10000
+#    else
+#        define CONFIG_SYSTEM_TICK_FREQUENCY              100
+#    endif
 #endif
 
 /**
@@ -2254,6 +2425,17 @@
 #    endif
 #endif
 
+/**
+ * Use a scheduler ready queue with one FIFO per priority level and a
+ * bitmap of non-empty levels. Pushing and popping a thread takes
+ * constant time, independent of the number of ready threads, at the
+ * cost of about 2 kB RAM on a 32 bits CPU. The default ready queue is
+ * a sorted linked list with linear insertion time.
+ */
+#ifndef CONFIG_THRD_READY_BITMAP
+#    define CONFIG_THRD_READY_BITMAP                        0
+#endif
+
 /**
  * Count the number of times each thread has been scheduled.
  */
@@ -2265,6 +2447,21 @@
 #    endif
 #endif
 
+/**
+ * Record heap allocations and frees in a per heap ring buffer. Dump
+ * it with the file system command ``/alloc/heap/trace``.
+ */
+#ifndef CONFIG_HEAP_TRACE
+#    define CONFIG_HEAP_TRACE                               0
+#endif
+
+/**
+ * Number of entries in the heap trace ring buffer.
+ */
+#ifndef CONFIG_HEAP_TRACE_LENGTH
+#    define CONFIG_HEAP_TRACE_LENGTH                       32
+#endif
+
 /**
  * Enable the thread stack heap allocator.
  */
@@ -2290,6 +2487,20 @@
 #    endif
 #endif
 
+/**
+ * Use a hierarchical timing wheel with four levels of 64 slots each
+ * instead of a sorted delta list for active timers. Starting and
+ * stopping a timer takes constant time, independent of the number of
+ * active timers, at the cost of about 1 kB RAM on a 32 bits CPU.
+ */
+#ifndef CONFIG_TIMER_WHEEL
+#    if defined(ARCH_LINUX)
+#        define CONFIG_TIMER_WHEEL                          1
+#    else
+#        define CONFIG_TIMER_WHEEL                          0
+#    endif
+#endif
+
 /**
  * USB device vendor id.
  */
@@ -2385,13 +2596,229 @@
 #endif
 
 /**
- * Size of the HTTP server request buffer. This buffer is used when
- * parsing received HTTP request headers.
+ * Size of the HTTP server connection input buffer. Received data is
+ * read into this buffer, and the request line and each header line
+ * must fit in it.
  */
 #ifndef CONFIG_HTTP_SERVER_REQUEST_BUFFER_SIZE
 #    define CONFIG_HTTP_SERVER_REQUEST_BUFFER_SIZE        128
 #endif
 
+/**
+ * Time in milliseconds a persistent HTTP server connection may be
+ * idle waiting for the next request before it is closed.
+ */
+#ifndef CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS
+#    define CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS     5000
+#endif
+
+/**
+ * Time in milliseconds a multiplexed HTTP server waits for the rest
+ * of a request that does not fit in the request buffer, for example
+ * a large body, before the connection is closed. No other connection
+ * is served meanwhile.
+ */
+#ifndef CONFIG_HTTP_SERVER_REQUEST_TIMEOUT_MS
+#    define CONFIG_HTTP_SERVER_REQUEST_TIMEOUT_MS        1000
+#endif
+
+/**
+ * Maximum number of connections of a multiplexed HTTP server.
+ */
+#ifndef CONFIG_HTTP_SERVER_CONNECTIONS_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_HTTP_SERVER_CONNECTIONS_MAX            4
+#    else
+#        define CONFIG_HTTP_SERVER_CONNECTIONS_MAX           32
+#    endif
+#endif
+
+/**
+ * Maximum number of nodes in the HTTP server route table. Each unique
+ * path segment in the routes array uses one node.
+ */
+#ifndef CONFIG_HTTP_SERVER_ROUTE_NODES_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_HTTP_SERVER_ROUTE_NODES_MAX            8
+#    else
+#        define CONFIG_HTTP_SERVER_ROUTE_NODES_MAX           32
+#    endif
+#endif
+
+/**
+ * Maximum number of path parameters in a HTTP server route.
+ */
+#ifndef CONFIG_HTTP_SERVER_ROUTE_PARAMS_MAX
+#    define CONFIG_HTTP_SERVER_ROUTE_PARAMS_MAX               4
+#endif
+
+/**
+ * Size of the buffer on the stack used by the HTTP server static file
+ * route to read files in chunks. The response header is written to
+ * the same buffer, so it must be at least 128 bytes.
+ */
+#ifndef CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE   128
+#    else
+#        define CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE   512
+#    endif
+#endif
+
+/**
+ * Number of static file entity tags remembered by the HTTP server, so
+ * revalidated files are not read again to calculate their tags.
+ */
+#ifndef CONFIG_HTTP_SERVER_STATIC_FILE_ETAGS_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_HTTP_SERVER_STATIC_FILE_ETAGS_MAX      2
+#    else
+#        define CONFIG_HTTP_SERVER_STATIC_FILE_ETAGS_MAX      8
+#    endif
+#endif
+
+/**
+ * Size in bytes of the stack buffer used to write a websocket frame
+ * header together with the first part of its payload, so small
+ * frames are written to the socket at once. The websocket client
+ * also masks the payload in it. It must be larger than the maximum
+ * frame header size of 14 bytes.
+ */
+#ifndef CONFIG_HTTP_WEBSOCKET_WRITE_BUFFER_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_HTTP_WEBSOCKET_WRITE_BUFFER_SIZE      64
+#    else
+#        define CONFIG_HTTP_WEBSOCKET_WRITE_BUFFER_SIZE     256
+#    endif
+#endif
+
+/**
+ * Maximum number of outgoing QoS 1 and QoS 2 MQTT messages waiting
+ * to be acknowledged by the server at the same time. This is also
+ * the number of incoming QoS 2 messages that can wait for a release
+ * from the server.
+ */
+#ifndef CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW
+#    if defined(ARCH_AVR)
+#        define CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW            1
+#    else
+#        define CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW            4
+#    endif
+#endif
+
+/**
+ * Maximum number of subscriptions in the MQTT client topic registry
+ * an incoming message is dispatched to.
+ */
+#ifndef CONFIG_MQTT_CLIENT_SUBSCRIPTION_MATCHES_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_MQTT_CLIENT_SUBSCRIPTION_MATCHES_MAX   4
+#    else
+#        define CONFIG_MQTT_CLIENT_SUBSCRIPTION_MATCHES_MAX   8
+#    endif
+#endif
+
+/**
+ * Size in bytes of the MQTT client buffer an incoming payload is read
+ * into when it is dispatched to more than one subscription, so every
+ * callback can read the whole payload. Larger payloads are streamed
+ * to the callbacks.
+ */
+#ifndef CONFIG_MQTT_CLIENT_PAYLOAD_BUFFER_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_MQTT_CLIENT_PAYLOAD_BUFFER_SIZE       32
+#    else
+#        define CONFIG_MQTT_CLIENT_PAYLOAD_BUFFER_SIZE      256
+#    endif
+#endif
+
+/**
+ * Maximum number of client side SSL sessions, one per server
+ * hostname, stored to resume the session with an abbreviated
+ * handshake when reconnecting to the server. Set to 0 to disable
+ * client side session resumption.
+ */
+#ifndef CONFIG_SSL_SESSION_CACHE_CLIENT_MAX
+#    define CONFIG_SSL_SESSION_CACHE_CLIENT_MAX                2
+#endif
+
+/**
+ * Maximum server hostname length, including the null termination,
+ * of a stored client side SSL session. Sessions with longer
+ * hostnames are not stored.
+ */
+#ifndef CONFIG_SSL_SESSION_CACHE_HOSTNAME_MAX
+#    define CONFIG_SSL_SESSION_CACHE_HOSTNAME_MAX             64
+#endif
+
+/**
+ * Maximum number of SSL sessions stored by a server side SSL
+ * context, to resume the sessions of reconnecting clients. Set to 0
+ * to disable the server side session cache.
+ */
+#ifndef CONFIG_SSL_SESSION_CACHE_SERVER_MAX
+#    define CONFIG_SSL_SESSION_CACHE_SERVER_MAX                4
+#endif
+
+/**
+ * Issue session tickets from server side SSL contexts, so clients
+ * can resume their sessions without a server side session cache
+ * entry.
+ */
+#ifndef CONFIG_SSL_SESSION_TICKETS
+#    define CONFIG_SSL_SESSION_TICKETS                         1
+#endif
+
+/**
+ * Session ticket lifetime in seconds.
+ */
+#ifndef CONFIG_SSL_SESSION_TICKET_LIFETIME
+#    define CONFIG_SSL_SESSION_TICKET_LIFETIME             86400
+#endif
+
+/**
+ * Size in bytes of the heap mbedTLS allocates from while an SSL
+ * socket is open. It must fit the peak memory usage of the
+ * handshake. The heap is released as a whole when the socket is
+ * closed, so the system heap does not fragment. Set to 0 to allocate
+ * from the system heap instead.
+ */
+#ifndef CONFIG_SSL_SOCKET_HEAP_SIZE
+#    if defined(ARCH_LINUX)
+#        define CONFIG_SSL_SOCKET_HEAP_SIZE                65536
+#    elif defined(ARCH_ESP32)
+#        define CONFIG_SSL_SOCKET_HEAP_SIZE                49152
+#    else
+#        define CONFIG_SSL_SOCKET_HEAP_SIZE                    0
+#    endif
+#endif
+
+/**
+ * Maximum TFTP server block size in bytes, negotiated with the
+ * blksize option (RFC 2348). The default block size of 512 bytes is
+ * used if the client does not request a block size. The default
+ * maximum fills an ethernet frame.
+ */
+#ifndef CONFIG_TFTP_SERVER_BLKSIZE_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_TFTP_SERVER_BLKSIZE_MAX               512
+#    else
+#        define CONFIG_TFTP_SERVER_BLKSIZE_MAX              1428
+#    endif
+#endif
+
+/**
+ * Maximum number of TFTP data packets sent before waiting for an
+ * acknowledgement, negotiated with the windowsize option (RFC 7440).
+ */
+#ifndef CONFIG_TFTP_SERVER_WINDOWSIZE_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_TFTP_SERVER_WINDOWSIZE_MAX              1
+#    else
+#        define CONFIG_TFTP_SERVER_WINDOWSIZE_MAX             16
+#    endif
+#endif
+
 /**
  * Use lookup tables for CRC calculations. It is faster, but uses more
  * memory.
@@ -2490,6 +2917,23 @@
 #    define CONFIG_EEPROM_SOFT_CRC  CONFIG_EEPROM_SOFT_CRC_32
 #endif
 
+/**
+ * Software eeprom line size in bytes. Writes are stored as records
+ * of one line each, so a small write only programs a line and its
+ * record header to flash. Must be a multiple of 8.
+ */
+#ifndef CONFIG_EEPROM_SOFT_LINE_SIZE
+#    define CONFIG_EEPROM_SOFT_LINE_SIZE                   16
+#endif
+
+/**
+ * Maximum number of lines in a software eeprom. Each line uses two
+ * bytes of RAM for its index entry.
+ */
+#ifndef CONFIG_EEPROM_SOFT_LINES_MAX
+#    define CONFIG_EEPROM_SOFT_LINES_MAX                  256
+#endif
+
 /**
  * Configuration validation.
  */
@@ -2505,4 +2949,8 @@
 #    error "CONFIG_START_SHELL and CONFIG_START_SOAM cannot both be set to 1."
 #endif
 
+#if (CONFIG_LOG_BINARY == 1) && (CONFIG_LOG_DEFERRED == 1)
+#    error "CONFIG_LOG_BINARY and CONFIG_LOG_DEFERRED cannot both be set to 1."
+#endif
+
 #endif
@@ -31,11 +31,62 @@
 #include "simba.h"
 #include <stdarg.h>
 
+#if CONFIG_LOG_DEFERRED == 1
+
+/* Deferred log entry states. */
+#define ENTRY_STATE_WRITING                                 0
+#define ENTRY_STATE_READY                                   1
+#define ENTRY_STATE_PADDING                                 2
+
+/* Entries are aligned for the header to be accessed in place. */
+#define ENTRY_ALIGNMENT                          sizeof(long)
+
+/**
+ * A deferred log entry header, followed by the packed arguments.
+ */
+struct entry_t {
+    uint16_t size;
+    uint8_t state;
+    uint8_t level;
+    far_string_t fmt_p;
+    const char *name_p;
+    const char *thrd_name_p;
+    struct time_t uptime;
+};
+
+#endif
+
+#if CONFIG_LOG_BINARY == 1
+
+/* Format identifier of binary log records with a text message. */
+#define RECORD_FORMAT_ID_TEXT                          0x0000
+
+/**
+ * A binary log record being packed.
+ */
+struct record_t {
+    uint8_t buf[CONFIG_LOG_BINARY_RECORD_SIZE];
+    size_t pos;
+};
+
+#endif
+
 struct module_t {
     int8_t initialized;
     struct log_handler_t handler;
     struct log_object_t object;
     struct mutex_t mutex;
+#if CONFIG_LOG_DEFERRED == 1
+    struct {
+        long buf[CONFIG_LOG_DEFERRED_BUFFER_SIZE / sizeof(long)];
+        size_t head;
+        size_t tail;
+        size_t used;
+        uint32_t dropped;
+        uint32_t reported;
+        struct sem_t sem;
+    } deferred;
+#endif
 #if CONFIG_LOG_FS_COMMANDS == 1
     struct fs_command_t cmd_print;
     struct fs_command_t cmd_list;
@@ -43,6 +94,9 @@ struct module_t {
 #endif
 };
 
+/* Level names are only printed by text log entries. */
+#if (CONFIG_LOG_DEFERRED == 1) || (CONFIG_LOG_BINARY == 0)
+
 static FAR const char level_fatal[] = "fatal";
 static FAR const char level_error[] = "error";
 static FAR const char level_warning[] = "warning";
@@ -58,6 +112,8 @@ static const char FAR *level_as_string[] = {
     level_debug
 };
 
+#endif
+
 /* The module state. */
 static struct module_t module;
 
@@ -192,6 +248,15 @@ int log_module_init()
 
     mutex_init(&module.mutex);
 
+#if CONFIG_LOG_DEFERRED == 1
+    module.deferred.head = 0;
+    module.deferred.tail = 0;
+    module.deferred.used = 0;
+    module.deferred.dropped = 0;
+    module.deferred.reported = 0;
+    sem_init(&module.deferred.sem, 1, 1);
+#endif
+
     module.handler.chout_p = sys_get_stdout();
     module.handler.next_p = NULL;
 
@@ -364,37 +429,898 @@ int log_object_is_enabled_for(struct log_object_t *self_p,
     }
 }
 
-int log_object_print(struct log_object_t *self_p,
-                     int level,
-                     const char *fmt_p,
-                     ...)
+#if (CONFIG_LOG_DEFERRED == 1) || (CONFIG_LOG_BINARY == 1)
+
+/**
+ * Parse given conversion specification, after the '%'. Returns a
+ * pointer to the character after it.
+ */
+static far_string_t parse_specifier(far_string_t fmt_p,
+                                    char *flags_p,
+                                    int *width_p,
+                                    char *length_p,
+                                    char *specifier_p)
 {
-    ASSERTN(fmt_p != NULL, EINVAL);
+    char c;
+
+    /* Prototype: %[flags][width][length]specifier, as in std. */
+    *flags_p = ' ';
+    c = *fmt_p++;
+
+    if ((c == '0') || (c == '-')) {
+        *flags_p = c;
+        c = *fmt_p++;
+    }
+
+    *width_p = 0;
+
+    while ((c >= '0') && (c <= '9')) {
+        *width_p *= 10;
+        *width_p += (c - '0');
+        c = *fmt_p++;
+    }
+
+    *length_p = 0;
+
+    if (c == 'l') {
+        *length_p = 1;
+        c = *fmt_p++;
+    }
+
+    *specifier_p = c;
+
+    if (c == '\0') {
+        fmt_p--;
+    }
+
+    return (fmt_p);
+}
+
+#endif
+
+#if CONFIG_LOG_DEFERRED == 1
+
+/**
+ * Pack the arguments of given format string into given buffer, or
+ * only calculate their size if the buffer is NULL. Integers are
+ * packed as longs, and strings are copied.
+ */
+static size_t pack_arguments(far_string_t fmt_p,
+                             va_list *ap_p,
+                             uint8_t *buf_p)
+{
+    size_t pos;
+    size_t size;
+    char c;
+    char flags;
+    int width;
+    char length;
+    long value;
+    const char *string_p;
+    far_string_t far_string_p;
+#if CONFIG_FLOAT == 1
+    double double_value;
+#endif
+
+    pos = 0;
+
+    while ((c = *fmt_p++) != '\0') {
+        if (c != '%') {
+            continue;
+        }
+
+        fmt_p = parse_specifier(fmt_p, &flags, &width, &length, &c);
+
+        switch (c) {
+
+        case 'i':
+        case 'd':
+        case 'c':
+            if (length == 0) {
+                value = va_arg(*ap_p, int);
+            } else {
+                value = va_arg(*ap_p, long);
+            }
 
+            if (buf_p != NULL) {
+                memcpy(&buf_p[pos], &value, sizeof(value));
+            }
+
+            pos += sizeof(value);
+            break;
+
+        case 'u':
+        case 'x':
+            if (length == 0) {
+                value = va_arg(*ap_p, unsigned int);
+            } else {
+                value = va_arg(*ap_p, long);
+            }
+
+            if (buf_p != NULL) {
+                memcpy(&buf_p[pos], &value, sizeof(value));
+            }
+
+            pos += sizeof(value);
+            break;
+
+        case 's':
+            string_p = va_arg(*ap_p, const char *);
+
+            if (string_p == NULL) {
+                string_p = "(null)";
+            }
+
+            size = strlen(string_p);
+
+            if (size > CONFIG_LOG_DEFERRED_STRING_MAX) {
+                size = CONFIG_LOG_DEFERRED_STRING_MAX;
+            }
+
+            if (buf_p != NULL) {
+                memcpy(&buf_p[pos], string_p, size);
+                buf_p[pos + size] = '\0';
+            }
+
+            pos += (size + 1);
+            break;
+
+        case 'S':
+            far_string_p = va_arg(*ap_p, far_string_t);
+
+            if (buf_p != NULL) {
+                memcpy(&buf_p[pos], &far_string_p, sizeof(far_string_p));
+            }
+
+            pos += sizeof(far_string_p);
+            break;
+
+#if CONFIG_FLOAT == 1
+        case 'f':
+            double_value = va_arg(*ap_p, double);
+
+            if (buf_p != NULL) {
+                memcpy(&buf_p[pos], &double_value, sizeof(double_value));
+            }
+
+            pos += sizeof(double_value);
+            break;
+#endif
+
+        default:
+            break;
+        }
+    }
+
+    return (pos);
+}
+
+static void write_padding(void *chout_p, char c, int width)
+{
+    while (width > 0) {
+        chan_write(chout_p, &c, sizeof(c));
+        width--;
+    }
+}
+
+/**
+ * Write given formatted field justified as std does.
+ */
+static void write_field(void *chout_p,
+                        const char *str_p,
+                        char flags,
+                        int width,
+                        int negative)
+{
+    size_t size;
+
+    size = strlen(str_p);
+    width -= size;
+
+    /* Right justification. */
+    if (flags != '-') {
+        if (negative && (flags == '0')) {
+            chan_write(chout_p, str_p, 1);
+            str_p++;
+            size--;
+        }
+
+        write_padding(chout_p, flags, width);
+        width = 0;
+    }
+
+    chan_write(chout_p, str_p, size);
+
+    /* Left justification. */
+    write_padding(chout_p, ' ', width);
+}
+
+/**
+ * Write the message of given format string with packed arguments to
+ * given channel. The output is identical to `std_fprintf()` with the
+ * original arguments, except for truncated strings.
+ */
+static void write_message(void *chout_p,
+                          far_string_t fmt_p,
+                          const uint8_t *args_p)
+{
+    char c;
+    char flags;
+    int width;
+    char length;
+    long value;
+    far_string_t far_string_p;
+    const char *str_p;
+    char buf[24];
+    size_t pos;
+    int negative;
+#if CONFIG_FLOAT == 1
+    double double_value;
+#endif
+
+    pos = 0;
+
+    while ((c = *fmt_p++) != '\0') {
+        if (c != '%') {
+            buf[pos++] = c;
+
+            if (pos == sizeof(buf)) {
+                chan_write(chout_p, &buf[0], pos);
+                pos = 0;
+            }
+
+            continue;
+        }
+
+        if (pos > 0) {
+            chan_write(chout_p, &buf[0], pos);
+            pos = 0;
+        }
+
+        fmt_p = parse_specifier(fmt_p, &flags, &width, &length, &c);
+        str_p = &buf[0];
+        negative = 0;
+
+        switch (c) {
+
+        case 'i':
+        case 'd':
+            memcpy(&value, args_p, sizeof(value));
+            args_p += sizeof(value);
+            std_sprintf(&buf[0], FSTR("%ld"), value);
+            negative = (value < 0);
+            break;
+
+        case 'u':
+            memcpy(&value, args_p, sizeof(value));
+            args_p += sizeof(value);
+            std_sprintf(&buf[0], FSTR("%lu"), value);
+            break;
+
+        case 'x':
+            memcpy(&value, args_p, sizeof(value));
+            args_p += sizeof(value);
+            std_sprintf(&buf[0], FSTR("%lx"), value);
+            break;
+
+        case 'c':
+            memcpy(&value, args_p, sizeof(value));
+            args_p += sizeof(value);
+            buf[0] = (char)value;
+            buf[1] = '\0';
+            break;
+
+        case 's':
+            str_p = (const char *)args_p;
+            args_p += (strlen(str_p) + 1);
+            break;
+
+        case 'S':
+            memcpy(&far_string_p, args_p, sizeof(far_string_p));
+            args_p += sizeof(far_string_p);
+
+            if (far_string_p == NULL) {
+                far_string_p = FSTR("(null)");
+            }
+
+            width -= std_strlen(far_string_p);
+
+            if (flags != '-') {
+                write_padding(chout_p, flags, width);
+            }
+
+            std_fprintf(chout_p, FSTR("%S"), far_string_p);
+
+            if (flags == '-') {
+                write_padding(chout_p, ' ', width);
+            }
+
+            continue;
+
+#if CONFIG_FLOAT == 1
+        case 'f':
+            memcpy(&double_value, args_p, sizeof(double_value));
+            args_p += sizeof(double_value);
+            std_sprintf(&buf[0], FSTR("%f"), double_value);
+            negative = (buf[0] == '-');
+            break;
+#endif
+
+        case '\0':
+            continue;
+
+        default:
+            buf[0] = c;
+            buf[1] = '\0';
+            break;
+        }
+
+        write_field(chout_p, str_p, flags, width, negative);
+    }
+
+    if (pos > 0) {
+        chan_write(chout_p, &buf[0], pos);
+    }
+}
+
+/**
+ * Allocate a deferred log entry of given size. Must be called with
+ * the system lock taken.
+ */
+static struct entry_t *entry_alloc_isr(size_t size)
+{
+    struct entry_t *entry_p;
+    size_t left;
+    uint8_t *buf_p;
+
+    buf_p = (uint8_t *)&module.deferred.buf[0];
+    size = ((size + ENTRY_ALIGNMENT - 1) & ~(ENTRY_ALIGNMENT - 1));
+    left = (sizeof(module.deferred.buf) - module.deferred.head);
+
+    /* Entries are not split at the end of the buffer. */
+    if (size > left) {
+        if (module.deferred.used + left + size > sizeof(module.deferred.buf)) {
+            return (NULL);
+        }
+
+        if (left >= sizeof(*entry_p)) {
+            entry_p = (struct entry_t *)&buf_p[module.deferred.head];
+            entry_p->size = left;
+            entry_p->state = ENTRY_STATE_PADDING;
+        }
+
+        module.deferred.used += left;
+        module.deferred.head = 0;
+    } else if (module.deferred.used + size > sizeof(module.deferred.buf)) {
+        return (NULL);
+    }
+
+    entry_p = (struct entry_t *)&buf_p[module.deferred.head];
+    entry_p->size = size;
+    entry_p->state = ENTRY_STATE_WRITING;
+    module.deferred.head += size;
+    module.deferred.used += size;
+
+    if (module.deferred.head == sizeof(module.deferred.buf)) {
+        module.deferred.head = 0;
+    }
+
+    return (entry_p);
+}
+
+/**
+ * Get the oldest deferred log entry, or NULL if there is none ready
+ * to be written. Must be called with the system lock taken.
+ */
+static struct entry_t *entry_get_isr(void)
+{
+    struct entry_t *entry_p;
+    size_t left;
+
+    while (module.deferred.used > 0) {
+        left = (sizeof(module.deferred.buf) - module.deferred.tail);
+
+        /* No room for an entry at the end of the buffer. */
+        if (left < sizeof(*entry_p)) {
+            module.deferred.used -= left;
+            module.deferred.tail = 0;
+            continue;
+        }
+
+        entry_p = (struct entry_t *)&(((uint8_t *)&module.deferred.buf[0])
+                                      [module.deferred.tail]);
+
+        if (entry_p->state == ENTRY_STATE_PADDING) {
+            module.deferred.used -= entry_p->size;
+            module.deferred.tail = 0;
+            continue;
+        }
+
+        if (entry_p->state == ENTRY_STATE_READY) {
+            return (entry_p);
+        }
+
+        break;
+    }
+
+    return (NULL);
+}
+
+/**
+ * Free the oldest deferred log entry. Must be called with the system
+ * lock taken.
+ */
+static void entry_free_isr(struct entry_t *entry_p)
+{
+    module.deferred.used -= entry_p->size;
+    module.deferred.tail += entry_p->size;
+
+    if (module.deferred.tail == sizeof(module.deferred.buf)) {
+        module.deferred.tail = 0;
+    }
+}
+
+/**
+ * Add a deferred log entry. The system lock is only taken to
+ * allocate the entry, so the arguments are packed with interrupts
+ * enabled.
+ */
+static int entry_add(int level,
+                     const char *name_p,
+                     const char *thrd_name_p,
+                     far_string_t fmt_p,
+                     va_list *ap_p,
+                     int isr)
+{
     va_list ap;
+    struct entry_t *entry_p;
+    size_t size;
+    struct time_t uptime;
+
+    va_copy(ap, *ap_p);
+    size = pack_arguments(fmt_p, &ap, NULL);
+    va_end(ap);
+
+    if (isr == 1) {
+        sys_uptime_isr(&uptime);
+        sys_lock_isr();
+    } else {
+        sys_uptime(&uptime);
+        sys_lock();
+    }
+
+    entry_p = entry_alloc_isr(sizeof(*entry_p) + size);
+
+    if (entry_p == NULL) {
+        module.deferred.dropped++;
+    }
+
+    if (isr == 1) {
+        sys_unlock_isr();
+    } else {
+        sys_unlock();
+    }
+
+    if (entry_p == NULL) {
+        return (-ENOMEM);
+    }
+
+    entry_p->level = level;
+    entry_p->fmt_p = fmt_p;
+    entry_p->name_p = name_p;
+    entry_p->thrd_name_p = thrd_name_p;
+    entry_p->uptime = uptime;
+    pack_arguments(fmt_p, ap_p, (uint8_t *)&entry_p[1]);
+    entry_p->state = ENTRY_STATE_READY;
+
+    /* Wake up the log thread. */
+    if (isr == 1) {
+        sem_give_isr(&module.deferred.sem, 1);
+    } else {
+        sem_give(&module.deferred.sem, 1);
+    }
+
+    return (1);
+}
+
+/**
+ * Write given deferred log entry to all log handlers. The module
+ * mutex must be locked.
+ */
+static void entry_write(struct entry_t *entry_p,
+                        struct time_t *offset_p)
+{
+    struct log_handler_t *handler_p;
     struct time_t now;
+    void *chout_p;
+
+    time_add(&now, &entry_p->uptime, offset_p);
+    handler_p = &module.handler;
+
+    while (handler_p != NULL) {
+        chout_p = handler_p->chout_p;
+
+        if (chout_p != NULL) {
+            chan_control(chout_p, CHAN_CONTROL_LOG_BEGIN);
+            std_fprintf(chout_p,
+                        FSTR("%lu.%03lu:%S:%s:%s: "),
+                        now.seconds,
+                        now.nanoseconds / 1000000ul,
+                        level_as_string[entry_p->level],
+                        entry_p->thrd_name_p,
+                        entry_p->name_p);
+            write_message(chout_p,
+                          entry_p->fmt_p,
+                          (const uint8_t *)&entry_p[1]);
+            chan_control(chout_p, CHAN_CONTROL_LOG_END);
+        }
+
+        handler_p = handler_p->next_p;
+    }
+}
+
+/**
+ * Write a log entry with the number of dropped entries, if any
+ * entries were dropped since the last call. The module mutex must be
+ * locked.
+ */
+static void report_dropped(struct time_t *offset_p)
+{
     struct log_handler_t *handler_p;
+    struct time_t now;
     void *chout_p;
-    int count;
-    const char *name_p;
+    uint32_t dropped;
 
-    /* Level filtering. */
-    if (self_p == NULL) {
-        /* Use the thread log mask if no log object is given. */
-        if ((thrd_get_log_mask() & (1 << level)) == 0) {
-            return (0);
+    dropped = (module.deferred.dropped - module.deferred.reported);
+
+    if (dropped == 0) {
+        return;
+    }
+
+    module.deferred.reported += dropped;
+    sys_uptime(&now);
+    time_add(&now, &now, offset_p);
+    handler_p = &module.handler;
+
+    while (handler_p != NULL) {
+        chout_p = handler_p->chout_p;
+
+        if (chout_p != NULL) {
+            chan_control(chout_p, CHAN_CONTROL_LOG_BEGIN);
+            std_fprintf(chout_p,
+                        FSTR("%lu.%03lu:%S:%s:%s: "
+                             "%lu log entries dropped.\r\n"),
+                        now.seconds,
+                        now.nanoseconds / 1000000ul,
+                        level_as_string[LOG_WARNING],
+                        thrd_get_name(),
+                        module.object.name_p,
+                        (unsigned long)dropped);
+            chan_control(chout_p, CHAN_CONTROL_LOG_END);
         }
 
-        name_p = "default";
+        handler_p = handler_p->next_p;
+    }
+}
+
+#endif
+
+#if CONFIG_LOG_BINARY == 1
+
+/**
+ * Pack given value as a variable length integer, seven bits per byte
+ * with the least significant bits first.
+ */
+static int record_pack_varint(struct record_t *self_p,
+                              unsigned long value)
+{
+    do {
+        if (self_p->pos == sizeof(self_p->buf)) {
+            return (-ENOMEM);
+        }
+
+        self_p->buf[self_p->pos] = (value & 0x7f);
+        value >>= 7;
+
+        if (value != 0) {
+            self_p->buf[self_p->pos] |= 0x80;
+        }
+
+        self_p->pos++;
+    } while (value != 0);
+
+    return (0);
+}
+
+/**
+ * Pack given signed value zigzag encoded, to make small negative
+ * values short as well.
+ */
+static int record_pack_signed(struct record_t *self_p,
+                              long value)
+{
+    return (record_pack_varint(self_p,
+                               (((unsigned long)value << 1)
+                                ^ (unsigned long)(value
+                                                  >> (8 * sizeof(value) - 1)))));
+}
+
+/**
+ * Pack given null terminated string. It is truncated if it does not
+ * fit in the record.
+ */
+static int record_pack_string(struct record_t *self_p,
+                              const char *string_p)
+{
+    if (self_p->pos == sizeof(self_p->buf)) {
+        return (-ENOMEM);
+    }
+
+    while ((*string_p != '\0')
+           && (self_p->pos < sizeof(self_p->buf) - 1)) {
+        self_p->buf[self_p->pos++] = *string_p++;
+    }
+
+    self_p->buf[self_p->pos++] = '\0';
+
+    if (*string_p != '\0') {
+        return (-ENOMEM);
+    }
+
+    return (0);
+}
+
+#if CONFIG_FLOAT == 1
+
+/**
+ * Pack given value as a big endian single precision float.
+ */
+static int record_pack_float(struct record_t *self_p,
+                             float value)
+{
+    uint32_t data;
+
+    if (self_p->pos + sizeof(data) > sizeof(self_p->buf)) {
+        return (-ENOMEM);
+    }
+
+    memcpy(&data, &value, sizeof(data));
+    self_p->buf[self_p->pos++] = (data >> 24);
+    self_p->buf[self_p->pos++] = (data >> 16);
+    self_p->buf[self_p->pos++] = (data >> 8);
+    self_p->buf[self_p->pos++] = data;
+
+    return (0);
+}
+
+#endif
+
+/**
+ * Pack the arguments of given format string, as listed in the SOAM
+ * format string created by simbapp.py.
+ */
+static void record_pack_arguments(struct record_t *self_p,
+                                  far_string_t fmt_p,
+                                  va_list *ap_p)
+{
+    int res;
+    char c;
+    char flags;
+    int width;
+    char length;
+    const char *string_p;
+
+    while ((c = *fmt_p++) != '\0') {
+        if (c != '%') {
+            continue;
+        }
+
+        fmt_p = parse_specifier(fmt_p, &flags, &width, &length, &c);
+
+        switch (c) {
+
+        case 'i':
+        case 'd':
+            if (length == 0) {
+                res = record_pack_signed(self_p, va_arg(*ap_p, int));
+            } else {
+                res = record_pack_signed(self_p, va_arg(*ap_p, long));
+            }
+
+            break;
+
+        case 'u':
+        case 'x':
+        case 'c':
+            if (length == 0) {
+                res = record_pack_varint(self_p,
+                                         va_arg(*ap_p, unsigned int));
+            } else {
+                res = record_pack_varint(self_p,
+                                         va_arg(*ap_p, unsigned long));
+            }
+
+            break;
+
+        case 's':
+            string_p = va_arg(*ap_p, const char *);
+
+            if (string_p == NULL) {
+                string_p = "(null)";
+            }
+
+            res = record_pack_string(self_p, string_p);
+            break;
+
+#if CONFIG_FLOAT == 1
+        case 'f':
+            res = record_pack_float(self_p, va_arg(*ap_p, double));
+            break;
+#endif
+
+        default:
+            res = 0;
+            break;
+        }
+
+        /* The rest of the arguments are dropped if the record is
+           full. */
+        if (res != 0) {
+            break;
+        }
+    }
+}
+
+/**
+ * Format given message into the record. It is truncated if it does
+ * not fit.
+ */
+static void record_pack_message(struct record_t *self_p,
+                                far_string_t fmt_p,
+                                va_list *ap_p)
+{
+    ssize_t size;
+    size_t left;
+
+    left = (sizeof(self_p->buf) - self_p->pos);
+
+    if (left == 0) {
+        return;
+    }
+
+    size = std_vsnprintf((char *)&self_p->buf[self_p->pos],
+                         left,
+                         fmt_p,
+                         ap_p);
+
+    if (size >= left) {
+        size = (left - 1);
+        self_p->buf[self_p->pos + size] = '\0';
+    }
+
+    self_p->pos += (size + 1);
+}
+
+/**
+ * Pack a binary log record. Returns a pointer to the first byte of
+ * the record, and its size in given size pointer.
+ */
+static uint8_t *record_pack(struct record_t *self_p,
+                            int level,
+                            const char *name_p,
+                            struct time_t *now_p,
+                            far_string_t fmt_p,
+                            va_list *ap_p,
+                            size_t *size_p)
+{
+    uint8_t *buf_p;
+    size_t size;
+
+    /* Room for the payload size. */
+    self_p->pos = 2;
+
+    /* Format strings with an identifier assigned by simbapp.py and
+       simbagen.py start with it, and all identifiers are at least
+       0x8000. */
+    if ((*fmt_p & 0x80) != 0) {
+        self_p->buf[self_p->pos++] = *fmt_p++;
+        self_p->buf[self_p->pos++] = *fmt_p++;
     } else {
-        if ((self_p->mask & (1 << level)) == 0) {
-            return (0);
+        self_p->buf[self_p->pos++] = (RECORD_FORMAT_ID_TEXT >> 8);
+        self_p->buf[self_p->pos++] = RECORD_FORMAT_ID_TEXT;
+    }
+
+    self_p->buf[self_p->pos++] = level;
+    (void)record_pack_varint(self_p, now_p->seconds);
+    (void)record_pack_varint(self_p, now_p->nanoseconds / 1000000ul);
+    (void)record_pack_string(self_p, thrd_get_name());
+    (void)record_pack_string(self_p, name_p);
+
+    if (self_p->buf[2] == (RECORD_FORMAT_ID_TEXT >> 8)) {
+        record_pack_message(self_p, fmt_p, ap_p);
+    } else {
+        record_pack_arguments(self_p, fmt_p, ap_p);
+    }
+
+    /* The payload size as a variable length integer, one or two
+       bytes. */
+    size = (self_p->pos - 2);
+
+    if (size < 128) {
+        buf_p = &self_p->buf[1];
+        buf_p[0] = size;
+    } else {
+        buf_p = &self_p->buf[0];
+        buf_p[0] = (0x80 | (size & 0x7f));
+        buf_p[1] = (size >> 7);
+    }
+
+    *size_p = (&self_p->buf[self_p->pos] - buf_p);
+
+    return (buf_p);
+}
+
+/**
+ * Pack given log entry into a binary record and write it to all log
+ * handlers.
+ */
+static int record_write(int level,
+                        const char *name_p,
+                        far_string_t fmt_p,
+                        va_list *ap_p)
+{
+    struct record_t record;
+    struct time_t now;
+    struct log_handler_t *handler_p;
+    void *chout_p;
+    uint8_t *buf_p;
+    size_t size;
+    int count;
+
+    count = 0;
+    handler_p = &module.handler;
+
+    mutex_lock(&module.mutex);
+
+    time_get(&now);
+    buf_p = record_pack(&record, level, name_p, &now, fmt_p, ap_p, &size);
+
+    while (handler_p != NULL) {
+        chout_p = handler_p->chout_p;
+
+        if (chout_p != NULL) {
+            chan_control(chout_p, CHAN_CONTROL_LOG_BINARY_BEGIN);
+            chan_write(chout_p, buf_p, size);
+            chan_control(chout_p, CHAN_CONTROL_LOG_END);
+            count++;
         }
 
-        name_p = self_p->name_p;
+        handler_p = handler_p->next_p;
     }
 
-    /* Print the formatted log entry to all handlers. */
+    mutex_unlock(&module.mutex);
+
+    return (count);
+}
+
+#endif
+
+#if (CONFIG_LOG_DEFERRED == 0) && (CONFIG_LOG_BINARY == 0)
+
+/**
+ * Format given log entry and write it to all log handlers.
+ */
+static int entry_print(int level,
+                       const char *name_p,
+                       far_string_t fmt_p,
+                       va_list *ap_p)
+{
+    va_list ap;
+    struct time_t now;
+    struct log_handler_t *handler_p;
+    void *chout_p;
+    int count;
+
     count = 0;
     handler_p = &module.handler;
 
@@ -418,7 +1344,7 @@ int log_object_print(struct log_object_t *self_p,
                         name_p);
 
             /* Write the custom message. */
-            va_start(ap, fmt_p);
+            va_copy(ap, *ap_p);
             std_vfprintf(chout_p, fmt_p, &ap);
             va_end(ap);
 
@@ -434,3 +1360,151 @@ int log_object_print(struct log_object_t *self_p,
 
     return (count);
 }
+
+#endif
+
+int log_object_print(struct log_object_t *self_p,
+                     int level,
+                     const char *fmt_p,
+                     ...)
+{
+    ASSERTN(fmt_p != NULL, EINVAL);
+
+    va_list ap;
+    int count;
+    const char *name_p;
+
+    /* Level filtering. */
+    if (self_p == NULL) {
+        /* Use the thread log mask if no log object is given. */
+        if ((thrd_get_log_mask() & (1 << level)) == 0) {
+            return (0);
+        }
+
+        name_p = "default";
+    } else {
+        if ((self_p->mask & (1 << level)) == 0) {
+            return (0);
+        }
+
+        name_p = self_p->name_p;
+    }
+
+    va_start(ap, fmt_p);
+#if CONFIG_LOG_DEFERRED == 1
+    count = entry_add(level, name_p, thrd_get_name(), fmt_p, &ap, 0);
+#elif CONFIG_LOG_BINARY == 1
+    count = record_write(level, name_p, fmt_p, &ap);
+#else
+    count = entry_print(level, name_p, fmt_p, &ap);
+#endif
+    va_end(ap);
+
+    return (count);
+}
+
+#if CONFIG_LOG_DEFERRED == 1
+
+int log_object_print_isr(struct log_object_t *self_p,
+                         int level,
+                         const char *fmt_p,
+                         ...)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(fmt_p != NULL, EINVAL);
+
+    va_list ap;
+    int res;
+
+    if ((self_p->mask & (1 << level)) == 0) {
+        return (0);
+    }
+
+    va_start(ap, fmt_p);
+    res = entry_add(level, self_p->name_p, "isr", fmt_p, &ap, 1);
+    va_end(ap);
+
+    return (res);
+}
+
+int log_flush(void)
+{
+    struct entry_t *entry_p;
+    struct time_t now;
+    struct time_t uptime;
+    struct time_t offset;
+
+    mutex_lock(&module.mutex);
+
+    /* Difference between the current time and the uptime, used to
+       convert the uptime in the entries. */
+    time_get(&now);
+    sys_uptime(&uptime);
+    time_subtract(&offset, &now, &uptime);
+
+    while (1) {
+        sys_lock();
+        entry_p = entry_get_isr();
+        sys_unlock();
+
+        if (entry_p == NULL) {
+            break;
+        }
+
+        entry_write(entry_p, &offset);
+
+        sys_lock();
+        entry_free_isr(entry_p);
+        sys_unlock();
+    }
+
+    report_dropped(&offset);
+
+    mutex_unlock(&module.mutex);
+
+    return (0);
+}
+
+uint32_t log_get_dropped_count(void)
+{
+    return (module.deferred.dropped);
+}
+
+void *log_main(void *arg_p)
+{
+    thrd_set_name("log");
+
+    while (1) {
+        sem_take(&module.deferred.sem, NULL);
+        log_flush();
+    }
+
+    return (NULL);
+}
+
+#else
+
+int log_object_print_isr(struct log_object_t *self_p,
+                         int level,
+                         const char *fmt_p,
+                         ...)
+{
+    return (-ENOSYS);
+}
+
+int log_flush(void)
+{
+    return (0);
+}
+
+uint32_t log_get_dropped_count(void)
+{
+    return (0);
+}
+
+void *log_main(void *arg_p)
+{
+    return (NULL);
+}
+
+#endif
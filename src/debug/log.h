@@ -130,6 +130,14 @@ int log_object_is_enabled_for(struct log_object_t *self_p,
  * Check if given log level is set in the log object mask. If so,
  * format a log entry and write it to all log handlers.
  *
+ * If ``CONFIG_LOG_DEFERRED`` is set the log entry is instead added
+ * to a buffer and written later by the log thread. ``%s`` arguments
+ * are copied, truncated to ``CONFIG_LOG_DEFERRED_STRING_MAX``
+ * characters.
+ *
+ * If ``CONFIG_LOG_BINARY`` is set the log entry is instead written as
+ * a binary record, which is decoded on the host.
+ *
  * ``self_p`` may be NULL, and in that case the current thread's log
  * mask is used instead of the log object mask.
  *
@@ -138,13 +146,59 @@ int log_object_is_enabled_for(struct log_object_t *self_p,
  * @param[in] fmt_p Log format string.
  * @param[in] ... Variable argument list.
  *
- * @return zero(0) or negative error code.
+ * @return Number of log handlers written to, or true(1) if the log
+ *         entry was deferred. Otherwise negative error code.
  */
 int log_object_print(struct log_object_t *self_p,
                      int level,
                      const char *fmt_p,
                      ...);
 
+/**
+ * Same as `log_object_print()`, but may be called from interrupt
+ * context. Only available if ``CONFIG_LOG_DEFERRED`` is set.
+ *
+ * @param[in] self_p Log object.
+ * @param[in] level Log level.
+ * @param[in] fmt_p Log format string.
+ * @param[in] ... Variable argument list.
+ *
+ * @return true(1) if the log entry was added, false(0) if the level
+ *         is disabled, otherwise negative error code.
+ */
+int log_object_print_isr(struct log_object_t *self_p,
+                         int level,
+                         const char *fmt_p,
+                         ...);
+
+/**
+ * Format and write all deferred log entries to the log handlers, in
+ * the calling thread. Call it before a reset to not lose any log
+ * entries.
+ *
+ * @return zero(0) or negative error code.
+ */
+int log_flush(void);
+
+/**
+ * Get the number of log entries dropped because the deferred log
+ * entries buffer was full.
+ *
+ * @return Number of dropped log entries.
+ */
+uint32_t log_get_dropped_count(void);
+
+/**
+ * The deferred log thread, formatting and writing deferred log
+ * entries to the log handlers. Started by `sys_start()` if
+ * ``CONFIG_LOG_DEFERRED`` is set.
+ *
+ * @param[in] arg_p Not used.
+ *
+ * @return Never returns.
+ */
+void *log_main(void *arg_p);
+
 /**
  * Initialize given log handler with given output channel.
  *
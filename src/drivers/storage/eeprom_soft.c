@@ -33,212 +33,398 @@
 #if CONFIG_EEPROM_SOFT == 1
 
 /**
- * Valid pattern in the header.
+ * Valid pattern in the block header.
  */
-#define VALID_PATTERN                                  0xa5c3
+#define VALID_PATTERN                                  0xa5c4
 
-#define CHUNK_HEADER_SIZE        sizeof(struct chunk_header_t)
+#define BLOCK_HEADER_SIZE        sizeof(struct block_header_t)
+#define RECORD_HEADER_SIZE      sizeof(struct record_header_t)
+#define LINE_SIZE                 CONFIG_EEPROM_SOFT_LINE_SIZE
 
-struct chunk_header_t {
+/* Records are padded to a multiple of eight bytes, and the padding
+   is written from the record data buffer. */
+#if (LINE_SIZE % 8) != 0
+#    error "The software EEPROM line size must be a multiple of 8."
+#endif
+
+#if CONFIG_EEPROM_SOFT_CRC == CONFIG_EEPROM_SOFT_CRC_32
+#    define CRC_INIT                                          0
+#elif CONFIG_EEPROM_SOFT_CRC == CONFIG_EEPROM_SOFT_CRC_CCITT
+#    define CRC_INIT                                     0xffff
+#endif
+
+/**
+ * The first eight bytes of a block. The header is written after all
+ * records have been copied to the block, so a block with a valid
+ * header is complete.
+ */
+struct block_header_t {
     uint32_t crc;
     uint16_t revision;
     uint16_t valid;
 } PACKED;
 
 /**
- * Calculate the crc of the chunk at given address.
+ * Records are appended to the current block after its header. A
+ * record contains the data of one line, padded to a multiple of
+ * eight bytes.
  */
-static uint32_t calculate_chunk_crc(struct eeprom_soft_driver_t *self_p,
-                                    uint32_t *crc_p,
-                                    uintptr_t address)
+struct record_header_t {
+    uint16_t address;
+    uint16_t size;
+    uint32_t crc;
+} PACKED;
+
+struct record_t {
+    struct record_header_t header;
+    uint8_t data[LINE_SIZE];
+} PACKED;
+
+static uint32_t calculate_crc(uint32_t crc,
+                              const void *buf_p,
+                              size_t size)
 {
-    ssize_t size;
-    uint8_t buf[8];
-    size_t offset;
 #if CONFIG_EEPROM_SOFT_CRC == CONFIG_EEPROM_SOFT_CRC_32
-    uint32_t crc = 0;
+    return (crc_32(crc, buf_p, size));
 #elif CONFIG_EEPROM_SOFT_CRC == CONFIG_EEPROM_SOFT_CRC_CCITT
-    uint16_t crc = 0xffff;
+    return (crc_ccitt(crc, buf_p, size));
 #endif
+}
 
-    offset = CHUNK_HEADER_SIZE;
-
-    while (offset < self_p->chunk_size) {
-        size = flash_read(self_p->flash_p,
-                          &buf[0],
-                          address + offset,
-                          sizeof(buf));
+/**
+ * The crc of a block header covers the revision and the valid
+ * pattern.
+ */
+static uint32_t calculate_block_crc(struct block_header_t *header_p)
+{
+    return (calculate_crc(CRC_INIT,
+                          &header_p->revision,
+                          sizeof(*header_p) - sizeof(header_p->crc)));
+}
 
-        if (size != sizeof(buf)) {
-            return (-1);
-        }
+/**
+ * The crc of a record covers the address, the size and the data.
+ */
+static uint32_t calculate_record_crc(struct record_t *record_p)
+{
+    uint32_t crc;
 
-#if CONFIG_EEPROM_SOFT_CRC == CONFIG_EEPROM_SOFT_CRC_32
-        crc = crc_32(crc, &buf[0], sizeof(buf));
-#elif CONFIG_EEPROM_SOFT_CRC == CONFIG_EEPROM_SOFT_CRC_CCITT
-        crc = crc_ccitt(crc, &buf[0], sizeof(buf));
-#endif
+    crc = calculate_crc(CRC_INIT,
+                        &record_p->header,
+                        (sizeof(record_p->header.address)
+                         + sizeof(record_p->header.size)));
 
-        offset += sizeof(buf);
+    return (calculate_crc(crc,
+                          &record_p->data[0],
+                          record_p->header.size));
+}
 
-#if CONFIG_PREEMPTIVE_SCHEDULER == 0
-        thrd_yield();
-#endif
+/**
+ * Check if a revision is later than another.
+ */
+static int is_later_revision(uint16_t revision_1, uint16_t revision_2)
+{
+    if (revision_1 > revision_2) {
+        return ((revision_1 - revision_2) < 0x8000);
+    } else {
+        return (!((revision_2 - revision_1) < 0x8000));
     }
+}
 
-    *crc_p = crc;
+/**
+ * Size in bytes of given line. The last line may be shorter than the
+ * others.
+ */
+static size_t line_size(struct eeprom_soft_driver_t *self_p,
+                        size_t line)
+{
+    return (MIN(LINE_SIZE, self_p->eeprom_size - line * LINE_SIZE));
+}
 
-    return (0);
+/**
+ * Size in bytes of the record of given line on flash.
+ */
+static size_t record_size(struct eeprom_soft_driver_t *self_p,
+                          size_t line)
+{
+    return (RECORD_HEADER_SIZE + ((line_size(self_p, line) + 7) & ~7));
 }
 
 /**
- * Check if chunk at given address is valid.
+ * Read and validate the block header at given address.
  */
-static int is_valid_chunk(struct eeprom_soft_driver_t *self_p,
-                          uintptr_t address)
+static int read_block_header(struct eeprom_soft_driver_t *self_p,
+                             uintptr_t address,
+                             struct block_header_t *header_p)
 {
-    struct chunk_header_t header;
-    ssize_t res;
-    uint32_t crc;
+    ssize_t size;
 
-    res = flash_read(self_p->flash_p,
-                     &header,
-                     address,
-                     sizeof(header));
+    size = flash_read(self_p->flash_p,
+                      header_p,
+                      address,
+                      sizeof(*header_p));
 
-    if (res != sizeof(header)) {
-        return (0);
+    if (size != sizeof(*header_p)) {
+        return (-1);
     }
 
     /* Check the valid flag. */
-    if (header.valid != VALID_PATTERN) {
-        return (0);
+    if (header_p->valid != VALID_PATTERN) {
+        return (-1);
     }
 
     /* Check the CRC. */
-    if (calculate_chunk_crc(self_p, &crc, address) != 0) {
+    if (calculate_block_crc(header_p) != header_p->crc) {
         return (-1);
     }
 
-    if (crc != header.crc) {
-        return (0);
+    return (0);
+}
+
+/**
+ * Write the header of given block.
+ */
+static int write_block_header(struct eeprom_soft_driver_t *self_p,
+                              uintptr_t address,
+                              uint16_t revision)
+{
+    ssize_t size;
+    struct block_header_t header;
+
+    header.revision = revision;
+    header.valid = VALID_PATTERN;
+    header.crc = calculate_block_crc(&header);
+
+    size = flash_write(self_p->flash_p,
+                       address,
+                       &header,
+                       sizeof(header));
+
+    if (size != sizeof(header)) {
+        return (-1);
     }
 
-    return (1);
+    return (0);
 }
 
 /**
- * Check if a revision is later than another.
+ * Read the record at given offset in the current block. Returns the
+ * line number of the record, or negative error code if the record is
+ * blank or corrupt.
  */
-static int is_later_revision(uint16_t revision_1, uint16_t revision_2)
+static int read_record(struct eeprom_soft_driver_t *self_p,
+                       size_t offset,
+                       struct record_t *record_p)
 {
-    if (revision_1 > revision_2) {
-        return ((revision_1 - revision_2) < 0x8000);
-    } else {
-        return (!((revision_2 - revision_1) < 0x8000));
+    ssize_t size;
+    uintptr_t address;
+    size_t line;
+
+    address = (self_p->current.block_p->address + offset);
+    size = flash_read(self_p->flash_p,
+                      &record_p->header,
+                      address,
+                      RECORD_HEADER_SIZE);
+
+    if (size != RECORD_HEADER_SIZE) {
+        return (-EIO);
     }
+
+    /* End of the log. */
+    if ((record_p->header.address == 0xffff)
+        && (record_p->header.size == 0xffff)
+        && (record_p->header.crc == 0xffffffff)) {
+        return (-ENOENT);
+    }
+
+    /* The record must contain exactly one line. */
+    if ((record_p->header.address % LINE_SIZE) != 0) {
+        return (-EPROTO);
+    }
+
+    line = (record_p->header.address / LINE_SIZE);
+
+    if (line >= self_p->number_of_lines) {
+        return (-EPROTO);
+    }
+
+    if (record_p->header.size != line_size(self_p, line)) {
+        return (-EPROTO);
+    }
+
+    if (offset + record_size(self_p, line)
+        > self_p->current.block_p->size) {
+        return (-EPROTO);
+    }
+
+    size = flash_read(self_p->flash_p,
+                      &record_p->data[0],
+                      address + RECORD_HEADER_SIZE,
+                      record_p->header.size);
+
+    if (size != record_p->header.size) {
+        return (-EIO);
+    }
+
+    if (calculate_record_crc(record_p) != record_p->header.crc) {
+        return (-EPROTO);
+    }
+
+    return (line);
 }
 
 /**
- * Check if given chunk is blank.
+ * Read given line into given buffer. Lines that have never been
+ * written are blank.
  */
-static int is_blank_chunk(struct eeprom_soft_driver_t *self_p,
-                          uintptr_t address)
+static int read_line(struct eeprom_soft_driver_t *self_p,
+                     size_t line,
+                     uint8_t *buf_p)
 {
     ssize_t size;
-    int i;
-    uint8_t byte;
+    uintptr_t address;
 
-    for (i = 0; i < self_p->chunk_size; i++) {
-        size = flash_read(self_p->flash_p,
-                          &byte,
-                          address + i,
-                          sizeof(byte));
+    size = line_size(self_p, line);
 
-        if (size != sizeof(byte)) {
-            return (-1);
-        }
+    if (self_p->index[line] == 0) {
+        memset(buf_p, 0xff, size);
+    } else {
+        address = (self_p->current.block_p->address
+                   + self_p->index[line]
+                   + RECORD_HEADER_SIZE);
 
-        if (byte != 0xff) {
-            return (0);
+        if (flash_read(self_p->flash_p, buf_p, address, size) != size) {
+            return (-1);
         }
-
-#if CONFIG_PREEMPTIVE_SCHEDULER == 0
-        thrd_yield();
-#endif
     }
 
-    return (1);
+    return (0);
 }
 
 /**
- * Get a black chunk.
+ * Copy the latest record of each line to the next block, and make it
+ * the current block. The index is only updated once the copy is
+ * complete, so it is still valid if the compaction fails.
  */
-static int get_blank_chunk(struct eeprom_soft_driver_t *self_p,
-                           const struct eeprom_soft_block_t **block_pp,
-                           uintptr_t *chunk_address_p)
+static int compact(struct eeprom_soft_driver_t *self_p)
 {
-    int res;
     const struct eeprom_soft_block_t *block_p;
-    uintptr_t chunk_address;
+    struct record_t record;
+    size_t line;
+    size_t offset;
+    size_t size;
+    uint16_t revision;
 
-    res = -1;
+    block_p = (self_p->current.block_p + 1);
 
-    /* First check if the next chunk in current block is blank. */
-    block_p = self_p->current.block_p;
-    chunk_address = self_p->current.chunk_address;
-    chunk_address += self_p->chunk_size;
+    if (block_p == &self_p->blocks_p[self_p->number_of_blocks]) {
+        block_p = &self_p->blocks_p[0];
+    }
 
-    if ((chunk_address < (block_p->address + block_p->size))
-        && (is_blank_chunk(self_p, chunk_address) == 1)) {
-        res = 0;
-    } else {
-        block_p++;
+    if (flash_erase(self_p->flash_p, block_p->address, block_p->size) != 0) {
+        return (-1);
+    }
+
+    offset = BLOCK_HEADER_SIZE;
 
-        if (block_p == &self_p->blocks_p[self_p->number_of_blocks]) {
-            block_p = &self_p->blocks_p[0];
+    for (line = 0; line < self_p->number_of_lines; line++) {
+        if (self_p->index[line] == 0) {
+            continue;
         }
 
-        if (flash_erase(self_p->flash_p,
-                        block_p->address,
-                        block_p->size) == 0) {
-            chunk_address = block_p->address;
-            res = 0;
+        /* Records do not depend on their position, so they are
+           copied as is. */
+        size = record_size(self_p, line);
+
+        if (flash_read(self_p->flash_p,
+                       &record,
+                       (self_p->current.block_p->address
+                        + self_p->index[line]),
+                       size) != size) {
+            return (-1);
+        }
+
+        if (flash_write(self_p->flash_p,
+                        block_p->address + offset,
+                        &record,
+                        size) != size) {
+            return (-1);
         }
+
+        offset += size;
+
+#if CONFIG_PREEMPTIVE_SCHEDULER == 0
+        thrd_yield();
+#endif
+    }
+
+    revision = (self_p->current.revision + 1);
+
+    if (write_block_header(self_p, block_p->address, revision) != 0) {
+        return (-1);
     }
 
-    *block_pp = block_p;
-    *chunk_address_p = chunk_address;
+    /* Update the index with the new record offsets. */
+    offset = BLOCK_HEADER_SIZE;
 
-    return (res);
+    for (line = 0; line < self_p->number_of_lines; line++) {
+        if (self_p->index[line] != 0) {
+            self_p->index[line] = offset;
+            offset += record_size(self_p, line);
+        }
+    }
+
+    self_p->current.block_p = block_p;
+    self_p->current.offset = offset;
+    self_p->current.revision = revision;
+    self_p->current.dirty = 0;
+
+    return (0);
 }
 
 /**
- * Write the header to flash for given chunk.
+ * Append a record with given line data to the current block. The
+ * block is compacted first if the record does not fit.
  */
-static int write_header(struct eeprom_soft_driver_t *self_p,
-                        uintptr_t chunk_address,
-                        uint16_t revision)
+static int append_record(struct eeprom_soft_driver_t *self_p,
+                         size_t line,
+                         struct record_t *record_p)
 {
-    ssize_t size;
-    struct chunk_header_t header;
+    size_t size;
 
-    if (calculate_chunk_crc(self_p, &header.crc, chunk_address) != 0) {
-        return (-1);
+    size = record_size(self_p, line);
+
+    if ((self_p->current.dirty == 1)
+        || (self_p->current.offset + size > self_p->current.block_p->size)) {
+        if (compact(self_p) != 0) {
+            return (-1);
+        }
+
+        if (self_p->current.offset + size > self_p->current.block_p->size) {
+            return (-ENOSPC);
+        }
     }
 
-    header.revision = revision;
-    header.valid = VALID_PATTERN;
+    record_p->header.address = (line * LINE_SIZE);
+    record_p->header.size = line_size(self_p, line);
+    memset(&record_p->data[record_p->header.size],
+           0xff,
+           size - RECORD_HEADER_SIZE - record_p->header.size);
+    record_p->header.crc = calculate_record_crc(record_p);
 
-    size = flash_write(self_p->flash_p,
-                       chunk_address,
-                       &header,
-                       sizeof(header));
+    if (flash_write(self_p->flash_p,
+                    self_p->current.block_p->address + self_p->current.offset,
+                    record_p,
+                    size) != size) {
+        /* The position of the next record is unknown. */
+        self_p->current.dirty = 1;
 
-    if (size != sizeof(header)) {
         return (-1);
     }
 
+    self_p->index[line] = self_p->current.offset;
+    self_p->current.offset += size;
+
     return (0);
 }
 
@@ -247,14 +433,13 @@ static ssize_t write_inner(struct eeprom_soft_driver_t *self_p,
                            const void *src_p,
                            size_t size)
 {
-    const struct eeprom_soft_block_t *block_p;
-    uint8_t buf[8];
-    uintptr_t chunk_address;
-    uint16_t revision;
-    uintptr_t offset;
+    struct record_t record;
     const uint8_t *u8_src_p;
-    int overwrite_index;
-    size_t overwrite_size;
+    size_t line;
+    size_t offset;
+    size_t left;
+    size_t line_left;
+    int res;
 
     if (dst >= self_p->eeprom_size) {
         return (-EINVAL);
@@ -264,66 +449,34 @@ static ssize_t write_inner(struct eeprom_soft_driver_t *self_p,
         return (-EINVAL);
     }
 
-    if (get_blank_chunk(self_p, &block_p, &chunk_address) != 0) {
-        return (-1);
-    }
-
-    /* Write to new chunk. */
     u8_src_p = src_p;
+    left = size;
 
-    for (offset = 0; offset < self_p->eeprom_size; offset += sizeof(buf)) {
-        /* Read from old chunk. */
-        if (flash_read(self_p->flash_p,
-                       &buf[0],
-                       self_p->current.chunk_address + CHUNK_HEADER_SIZE + offset,
-                       sizeof(buf)) != sizeof(buf)) {
+    /* Append one record per modified line. */
+    while (left > 0) {
+        line = (dst / LINE_SIZE);
+        offset = (dst % LINE_SIZE);
+        line_left = MIN(left, line_size(self_p, line) - offset);
+
+        if (read_line(self_p, line, &record.data[0]) != 0) {
             return (-1);
         }
 
-        /* Overwrite given data region. */
-        if ((dst < offset + sizeof(buf)) && (dst + size > offset)) {
-            if (dst <= offset) {
-                overwrite_index = 0;
-            } else {
-                overwrite_index = (dst - offset);
-            }
+        /* Unchanged lines are not written. */
+        if (memcmp(&record.data[offset], u8_src_p, line_left) != 0) {
+            memcpy(&record.data[offset], u8_src_p, line_left);
+            res = append_record(self_p, line, &record);
 
-            if (dst + size >= offset + sizeof(buf)) {
-                overwrite_size = sizeof(buf);
-            } else {
-                overwrite_size = (dst + size - offset);
+            if (res != 0) {
+                return (res);
             }
-
-            overwrite_size -= overwrite_index;
-
-            memcpy(&buf[overwrite_index], u8_src_p, overwrite_size);
-            u8_src_p += overwrite_size;
-        }
-
-        /* Write to new chunk. */
-        if (flash_write(self_p->flash_p,
-                        chunk_address + CHUNK_HEADER_SIZE + offset,
-                        &buf[0],
-                        sizeof(buf)) != sizeof(buf)) {
-            return (-1);
         }
 
-#if CONFIG_PREEMPTIVE_SCHEDULER == 0
-        thrd_yield();
-#endif
-    }
-
-    revision = (self_p->current.revision + 1);
-
-    if (write_header(self_p, chunk_address, revision) != 0) {
-        return (-1);
+        dst += line_left;
+        u8_src_p += line_left;
+        left -= line_left;
     }
 
-    /* Update the object with new chunk information. */
-    self_p->current.block_p = block_p;
-    self_p->current.chunk_address = chunk_address;
-    self_p->current.revision = revision;
-
     return (size);
 }
 
@@ -342,14 +495,34 @@ int eeprom_soft_init(struct eeprom_soft_driver_t *self_p,
     ASSERTN(flash_p != NULL, EINVAL);
     ASSERTN(blocks_p != NULL, EINVAL);
     ASSERTN(number_of_blocks >= 2, EINVAL);
+    ASSERTN(chunk_size > BLOCK_HEADER_SIZE, EINVAL);
+
+    int i;
+    size_t size;
 
     self_p->flash_p = flash_p;
     self_p->blocks_p = blocks_p;
     self_p->number_of_blocks = number_of_blocks;
     self_p->chunk_size = chunk_size;
-    self_p->eeprom_size = (chunk_size - CHUNK_HEADER_SIZE);
+    self_p->eeprom_size = (chunk_size - BLOCK_HEADER_SIZE);
+    self_p->number_of_lines = DIV_CEIL(self_p->eeprom_size, LINE_SIZE);
     self_p->current.block_p = NULL;
-    self_p->current.chunk_address = 0xffffffff;
+    self_p->current.offset = 0;
+
+    if (self_p->number_of_lines > CONFIG_EEPROM_SOFT_LINES_MAX) {
+        return (-EINVAL);
+    }
+
+    /* All lines and one more record must fit in each block, and
+       record offsets must fit in the index. */
+    size = (BLOCK_HEADER_SIZE
+            + (self_p->number_of_lines + 1) * record_size(self_p, 0));
+
+    for (i = 0; i < number_of_blocks; i++) {
+        if ((blocks_p[i].size < size) || (blocks_p[i].size > 65536)) {
+            return (-EINVAL);
+        }
+    }
 
 #if CONFIG_EEPROM_SOFT_SEMAPHORE == 1
     sem_init(&self_p->sem, 0, 1);
@@ -372,73 +545,77 @@ int eeprom_soft_format(struct eeprom_soft_driver_t *self_p)
         }
     }
 
-    return (write_header(self_p, self_p->blocks_p[0].address, 0));
+    return (write_block_header(self_p, self_p->blocks_p[0].address, 0));
 }
 
 int eeprom_soft_mount(struct eeprom_soft_driver_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    int res;
     int i;
-    int j;
-    uintptr_t chunk_address;
+    int line;
     const struct eeprom_soft_block_t *block_p;
-    int number_of_chunks;
-    struct chunk_header_t header;
-    ssize_t size;
+    struct block_header_t header;
+    struct record_t record;
+    size_t offset;
     uint16_t latest_revision;
     const struct eeprom_soft_block_t *latest_block_p;
-    uintptr_t latest_chunk_address;
 
-    res = -1;
     latest_block_p = NULL;
 
-    /* Find the most recently written chunk, as given by the
-       revision. */
+    /* Find the most recently compacted block, as given by the
+       revision. Only the block headers are read. */
     for (i = 0; i < self_p->number_of_blocks; i++) {
         block_p = &self_p->blocks_p[i];
-        number_of_chunks = (block_p->size / self_p->chunk_size);
 
-        for (j = 0; j < number_of_chunks; j++) {
-            chunk_address = (block_p->address + j * self_p->chunk_size);
+        if (read_block_header(self_p, block_p->address, &header) != 0) {
+            continue;
+        }
 
-            /* Read the header. */
-            size = flash_read(self_p->flash_p,
-                              &header,
-                              chunk_address,
-                              sizeof(header));
+        if ((latest_block_p == NULL)
+            || (is_later_revision(header.revision, latest_revision) == 1)) {
+            latest_revision = header.revision;
+            latest_block_p = block_p;
+        }
+    }
 
-            if (size != sizeof(header)) {
-                continue;
-            }
+    if (latest_block_p == NULL) {
+        return (-1);
+    }
 
-            /* Check the valid flag. */
-            if (header.valid != VALID_PATTERN) {
-                continue;
-            }
+    self_p->current.block_p = latest_block_p;
+    self_p->current.revision = latest_revision;
+    self_p->current.dirty = 0;
+    memset(&self_p->index[0], 0, sizeof(self_p->index));
+
+    /* Replay the records in the block to build the index. */
+    offset = BLOCK_HEADER_SIZE;
+
+    while (offset + RECORD_HEADER_SIZE <= latest_block_p->size) {
+        line = read_record(self_p, offset, &record);
 
-            /* Keep track of the latest revision chunk. */
-            if ((latest_block_p == NULL)
-                || (is_later_revision(header.revision, latest_revision) == 1)) {
-                latest_revision = header.revision;
-                latest_block_p = block_p;
-                latest_chunk_address = chunk_address;
+        if (line < 0) {
+            /* A write was interrupted if the record is corrupt. The
+               block is compacted before the next write, as the rest
+               of it may not be blank. */
+            if (line != -ENOENT) {
+                self_p->current.dirty = 1;
             }
-        }
-    }
 
-    /* Make sure the chunk is valid. */
-    if (latest_block_p != NULL) {
-        if (is_valid_chunk(self_p, latest_chunk_address) == 1) {
-            self_p->current.block_p = latest_block_p;
-            self_p->current.chunk_address = latest_chunk_address;
-            self_p->current.revision = latest_revision;
-            res = 0;
+            break;
         }
+
+        self_p->index[line] = offset;
+        offset += record_size(self_p, line);
+
+#if CONFIG_PREEMPTIVE_SCHEDULER == 0
+        thrd_yield();
+#endif
     }
 
-    return (res);
+    self_p->current.offset = offset;
+
+    return (0);
 }
 
 ssize_t eeprom_soft_read(struct eeprom_soft_driver_t *self_p,
@@ -450,6 +627,12 @@ ssize_t eeprom_soft_read(struct eeprom_soft_driver_t *self_p,
     ASSERTN(dst_p != NULL, EINVAL);
 
     ssize_t res;
+    uint8_t buf[LINE_SIZE];
+    uint8_t *u8_dst_p;
+    size_t line;
+    size_t offset;
+    size_t left;
+    size_t line_left;
 
     if (src >= self_p->eeprom_size) {
         return (-EINVAL);
@@ -463,8 +646,25 @@ ssize_t eeprom_soft_read(struct eeprom_soft_driver_t *self_p,
     sem_take(&self_p->sem, NULL);
 #endif
 
-    src += (self_p->current.chunk_address + CHUNK_HEADER_SIZE);
-    res = flash_read(self_p->flash_p, dst_p, src, size);
+    res = size;
+    u8_dst_p = dst_p;
+    left = size;
+
+    while (left > 0) {
+        line = (src / LINE_SIZE);
+        offset = (src % LINE_SIZE);
+        line_left = MIN(left, line_size(self_p, line) - offset);
+
+        if (read_line(self_p, line, &buf[0]) != 0) {
+            res = -1;
+            break;
+        }
+
+        memcpy(u8_dst_p, &buf[offset], line_left);
+        src += line_left;
+        u8_dst_p += line_left;
+        left -= line_left;
+    }
 
 #if CONFIG_EEPROM_SOFT_SEMAPHORE == 1
     sem_give(&self_p->sem, 1);
@@ -472,7 +672,6 @@ ssize_t eeprom_soft_read(struct eeprom_soft_driver_t *self_p,
 
     return (res);
 }
-
 ssize_t eeprom_soft_write(struct eeprom_soft_driver_t *self_p,
                           uintptr_t dst,
                           const void *src_p,
@@ -44,11 +44,16 @@ struct eeprom_soft_driver_t {
     int number_of_blocks;
     size_t chunk_size;
     size_t eeprom_size;
+    size_t number_of_lines;
     struct {
         const struct eeprom_soft_block_t *block_p;
-        uintptr_t chunk_address;
+        size_t offset;
         uint16_t revision;
+        int dirty;
     } current;
+    /* Offset of the latest record of each line in the current block,
+       or zero(0) if the line has never been written. */
+    uint16_t index[CONFIG_EEPROM_SOFT_LINES_MAX];
 #if CONFIG_EEPROM_SOFT_SEMAPHORE == 1
     struct sem_t sem;
 #endif
@@ -73,9 +78,11 @@ int eeprom_soft_module_init(void);
  * @param[in] blocks_p Flash memory blocks to use.
  * @param[in] number_of_blocks Number of blocks.
  * @param[in] chunk_size Chunk size in bytes. This is the size of the
- *                       EEPROM. Eight bytes of the chunk will be used
- *                       to store metadata, so only `chunk_size - 8`
- *                       bytes are available to the user.
+ *                       EEPROM plus eight bytes, so only
+ *                       `chunk_size - 8` bytes are available to the
+ *                       user. Each block must fit all lines of the
+ *                       EEPROM as records, plus an eight bytes
+ *                       header.
  *
  * @return zero(0) or negative error code.
  */
@@ -596,4 +596,199 @@ ssize_t sd_write_block(struct sd_driver_t *self_p,
     return (res);
 }
 
+ssize_t sd_read_blocks(struct sd_driver_t *self_p,
+                       void *dst_p,
+                       uint32_t src_block,
+                       size_t count)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(dst_p != NULL, EINVAL);
+
+    ssize_t res;
+    size_t i;
+    uint8_t *u8dst_p;
+    uint16_t real_crc, expected_crc;
+    uint8_t response;
+
+    if (count == 0) {
+        return (0);
+    }
+
+    if (self_p->type != TYPE_SDHC) {
+        src_block <<= 9;
+    }
+
+    u8dst_p = dst_p;
+    res = (count * SD_BLOCK_SIZE);
+
+    spi_take_bus(self_p->spi_p);
+    spi_select(self_p->spi_p);
+
+    /* Issue read multiple block command. */
+    if (command_check_call(self_p,
+                           CMD_READ_MULTIPLE_BLOCK,
+                           src_block,
+                           0) != 0) {
+        res = -SD_ERR_READ_COMMAND;
+        goto out;
+    }
+
+    for (i = 0; i < count; i++) {
+        /* Receive the data block start token. */
+        if (wait_for_data_start_block(self_p) != 0) {
+            res = -SD_ERR_READ_DATA_START_BLOCK;
+            break;
+        }
+
+        /* Receive the data and it's checksum. */
+        spi_read(self_p->spi_p, u8dst_p, SD_BLOCK_SIZE);
+        spi_read(self_p->spi_p, &expected_crc, sizeof(expected_crc));
+
+        /* Calculate the checksum of the received data. */
+        real_crc = crc_xmodem(0, u8dst_p, SD_BLOCK_SIZE);
+        expected_crc = ntohs(expected_crc);
+
+        if (real_crc != expected_crc) {
+            res = -SD_ERR_READ_WRONG_DATA_CRC;
+            break;
+        }
+
+        u8dst_p += SD_BLOCK_SIZE;
+    }
+
+    /* Stop the transmission. The byte following the command is a
+       stuff byte. */
+    if (command_write(self_p, CMD_STOP_TRANSMISSION, 0) != 0) {
+        res = -SD_ERR_STOP_TRANSMISSION;
+        goto out;
+    }
+
+    spi_get(self_p->spi_p, &response);
+
+    for (i = 0; i < RESPONSE_RETRIES; i++) {
+        if (spi_get(self_p->spi_p, &response) != 1) {
+            res = -SD_ERR_STOP_TRANSMISSION;
+            goto out;
+        }
+
+        if ((response & R1_RESERVED) == 0) {
+            break;
+        }
+    }
+
+    if ((i == RESPONSE_RETRIES) || (response != 0)) {
+        res = -SD_ERR_STOP_TRANSMISSION;
+        goto out;
+    }
+
+    if (wait_not_busy(self_p, WRITE_TIMEOUT) != 0) {
+        res = -SD_ERR_STOP_TRANSMISSION;
+    }
+
+ out:
+    spi_deselect(self_p->spi_p);
+    spi_give_bus(self_p->spi_p);
+
+    return (res);
+}
+
+ssize_t sd_write_blocks(struct sd_driver_t *self_p,
+                        uint32_t dst_block,
+                        const void *src_p,
+                        size_t count)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(src_p != NULL, EINVAL);
+
+    ssize_t res;
+    size_t i;
+    const uint8_t *u8src_p;
+    uint16_t crc;
+    uint8_t response;
+
+    if (count == 0) {
+        return (0);
+    }
+
+    /* Check for byte address adjustment. */
+    if (self_p->type != TYPE_SDHC) {
+        dst_block <<= 9;
+    }
+
+    u8src_p = src_p;
+    res = (count * SD_BLOCK_SIZE);
+
+    spi_take_bus(self_p->spi_p);
+    spi_select(self_p->spi_p);
+
+    /* Issue write multiple block command. */
+    if (command_check_call(self_p,
+                           CMD_WRITE_MULTIPLE_BLOCK,
+                           dst_block,
+                           0) != 0) {
+        res = -SD_ERR_WRITE_BLOCK;
+        goto out;
+    }
+
+    for (i = 0; i < count; i++) {
+        crc = crc_xmodem(0, u8src_p, SD_BLOCK_SIZE);
+        crc = htons(crc);
+
+        /* Write the start token. */
+        spi_put(self_p->spi_p, TOKEN_WRITE_MULTIPLE_TOKEN);
+
+        /* Write the data and it's checksum. */
+        spi_write(self_p->spi_p, u8src_p, SD_BLOCK_SIZE);
+        spi_write(self_p->spi_p, &crc, sizeof(crc));
+
+        /* Wait for the data-response token. */
+        spi_get(self_p->spi_p, &response);
+
+        if ((response & TOKEN_DATA_RES_MASK) != TOKEN_DATA_RES_ACCEPTED) {
+            res = -SD_ERR_WRITE_BLOCK_TOKEN_DATA_RES_ACCEPTED;
+            break;
+        }
+
+        /* Wait for the block to be programmed. */
+        if (wait_not_busy(self_p, WRITE_TIMEOUT) != 0) {
+            res = -SD_ERR_WRITE_BLOCK_WAIT_NOT_BUSY;
+            goto out;
+        }
+
+        u8src_p += SD_BLOCK_SIZE;
+    }
+
+    /* Stop the transmission. */
+    spi_put(self_p->spi_p, TOKEN_STOP_TRAN_TOKEN);
+
+    /* Skip one byte before the card signals busy. */
+    spi_get(self_p->spi_p, &response);
+
+    if (wait_not_busy(self_p, WRITE_TIMEOUT) != 0) {
+        res = -SD_ERR_WRITE_BLOCK_WAIT_NOT_BUSY;
+        goto out;
+    }
+
+    if (res < 0) {
+        goto out;
+    }
+
+    if (command_check_call(self_p, CMD_SEND_STATUS, 0, 0) != 0) {
+        res = -SD_ERR_WRITE_BLOCK_SEND_STATUS;
+        goto out;
+    }
+
+    spi_get(self_p->spi_p, &response);
+
+    if (response != 0) {
+        res = -SD_ERR_WRITE_BLOCK_SEND_STATUS;
+    }
+
+ out:
+    spi_deselect(self_p->spi_p);
+    spi_give_bus(self_p->spi_p);
+
+    return (res);
+}
+
 #endif
@@ -48,6 +48,7 @@
 #define SD_ERR_WRITE_BLOCK_TOKEN_DATA_RES_ACCEPTED   5012
 #define SD_ERR_WRITE_BLOCK_WAIT_NOT_BUSY             5013
 #define SD_ERR_WRITE_BLOCK_SEND_STATUS               5014
+#define SD_ERR_STOP_TRANSMISSION                     5015
 
 #define SD_BLOCK_SIZE 512
 
@@ -274,4 +275,40 @@ ssize_t sd_write_block(struct sd_driver_t *self_p,
                        uint32_t dst_block,
                        const void *src_p);
 
+/**
+ * Read given number of consecutive blocks from the SD card using a
+ * single multiple block read command (CMD18). The data is read
+ * directly into given buffer.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[out] dst_p Buffer to read into. Must be at least `count *
+ *                   SD_BLOCK_SIZE` bytes.
+ * @param[in] src_block First block to read from.
+ * @param[in] count Number of blocks to read.
+ *
+ * @return Number of read bytes or negative error code.
+ */
+ssize_t sd_read_blocks(struct sd_driver_t *self_p,
+                       void *dst_p,
+                       uint32_t src_block,
+                       size_t count);
+
+/**
+ * Write given number of consecutive blocks to the SD card using a
+ * single multiple block write command (CMD25). The data is written
+ * directly from given buffer.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] dst_block First block to write to.
+ * @param[in] src_p Buffer to write. Must be at least `count *
+ *                  SD_BLOCK_SIZE` bytes.
+ * @param[in] count Number of blocks to write.
+ *
+ * @return Number of written bytes or negative error code.
+ */
+ssize_t sd_write_blocks(struct sd_driver_t *self_p,
+                        uint32_t dst_block,
+                        const void *src_p,
+                        size_t count);
+
 #endif
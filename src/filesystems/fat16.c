@@ -35,6 +35,13 @@
 #define CACHE_FOR_READ  0    /* cache a block for read. */
 #define CACHE_FOR_WRITE 1    /* cache a block and set dirty. */
 
+#define CACHE_TYPE_DATA 0    /* file data block. */
+#define CACHE_TYPE_FAT  1    /* FAT block. */
+#define CACHE_TYPE_DIR  2    /* directory block. */
+
+/* Block number of an unused cache block. */
+#define CACHE_BLOCK_NONE 0xffffffff
+
 /* FAT16 end of chain value used by Microsoft. */
 #define EOC16 0xffff
 
@@ -201,33 +208,181 @@ static int make_name_from_83(char *dst_p, const char *dname_p)
     return (0);
 }
 
-static int cache_flush(struct fat16_t *self_p)
+static void cache_init(struct fat16_t *self_p)
 {
-    struct fat16_cache_t *cache_p = &self_p->cache;
+    struct fat16_cache_block_t *block_p;
+    int i;
+
+    for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+        block_p = &self_p->cache.blocks[i];
+        block_p->block_number = CACHE_BLOCK_NONE;
+        block_p->dirty = 0;
+        block_p->type = CACHE_TYPE_DATA;
+        block_p->mirror_block = 0;
+        block_p->last_used = 0;
+    }
+
+    self_p->cache.counter = 0;
+}
 
-    if (cache_p->dirty) {
+/**
+ * Write given cache block to the storage device if dirty.
+ */
+static int cache_write_back(struct fat16_t *self_p,
+                            struct fat16_cache_block_t *block_p)
+{
+    if (block_p->dirty) {
         if (self_p->write(self_p->arg_p,
-                          cache_p->block_number,
-                          cache_p->buffer.data) != BLOCK_SIZE) {
+                          block_p->block_number,
+                          block_p->buffer.data) != BLOCK_SIZE) {
             return (-1);
         }
 
-        if (cache_p->mirror_block) {
+        if (block_p->mirror_block) {
             if (self_p->write(self_p->arg_p,
-                              cache_p->mirror_block,
-                              cache_p->buffer.data) != BLOCK_SIZE) {
+                              block_p->mirror_block,
+                              block_p->buffer.data) != BLOCK_SIZE) {
                 return (-1);
             }
 
-            cache_p->mirror_block = 0;
+            block_p->mirror_block = 0;
         }
 
-        cache_p->dirty = 0;
+        block_p->dirty = 0;
     }
 
     return (0);
 }
 
+/**
+ * Write all dirty blocks to the storage device, in increasing block
+ * number order.
+ */
+static int cache_flush(struct fat16_t *self_p)
+{
+    struct fat16_cache_block_t *block_p;
+    struct fat16_cache_block_t *next_p;
+    int i;
+
+    while (1) {
+        next_p = NULL;
+
+        for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+            block_p = &self_p->cache.blocks[i];
+
+            if (block_p->dirty) {
+                if ((next_p == NULL)
+                    || (block_p->block_number < next_p->block_number)) {
+                    next_p = block_p;
+                }
+            }
+        }
+
+        if (next_p == NULL) {
+            return (0);
+        }
+
+        if (cache_write_back(self_p, next_p) != 0) {
+            return (-1);
+        }
+    }
+}
+
+static struct fat16_cache_block_t *cache_lookup(struct fat16_t *self_p,
+                                                uint32_t block_number)
+{
+    int i;
+
+    for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+        if (self_p->cache.blocks[i].block_number == block_number) {
+            return (&self_p->cache.blocks[i]);
+        }
+    }
+
+    return (NULL);
+}
+
+/**
+ * Find the cache block to replace. An unused block is replaced
+ * first, otherwise the least recently used block. The most recently
+ * used FAT block and directory block are pinned, and only replaced
+ * if all other blocks are pinned as well.
+ */
+static struct fat16_cache_block_t *cache_victim(struct fat16_t *self_p)
+{
+    struct fat16_cache_block_t *block_p;
+    struct fat16_cache_block_t *pinned[3];
+    struct fat16_cache_block_t *victim_p;
+    uint32_t age;
+    uint32_t victim_age;
+    uint32_t pinned_age[3];
+    int i;
+
+    pinned[CACHE_TYPE_DATA] = NULL;
+    pinned[CACHE_TYPE_FAT] = NULL;
+    pinned[CACHE_TYPE_DIR] = NULL;
+
+    for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+        block_p = &self_p->cache.blocks[i];
+
+        if (block_p->block_number == CACHE_BLOCK_NONE) {
+            return (block_p);
+        }
+
+        age = (self_p->cache.counter - block_p->last_used);
+
+        if ((pinned[block_p->type] == NULL)
+            || (age < pinned_age[block_p->type])) {
+            pinned[block_p->type] = block_p;
+            pinned_age[block_p->type] = age;
+        }
+    }
+
+    victim_p = NULL;
+    victim_age = 0;
+
+    for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+        block_p = &self_p->cache.blocks[i];
+
+        if ((block_p == pinned[CACHE_TYPE_FAT])
+            || (block_p == pinned[CACHE_TYPE_DIR])) {
+            continue;
+        }
+
+        age = (self_p->cache.counter - block_p->last_used);
+
+        if ((victim_p == NULL) || (age > victim_age)) {
+            victim_p = block_p;
+            victim_age = age;
+        }
+    }
+
+    if (victim_p == NULL) {
+        for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+            block_p = &self_p->cache.blocks[i];
+            age = (self_p->cache.counter - block_p->last_used);
+
+            if ((victim_p == NULL) || (age > victim_age)) {
+                victim_p = block_p;
+                victim_age = age;
+            }
+        }
+    }
+
+    return (victim_p);
+}
+
+static void cache_touch(struct fat16_t *self_p,
+                        struct fat16_cache_block_t *block_p,
+                        uint8_t action,
+                        uint8_t type)
+{
+    block_p->dirty |= action;
+    block_p->type = type;
+    self_p->cache.counter++;
+    block_p->last_used = self_p->cache.counter;
+}
+
 static inline uint8_t block_of_cluster(uint8_t blocks_per_cluster,
                                        uint32_t position)
 {
@@ -239,9 +394,9 @@ static inline uint16_t cache_data_offset(uint32_t position)
     return (position & 0x1ff);
 }
 
-static inline void cache_set_dirty(struct fat16_cache_t *cache_p)
+static inline void cache_set_dirty(struct fat16_cache_block_t *block_p)
 {
-    cache_p->dirty |= CACHE_FOR_WRITE;
+    block_p->dirty |= CACHE_FOR_WRITE;
 }
 
 static inline uint32_t data_block_lba(struct fat16_file_t *file_p,
@@ -253,50 +408,166 @@ static inline uint32_t data_block_lba(struct fat16_file_t *file_p,
             block_of_cluster);
 }
 
-static int cache_raw_block(struct fat16_t *self_p,
-                           uint32_t block_number,
-                           uint8_t action)
+/**
+ * Get given block from the cache, reading it from the storage device
+ * if not already cached.
+ */
+static struct fat16_cache_block_t *cache_raw_block(struct fat16_t *self_p,
+                                                   uint32_t block_number,
+                                                   uint8_t action,
+                                                   uint8_t type)
 {
-    struct fat16_cache_t *cache_p = &self_p->cache;
+    struct fat16_cache_block_t *block_p;
 
-    if (cache_p->block_number != block_number) {
-        if (cache_flush(self_p) != 0) {
-            return (-1);
+    block_p = cache_lookup(self_p, block_number);
+
+    if (block_p == NULL) {
+        block_p = cache_victim(self_p);
+
+        if (cache_write_back(self_p, block_p) != 0) {
+            return (NULL);
         }
 
+        block_p->block_number = CACHE_BLOCK_NONE;
+
         if (self_p->read(self_p->arg_p,
-                         cache_p->buffer.data,
+                         block_p->buffer.data,
                          block_number) != BLOCK_SIZE) {
-            return (-1);
+            return (NULL);
         }
 
-        cache_p->block_number = block_number;
+        block_p->block_number = block_number;
     }
 
-    cache_p->dirty |= action;
+    cache_touch(self_p, block_p, action, type);
+
+    return (block_p);
+}
+
+/**
+ * Get a zeroed cache block for given block without reading it from
+ * the storage device.
+ */
+static struct fat16_cache_block_t *cache_new_block(struct fat16_t *self_p,
+                                                   uint32_t block_number)
+{
+    struct fat16_cache_block_t *block_p;
+
+    block_p = cache_lookup(self_p, block_number);
+
+    if (block_p == NULL) {
+        block_p = cache_victim(self_p);
+
+        if (cache_write_back(self_p, block_p) != 0) {
+            return (NULL);
+        }
+
+        block_p->block_number = block_number;
+    }
+
+    memset(&block_p->buffer, 0, sizeof(block_p->buffer));
+    cache_touch(self_p, block_p, CACHE_FOR_WRITE, CACHE_TYPE_DATA);
+
+    return (block_p);
+}
+
+/**
+ * Write dirty cached blocks in given block range to the storage
+ * device before the range is read without the cache.
+ */
+static int cache_write_back_range(struct fat16_t *self_p,
+                                  uint32_t block_number,
+                                  uint32_t count)
+{
+    struct fat16_cache_block_t *block_p;
+    int i;
+
+    for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+        block_p = &self_p->cache.blocks[i];
+
+        if ((block_p->block_number != CACHE_BLOCK_NONE)
+            && (block_p->block_number - block_number < count)) {
+            if (cache_write_back(self_p, block_p) != 0) {
+                return (-1);
+            }
+        }
+    }
 
     return (0);
 }
 
+/**
+ * Drop cached blocks in given block range before the range is
+ * written without the cache.
+ */
+static void cache_discard_range(struct fat16_t *self_p,
+                                uint32_t block_number,
+                                uint32_t count)
+{
+    struct fat16_cache_block_t *block_p;
+    int i;
+
+    for (i = 0; i < CONFIG_FAT16_CACHE_BLOCKS; i++) {
+        block_p = &self_p->cache.blocks[i];
+
+        if ((block_p->block_number != CACHE_BLOCK_NONE)
+            && (block_p->block_number - block_number < count)) {
+            block_p->block_number = CACHE_BLOCK_NONE;
+            block_p->dirty = 0;
+            block_p->mirror_block = 0;
+        }
+    }
+}
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+
+/**
+ * Check if given cluster is in the free cluster bitmap. The bitmap
+ * covers the first clusters of volumes too big for it.
+ */
+static int bitmap_covers(struct fat16_t *self_p, fat_t cluster)
+{
+    return ((self_p->free_clusters.valid == 1)
+            && ((uint32_t)cluster - 2
+                < 8 * sizeof(self_p->free_clusters.used)));
+}
+
+static void bitmap_set_used(struct fat16_t *self_p,
+                            fat_t cluster,
+                            int used)
+{
+    fat_t index;
+
+    index = (cluster - 2);
+
+    if (used) {
+        self_p->free_clusters.used[index >> 3] |= (1 << (index & 7));
+    } else {
+        self_p->free_clusters.used[index >> 3] &= ~(1 << (index & 7));
+    }
+}
+
+#endif
+
 static int fat_get(struct fat16_t *self_p,
                    fat_t cluster,
                    fat_t* value)
 {
     uint32_t lba;
+    struct fat16_cache_block_t *block_p;
 
     if (cluster > (self_p->cluster_count + 1)) {
         return (-1);
     }
 
     lba = self_p->fat_start_block + (cluster >> 8);
+    block_p = cache_raw_block(self_p, lba, CACHE_FOR_READ, CACHE_TYPE_FAT);
 
-    if (lba != self_p->cache.block_number) {
-        if (cache_raw_block(self_p, lba, CACHE_FOR_READ)) {
-            return (-1);
-        }
+    if (block_p == NULL) {
+        return (-1);
     }
 
-    *value = self_p->cache.buffer.fat[cluster & 0xff];
+    *value = block_p->buffer.fat[cluster & 0xff];
 
     return (0);
 }
@@ -304,6 +575,7 @@ static int fat_get(struct fat16_t *self_p,
 static int fat_put(struct fat16_t *self_p, fat_t cluster, fat_t value)
 {
     uint32_t lba;
+    struct fat16_cache_block_t *block_p;
 
     if (cluster < 2) {
         return (-1);
@@ -314,33 +586,217 @@ static int fat_put(struct fat16_t *self_p, fat_t cluster, fat_t value)
     }
 
     lba = self_p->fat_start_block + (cluster >> 8);
+    block_p = cache_raw_block(self_p, lba, CACHE_FOR_READ, CACHE_TYPE_FAT);
 
-    if (lba != self_p->cache.block_number) {
-        if (cache_raw_block(self_p, lba, CACHE_FOR_READ) != 0) {
-            return (-1);
-        }
+    if (block_p == NULL) {
+        return (-1);
     }
 
-    self_p->cache.buffer.fat[cluster & 0xff] = value;
-    cache_set_dirty(&self_p->cache);
+    block_p->buffer.fat[cluster & 0xff] = value;
+    cache_set_dirty(block_p);
 
     if (self_p->fat_count > 1) {
-        self_p->cache.mirror_block = (lba + self_p->blocks_per_fat);
+        block_p->mirror_block = (lba + self_p->blocks_per_fat);
+    }
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+    if (bitmap_covers(self_p, cluster)) {
+        bitmap_set_used(self_p, cluster, value != 0);
+    }
+#endif
+
+    return (0);
+}
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+
+/**
+ * Build the free cluster bitmap from the FAT. Only the first clusters
+ * are in the bitmap if the volume has too many clusters.
+ */
+static int bitmap_build(struct fat16_t *self_p)
+{
+    uint32_t cluster;
+    uint32_t count;
+    fat_t value;
+
+    self_p->free_clusters.valid = 0;
+    count = MIN(self_p->cluster_count,
+                8 * sizeof(self_p->free_clusters.used));
+
+    /* Bits after the last cluster are marked as used. */
+    memset(&self_p->free_clusters.used[0],
+           0xff,
+           sizeof(self_p->free_clusters.used));
+
+    for (cluster = 2; cluster < count + 2; cluster++) {
+        if (fat_get(self_p, cluster, &value) != 0) {
+            return (-1);
+        }
+
+        if (value == 0) {
+            bitmap_set_used(self_p, cluster, 0);
+        }
     }
 
+    self_p->free_clusters.valid = 1;
+
     return (0);
 }
 
+#endif
+
+/**
+ * Check if given cluster is free.
+ *
+ * @return true(1) if the cluster is free, false(0) if it is used,
+ *         otherwise negative error code.
+ */
+static int is_cluster_free(struct fat16_t *self_p, fat_t cluster)
+{
+    fat_t value;
+    fat_t index;
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+    if (bitmap_covers(self_p, cluster)) {
+        index = (cluster - 2);
+
+        return ((self_p->free_clusters.used[index >> 3]
+                 & (1 << (index & 7))) == 0);
+    }
+#else
+    (void)index;
+#endif
+
+    if (fat_get(self_p, cluster, &value) != 0) {
+        return (-1);
+    }
+
+    return (value == 0);
+}
+
+/**
+ * Find a free cluster, starting the search after given cluster.
+ */
+static int find_free_cluster(struct fat16_t *self_p,
+                             fat_t cluster,
+                             fat_t *free_cluster_p)
+{
+    uint32_t i;
+    int res;
+
+    /* Start search at cluster two in FAT if no cluster is given. */
+    if (cluster == 0) {
+        cluster = 1;
+    }
+
+    for (i = 0; i < self_p->cluster_count; i++) {
+        /* Fat has cluster_count + 2 entries. */
+        if (cluster > self_p->cluster_count) {
+            cluster = 1;
+        }
+
+        cluster++;
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+        /* Skip eight used clusters at a time. */
+        if (bitmap_covers(self_p, cluster + 7)
+            && (((cluster - 2) & 7) == 0)
+            && (self_p->free_clusters.used[(cluster - 2) >> 3] == 0xff)
+            && ((uint32_t)cluster + 7 <= self_p->cluster_count + 1)) {
+            cluster += 7;
+            i += 7;
+            continue;
+        }
+#endif
+
+        res = is_cluster_free(self_p, cluster);
+
+        if (res < 0) {
+            return (-1);
+        }
+
+        if (res == 1) {
+            *free_cluster_p = cluster;
+
+            return (0);
+        }
+    }
+
+    return (-1);
+}
+
+/**
+ * Find given number of contiguous free clusters, starting the search
+ * after given cluster.
+ */
+static int find_free_extent(struct fat16_t *self_p,
+                            fat_t cluster,
+                            uint32_t count,
+                            fat_t *start_p)
+{
+    uint32_t i;
+    uint32_t length;
+    int res;
+
+    if (count > self_p->cluster_count) {
+        return (-1);
+    }
+
+    if (cluster == 0) {
+        cluster = 1;
+    }
+
+    length = 0;
+
+    /* An extent may span the cluster the search started at. */
+    for (i = 0; i < self_p->cluster_count + count; i++) {
+        /* An extent can not wrap around the end of the FAT. */
+        if (cluster > self_p->cluster_count) {
+            cluster = 1;
+            length = 0;
+        }
+
+        cluster++;
+        res = is_cluster_free(self_p, cluster);
+
+        if (res < 0) {
+            return (-1);
+        }
+
+        if (res == 1) {
+            length++;
+
+            if (length == count) {
+                *start_p = (cluster - count + 1);
+
+                return (0);
+            }
+        } else {
+            length = 0;
+        }
+    }
+
+    return (-1);
+}
+
 static struct dir_t* cache_dir_entry(struct fat16_t *self_p,
                                      uint16_t block,
                                      uint16_t index,
                                      uint8_t action)
 {
-    if (cache_raw_block(self_p, block + (index >> 4), action) != 0) {
+    struct fat16_cache_block_t *block_p;
+
+    block_p = cache_raw_block(self_p,
+                              block + (index >> 4),
+                              action,
+                              CACHE_TYPE_DIR);
+
+    if (block_p == NULL) {
         return (NULL);
     }
 
-    return (&self_p->cache.buffer.dir[index & 0xf]);
+    return (&block_p->buffer.dir[index & 0xf]);
 }
 
 static int free_chain(struct fat16_t *self_p, fat_t cluster)
@@ -371,13 +827,17 @@ static int write_volume_block(struct fat16_t *self_p,
                               uint32_t volume_start_block,
                               struct fbs_t *fbs_p)
 {
+    struct fat16_cache_block_t *block_p;
+
     /* Cache volume start block. */
-    if (cache_raw_block(self_p, volume_start_block, CACHE_FOR_WRITE) != 0) {
+    block_p = cache_new_block(self_p, volume_start_block);
+
+    if (block_p == NULL) {
         return (-1);
     }
 
     /* Write the boot sector to the start block. */
-    self_p->cache.buffer.fbs = *fbs_p;
+    block_p->buffer.fbs = *fbs_p;
 
     return (cache_flush(self_p));
 }
@@ -387,19 +847,19 @@ static int format_fat_blocks(struct fat16_t *self_p,
                              uint32_t fat_end_block)
 {
     uint32_t block;
+    struct fat16_cache_block_t *block_p;
 
     for (block = fat_start_block; block < fat_end_block; block++) {
-        /* Cache the next block within the fat. */
-        if (cache_raw_block(self_p, block, CACHE_FOR_WRITE) != 0) {
-            return (-1);
+        /* Cache and format the next block within the fat. */
+        block_p = cache_new_block(self_p, block);
 
+        if (block_p == NULL) {
+            return (-1);
         }
-        /* Format the block. */
-        memset(&self_p->cache.buffer, 0, sizeof(self_p->cache.buffer));
 
         if (block == fat_start_block) {
-            self_p->cache.buffer.fat[0] = 0xfff8;
-            self_p->cache.buffer.fat[1] = 0xffff;
+            block_p->buffer.fat[0] = 0xfff8;
+            block_p->buffer.fat[1] = 0xffff;
         }
 
         if (cache_flush(self_p) != 0) {
@@ -417,14 +877,11 @@ static int format_root_dir_blocks(struct fat16_t *self_p,
     uint32_t block;
 
     for (block = root_dir_start_block; block < root_dir_end_block; block++) {
-        /* Cache the next block within the root directory. */
-        if (cache_raw_block(self_p, block, CACHE_FOR_WRITE) != 0) {
+        /* Cache and clear the next block within the root directory. */
+        if (cache_new_block(self_p, block) == NULL) {
             return (-1);
         }
 
-        /* Clear the block. */
-        memset(&self_p->cache.buffer, 0, sizeof(self_p->cache.buffer));
-
         /* The flush function writes to the mirrored fat block as well. */
         if (cache_flush(self_p) != 0) {
             return (-1);
@@ -452,49 +909,70 @@ int fat16_init(struct fat16_t *self_p,
     /* Initialize datastructure.*/
     self_p->read = read;
     self_p->write = write;
+    self_p->read_blocks = NULL;
+    self_p->write_blocks = NULL;
     self_p->arg_p = arg_p;
     self_p->partition = partition;
 
     return (0);
 }
 
+int fat16_set_multi_block_callbacks(struct fat16_t *self_p,
+                                    fat16_read_blocks_t read_blocks,
+                                    fat16_write_blocks_t write_blocks)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    self_p->read_blocks = read_blocks;
+    self_p->write_blocks = write_blocks;
+
+    return (0);
+}
+
 int fat16_mount(struct fat16_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
     uint32_t total_blocks;
     struct bpb_t* bpb_p;
+    struct fat16_cache_block_t *block_p;
 
     /* Initialize the cache. */
-    self_p->cache.block_number = 0xffffffff;
-    self_p->cache.dirty = 0;
-    self_p->cache.mirror_block = 0;
+    cache_init(self_p);
     self_p->volume_start_block = 0;
 
     /* If part == 0 assume super floppy with FAT16 boot sector in
        block zero. */
     /* If part > 0 assume mbr volume with partition table. */
     if (self_p->partition > 0) {
-        if (cache_raw_block(self_p,
-                            self_p->volume_start_block,
-                            CACHE_FOR_READ) != 0) {
+        block_p = cache_raw_block(self_p,
+                                  self_p->volume_start_block,
+                                  CACHE_FOR_READ,
+                                  CACHE_TYPE_DATA);
+
+        if (block_p == NULL) {
             return (-1);
         }
 
         self_p->volume_start_block =
-            self_p->cache.buffer.mbr.part[self_p->partition - 1].first_sector;
+            block_p->buffer.mbr.part[self_p->partition - 1].first_sector;
     }
 
-    if (cache_raw_block(self_p, self_p->volume_start_block, CACHE_FOR_READ) != 0) {
+    block_p = cache_raw_block(self_p,
+                              self_p->volume_start_block,
+                              CACHE_FOR_READ,
+                              CACHE_TYPE_DATA);
+
+    if (block_p == NULL) {
         return (-1);
     }
 
     /* Check boot block signature. */
-    if (self_p->cache.buffer.fbs.boot_sector_sig != BOOTSIG) {
+    if (block_p->buffer.fbs.boot_sector_sig != BOOTSIG) {
         return (-1);
     }
 
-    bpb_p = &self_p->cache.buffer.fbs.bpb;
+    bpb_p = &block_p->buffer.fbs.bpb;
     self_p->fat_count = bpb_p->fat_count;
     self_p->blocks_per_cluster = bpb_p->sectors_per_cluster;
     self_p->blocks_per_fat = bpb_p->sectors_per_fat;
@@ -530,6 +1008,12 @@ int fat16_mount(struct fat16_t *self_p)
         return (-1);
     }
 
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+    if (bitmap_build(self_p) != 0) {
+        return (-1);
+    }
+#endif
+
     return (0);
 }
 
@@ -552,9 +1036,12 @@ int fat16_format(struct fat16_t *self_p)
     uint32_t root_dir_block_count;
 
     /* Initialize the cache. */
-    self_p->cache.block_number = 0xffffffff;
-    self_p->cache.dirty = 0;
-    self_p->cache.mirror_block = 0;
+    cache_init(self_p);
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+    /* The bitmap is built when mounted. */
+    self_p->free_clusters.valid = 0;
+#endif
 
     volume_start_block = 0;
 
@@ -652,32 +1139,13 @@ int fat16_print(struct fat16_t *self_p, void *chan_p)
 
 static int add_cluster(struct fat16_file_t *file_p)
 {
-    /* Start search after last cluster of file or at cluster two in FAT. */
-    fat_t free_cluster = file_p->cur_cluster ? file_p->cur_cluster : 1;
-    fat_t value;
-    fat_t i;
-    fat_t cluster_count = file_p->fat16_p->cluster_count;
-
-    for (i = 0; ; i++) {
-        /* Return no free clusters. */
-        if (i >= cluster_count) {
-            return (-1);
-        }
-
-        /* Fat has cluster_count + 2 entries. */
-        if (free_cluster > cluster_count) {
-            free_cluster = 1;
-        }
-
-        free_cluster++;
-
-        if (fat_get(file_p->fat16_p, free_cluster, &value) != 0) {
-            return (-1);
-        }
+    fat_t free_cluster;
 
-        if (value == 0) {
-            break;
-        }
+    /* Start search after last cluster of file or at cluster two in FAT. */
+    if (find_free_cluster(file_p->fat16_p,
+                          file_p->cur_cluster,
+                          &free_cluster) != 0) {
+        return (-1);
     }
 
     /* Mark cluster allocated. */
@@ -1032,19 +1500,21 @@ static int dir_open(struct fat16_t *self_p,
     return (0);
 }
 
-static int get_block(struct fat16_file_t *file_p,
-                     uint16_t *block_offset_p)
+/**
+ * Move to the next cluster, allocating it if needed, if the current
+ * position is at the start of a cluster.
+ */
+static int get_cluster(struct fat16_file_t *file_p)
 {
     uint8_t blk_of_cluster;
+    uint16_t block_offset;
     fat_t next;
-    uint32_t lba;
 
     blk_of_cluster = block_of_cluster(file_p->fat16_p->blocks_per_cluster,
                                       file_p->cur_position);
+    block_offset = cache_data_offset(file_p->cur_position);
 
-    *block_offset_p = cache_data_offset(file_p->cur_position);
-
-    if ((blk_of_cluster == 0) && (*block_offset_p == 0)) {
+    if ((blk_of_cluster == 0) && (block_offset == 0)) {
         /* Start of new cluster. */
         if (file_p->cur_cluster == 0) {
             if (file_p->first_cluster == 0) {
@@ -1071,29 +1541,175 @@ static int get_block(struct fat16_file_t *file_p,
         }
     }
 
+    return (0);
+}
+
+static int get_block(struct fat16_file_t *file_p,
+                     uint16_t *block_offset_p,
+                     struct fat16_cache_block_t **block_pp)
+{
+    uint8_t blk_of_cluster;
+    uint32_t lba;
+
+    if (get_cluster(file_p) != 0) {
+        return (FAT16_EOF);
+    }
+
+    blk_of_cluster = block_of_cluster(file_p->fat16_p->blocks_per_cluster,
+                                      file_p->cur_position);
+    *block_offset_p = cache_data_offset(file_p->cur_position);
     lba = data_block_lba(file_p, blk_of_cluster);
 
     if ((*block_offset_p == 0) && (file_p->cur_position >= file_p->file_size)) {
         /* Start of new block don't need to read into cache. */
-        if (cache_flush(file_p->fat16_p) != 0) {
-            return (FAT16_EOF);
-        }
-
-        file_p->fat16_p->cache.block_number = lba;
-        memset(&file_p->fat16_p->cache.buffer,
-               0,
-               sizeof(file_p->fat16_p->cache.buffer));
-        cache_set_dirty(&file_p->fat16_p->cache);
+        *block_pp = cache_new_block(file_p->fat16_p, lba);
     } else {
         /* Rewrite part of block. */
-        if (cache_raw_block(file_p->fat16_p, lba, CACHE_FOR_WRITE) != 0) {
-            return (FAT16_EOF);
-        }
+        *block_pp = cache_raw_block(file_p->fat16_p,
+                                    lba,
+                                    CACHE_FOR_WRITE,
+                                    CACHE_TYPE_DATA);
+    }
+
+    if (*block_pp == NULL) {
+        return (FAT16_EOF);
     }
 
     return (0);
 }
 
+/**
+ * Read whole blocks from the current block aligned position directly
+ * into given buffer, bypassing the cache. The transfer spans all
+ * blocks up to given size in the contiguous cluster run starting at
+ * the current cluster.
+ *
+ * @return Number of read bytes or negative error code.
+ */
+static ssize_t file_read_blocks(struct fat16_file_t *file_p,
+                                void *dst_p,
+                                size_t size)
+{
+    struct fat16_t *self_p;
+    uint8_t blk_of_cluster;
+    uint32_t lba;
+    uint32_t count;
+    uint32_t count_max;
+    fat_t next;
+
+    self_p = file_p->fat16_p;
+    blk_of_cluster = block_of_cluster(self_p->blocks_per_cluster,
+                                      file_p->cur_position);
+    lba = data_block_lba(file_p, blk_of_cluster);
+    count_max = (size / BLOCK_SIZE);
+    count = MIN(self_p->blocks_per_cluster - blk_of_cluster, count_max);
+
+    /* Extend the transfer into following clusters as long as they
+       are contiguous. */
+    while (count < count_max) {
+        if (fat_get(self_p, file_p->cur_cluster, &next) != 0) {
+            return (-1);
+        }
+
+        if (next != file_p->cur_cluster + 1) {
+            break;
+        }
+
+        file_p->cur_cluster = next;
+        count += MIN(self_p->blocks_per_cluster, count_max - count);
+    }
+
+    if (cache_write_back_range(self_p, lba, count) != 0) {
+        return (-1);
+    }
+
+    if (self_p->read_blocks(self_p->arg_p,
+                            dst_p,
+                            lba,
+                            count) != count * BLOCK_SIZE) {
+        return (-1);
+    }
+
+    return (count * BLOCK_SIZE);
+}
+
+/**
+ * Write whole blocks from the current block aligned position directly
+ * from given buffer, bypassing the cache. Free clusters directly
+ * following the end of the cluster chain are appended to the file
+ * to keep the cluster run contiguous.
+ *
+ * @return Number of written bytes or negative error code.
+ */
+static ssize_t file_write_blocks(struct fat16_file_t *file_p,
+                                 const void *src_p,
+                                 size_t size)
+{
+    struct fat16_t *self_p;
+    uint8_t blk_of_cluster;
+    uint32_t lba;
+    uint32_t count;
+    uint32_t count_max;
+    fat_t next;
+    int res;
+
+    if (get_cluster(file_p) != 0) {
+        return (-1);
+    }
+
+    self_p = file_p->fat16_p;
+    blk_of_cluster = block_of_cluster(self_p->blocks_per_cluster,
+                                      file_p->cur_position);
+    lba = data_block_lba(file_p, blk_of_cluster);
+    count_max = (size / BLOCK_SIZE);
+    count = MIN(self_p->blocks_per_cluster - blk_of_cluster, count_max);
+
+    /* Extend the transfer into following clusters as long as they
+       are contiguous. */
+    while (count < count_max) {
+        if (fat_get(self_p, file_p->cur_cluster, &next) != 0) {
+            return (-1);
+        }
+
+        if (is_end_of_cluster(next)) {
+            if (file_p->cur_cluster > self_p->cluster_count) {
+                break;
+            }
+
+            res = is_cluster_free(self_p, file_p->cur_cluster + 1);
+
+            if (res < 0) {
+                return (-1);
+            } else if (res == 0) {
+                break;
+            }
+
+            /* The search starts after the current cluster and will
+               find the next cluster. */
+            if (add_cluster(file_p) != 0) {
+                return (-1);
+            }
+        } else if (next == file_p->cur_cluster + 1) {
+            file_p->cur_cluster = next;
+        } else {
+            break;
+        }
+
+        count += MIN(self_p->blocks_per_cluster, count_max - count);
+    }
+
+    cache_discard_range(self_p, lba, count);
+
+    if (self_p->write_blocks(self_p->arg_p,
+                             lba,
+                             src_p,
+                             count) != count * BLOCK_SIZE) {
+        return (-1);
+    }
+
+    return (count * BLOCK_SIZE);
+}
+
 static int file_open(struct fat16_t *self_p,
                      struct fat16_file_t *file_p,
                      const char* path_p,
@@ -1184,6 +1800,8 @@ ssize_t fat16_file_read(struct fat16_file_t *file_p,
     uint16_t block_offset;
     uint8_t *src_p, *dst_p;
     size_t n;
+    ssize_t res;
+    struct fat16_cache_block_t *block_p;
 
     /* Error if not open for read. */
     if (!(file_p->flags & O_READ)) {
@@ -1220,15 +1838,34 @@ ssize_t fat16_file_read(struct fat16_file_t *file_p,
             }
         }
 
+        /* Read whole blocks without the cache. */
+        if ((block_offset == 0)
+            && (left >= BLOCK_SIZE)
+            && (file_p->fat16_p->read_blocks != NULL)) {
+            res = file_read_blocks(file_p, dst_p, left);
+
+            if (res < 0) {
+                return (FAT16_EOF);
+            }
+
+            file_p->cur_position += res;
+            dst_p += res;
+            left -= res;
+            continue;
+        }
+
         /* Cache data block. */
-        if (cache_raw_block(file_p->fat16_p,
-                            data_block_lba(file_p, blk_of_cluster),
-                            CACHE_FOR_READ) != 0) {
+        block_p = cache_raw_block(file_p->fat16_p,
+                                  data_block_lba(file_p, blk_of_cluster),
+                                  CACHE_FOR_READ,
+                                  CACHE_TYPE_DATA);
+
+        if (block_p == NULL) {
             return (FAT16_EOF);
         }
 
         /* Location of data in cache. */
-        src_p = file_p->fat16_p->cache.buffer.data + block_offset;
+        src_p = block_p->buffer.data + block_offset;
 
         /* Max number of byte available in block. */
         n = 512 - block_offset;
@@ -1261,6 +1898,8 @@ ssize_t fat16_file_write(struct fat16_file_t *file_p,
     uint8_t* dst_p;
     size_t n;
     const char *csrc_p;
+    ssize_t res;
+    struct fat16_cache_block_t *block_p;
 
     csrc_p = src_p;
 
@@ -1278,11 +1917,27 @@ ssize_t fat16_file_write(struct fat16_file_t *file_p,
     }
 
     while (left > 0) {
-        if (get_block(file_p, &block_offset) != 0) {
+        /* Write whole blocks without the cache. */
+        if ((cache_data_offset(file_p->cur_position) == 0)
+            && (left >= BLOCK_SIZE)
+            && (file_p->fat16_p->write_blocks != NULL)) {
+            res = file_write_blocks(file_p, csrc_p, left);
+
+            if (res < 0) {
+                return (FAT16_EOF);
+            }
+
+            file_p->cur_position += res;
+            left -= res;
+            csrc_p += res;
+            continue;
+        }
+
+        if (get_block(file_p, &block_offset, &block_p) != 0) {
             return (FAT16_EOF);
         }
 
-        dst_p = file_p->fat16_p->cache.buffer.data + block_offset;
+        dst_p = block_p->buffer.data + block_offset;
 
         /* Max space in block. */
         n = 512 - block_offset;
@@ -1413,8 +2068,9 @@ int fat16_file_truncate(struct fat16_file_t *file_p,
         return (0);
     }
 
-    /* Filesize and size are zero - nothing to do. */
-    if (file_p->file_size == 0) {
+    /* Filesize and size are zero and no clusters are reserved -
+       nothing to do. */
+    if ((file_p->file_size == 0) && (file_p->first_cluster == 0)) {
         return (0);
     }
 
@@ -1440,11 +2096,11 @@ int fat16_file_truncate(struct fat16_file_t *file_p,
 
         if (!is_end_of_cluster(to_free)) {
             /* Free extra clusters. */
-            if (!fat_put(file_p->fat16_p, file_p->cur_cluster, EOC16)) {
+            if (fat_put(file_p->fat16_p, file_p->cur_cluster, EOC16) != 0) {
                 return (-1);
             }
 
-            if (!free_chain(file_p->fat16_p, to_free)) {
+            if (free_chain(file_p->fat16_p, to_free) != 0) {
                 return (-1);
             }
         }
@@ -1460,6 +2116,74 @@ int fat16_file_truncate(struct fat16_file_t *file_p,
     return (fat16_file_seek(file_p, new_pos, FAT16_SEEK_SET));
 }
 
+int fat16_file_preallocate(struct fat16_file_t *file_p,
+                           size_t size)
+{
+    ASSERTN(file_p != NULL, EINVAL);
+
+    struct fat16_t *self_p;
+    uint32_t cluster_size;
+    uint32_t count;
+    uint32_t i;
+    fat_t last;
+    fat_t next;
+    fat_t start;
+
+    /* Error if file is not open for write. */
+    if (!(file_p->flags & O_WRITE)) {
+        return (-1);
+    }
+
+    self_p = file_p->fat16_p;
+    cluster_size = (512 * (uint32_t)self_p->blocks_per_cluster);
+    count = DIV_CEIL(size, cluster_size);
+
+    /* Find the last cluster of the file. */
+    last = 0;
+    next = file_p->first_cluster;
+
+    while ((next >= 2) && !is_end_of_cluster(next) && (count > 0)) {
+        last = next;
+        count--;
+
+        if (fat_get(self_p, last, &next) != 0) {
+            return (-1);
+        }
+    }
+
+    /* Enough clusters already allocated. */
+    if (count == 0) {
+        return (0);
+    }
+
+    if (find_free_extent(self_p, last, count, &start) != 0) {
+        return (-1);
+    }
+
+    /* Allocate the extent and append it to the cluster chain. */
+    for (i = 0; i < count - 1; i++) {
+        if (fat_put(self_p, start + i, start + i + 1) != 0) {
+            return (-1);
+        }
+    }
+
+    if (fat_put(self_p, start + count - 1, EOC16) != 0) {
+        return (-1);
+    }
+
+    if (last != 0) {
+        if (fat_put(self_p, last, start) != 0) {
+            return (-1);
+        }
+    } else {
+        /* First cluster of file so update directory entry. */
+        file_p->flags |= F_FILE_DIR_DIRTY;
+        file_p->first_cluster = start;
+    }
+
+    return (0);
+}
+
 ssize_t fat16_file_size(struct fat16_file_t *file_p)
 {
     ASSERTN(file_p != NULL, EINVAL);
@@ -151,6 +151,24 @@ typedef ssize_t (*fat16_write_t)(void *arg_p,
                                  uint32_t dst_block,
                                  const void *src_p);
 
+/**
+ * Multiple block read function callback. Reads given number of
+ * consecutive blocks.
+ */
+typedef ssize_t (*fat16_read_blocks_t)(void *arg_p,
+                                       void *dst_p,
+                                       uint32_t src_block,
+                                       size_t count);
+
+/**
+ * Multiple block write function callback. Writes given number of
+ * consecutive blocks.
+ */
+typedef ssize_t (*fat16_write_blocks_t)(void *arg_p,
+                                        uint32_t dst_block,
+                                        const void *src_p,
+                                        size_t count);
+
 /**
  * A FAT entry.
  */
@@ -502,17 +520,26 @@ union fat16_cache16_t {
     struct fbs_t fbs;
 };
 
-struct fat16_cache_t {
+struct fat16_cache_block_t {
     uint32_t block_number;         /* Logical number of block in the cache */
-    uint8_t dirty;                 /* cacheFlush() will write block if true */
+    uint8_t dirty;                 /* cache_flush() will write block if true */
+    uint8_t type;                  /* data, FAT or directory block */
     uint32_t mirror_block;         /* mirror block for second FAT */
+    uint32_t last_used;            /* cache counter at last access */
     union fat16_cache16_t buffer;  /* 512 byte cache for raw blocks */
 };
 
+struct fat16_cache_t {
+    struct fat16_cache_block_t blocks[CONFIG_FAT16_CACHE_BLOCKS];
+    uint32_t counter;              /* incremented on each access */
+};
+
 struct fat16_t {
     /* Data block read and wrte functions. */
     fat16_read_t read;
     fat16_write_t write;
+    fat16_read_blocks_t read_blocks;
+    fat16_write_blocks_t write_blocks;
     void *arg_p;
     unsigned int partition;
 
@@ -529,6 +556,14 @@ struct fat16_t {
 
     /* block cache */
     struct fat16_cache_t cache;
+
+#if CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE > 0
+    /* one bit per cluster, set if the cluster is in use */
+    struct {
+        int valid;
+        uint8_t used[CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE];
+    } free_clusters;
+#endif
 };
 
 struct fat16_file_t {
@@ -583,6 +618,24 @@ int fat16_init(struct fat16_t *self_p,
                void *arg_p,
                unsigned int partition);
 
+/**
+ * Set the optional multiple block read and write callbacks. Aligned
+ * file reads and writes of whole blocks within a contiguous cluster
+ * run are passed directly to these callbacks instead of going
+ * through the block cache, one block at a time.
+ *
+ * @param[in] self_p Initialized FAT16 object.
+ * @param[in] read_blocks Callback function used to read consecutive
+ *                        blocks, or NULL.
+ * @param[in] write_blocks Callback function used to write
+ *                         consecutive blocks, or NULL.
+ *
+ * @return zero(0) or negative error code.
+ */
+int fat16_set_multi_block_callbacks(struct fat16_t *self_p,
+                                    fat16_read_blocks_t read_blocks,
+                                    fat16_write_blocks_t write_blocks);
+
 /**
  * Mount given FAT16 volume.
  *
@@ -706,6 +759,24 @@ ssize_t fat16_file_tell(struct fat16_file_t *file_p);
 int fat16_file_truncate(struct fat16_file_t *file_p,
                         size_t size);
 
+/**
+ * Reserve storage for at least `size` bytes in given file, as a
+ * single contiguous extent of clusters following the last cluster of
+ * the file. Data written to the file within the reserved size is
+ * stored sequentially on the storage device.
+ *
+ * The file size is not changed. Reserved clusters beyond the end of
+ * the file are released by `fat16_file_truncate()`.
+ *
+ * @param[in] file_p File object.
+ * @param[in] size Number of bytes to reserve, counted from the
+ *                 beginning of the file.
+ *
+ * @return zero(0) or negative error code.
+ */
+int fat16_file_preallocate(struct fat16_file_t *file_p,
+                           size_t size);
+
 /**
  * Return number of bytes in the file.
  *
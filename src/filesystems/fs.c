@@ -40,6 +40,7 @@ struct module_t {
     struct fs_filesystem_t *filesystems_p;
     struct fs_counter_t *counters_p;
     struct fs_parameter_t *parameters_p;
+    uint32_t generation;
 #if CONFIG_FS_FS_COMMAND_FILESYSTEMS_LIST == 1
     struct fs_command_t cmd_filesystems_list;
 #endif
@@ -901,6 +902,17 @@ int file_seek_null(struct fs_file_t *self_p, int offset, int whence)
     return (0);
 }
 
+/**
+ * A file has been modified. Called after the modification, so data
+ * derived from the file before it has an older generation.
+ */
+static void increment_generation(void)
+{
+    sys_lock();
+    module.generation++;
+    sys_unlock();
+}
+
 int fs_open(struct fs_file_t *self_p, const char *path_p, int flags)
 {
     ASSERTN(self_p != NULL, EINVAL);
@@ -918,6 +930,7 @@ int fs_open(struct fs_file_t *self_p, const char *path_p, int flags)
     }
 
     self_p->filesystem_p = filesystem_p;
+    self_p->flags = flags;
 
     switch (filesystem_p->type) {
 
@@ -961,33 +974,45 @@ int fs_close(struct fs_file_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
+    int res;
+
     switch (self_p->filesystem_p->type) {
 
 #if CONFIG_FAT16 == 1
 
     case fs_type_fat16_t:
-        return (fat16_file_close(&self_p->u.fat16));
+        res = fat16_file_close(&self_p->u.fat16);
+        break;
 
 #endif
 
 #if CONFIG_SPIFFS == 1
 
     case fs_type_spiffs_t:
-        return (spiffs_close(self_p->filesystem_p->fs.spiffs_p,
-                             self_p->u.spiffs));
+        res = spiffs_close(self_p->filesystem_p->fs.spiffs_p,
+                           self_p->u.spiffs);
+        break;
 
 #endif
 
 #if CONFIG_FILESYSTEM_GENERIC == 1
 
     case fs_type_generic_t:
-        return (self_p->filesystem_p->fs.generic.ops_p->file_close(self_p));
+        res = self_p->filesystem_p->fs.generic.ops_p->file_close(self_p);
+        break;
 
 #endif
 
     default:
         return (-1);
     }
+
+    /* Written data may be flushed when the file is closed. */
+    if (self_p->flags & FS_WRITE) {
+        increment_generation();
+    }
+
+    return (res);
 }
 
 ssize_t fs_read(struct fs_file_t *self_p, void *dst_p, size_t size)
@@ -1072,37 +1097,49 @@ ssize_t fs_write(struct fs_file_t *self_p, const void *src_p, size_t size)
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN((src_p != NULL) || (size == 0), EINVAL);
 
+    ssize_t res;
+
     switch (self_p->filesystem_p->type) {
 
 #if CONFIG_FAT16 == 1
 
     case fs_type_fat16_t:
-        return (fat16_file_write(&self_p->u.fat16, src_p, size));
+        res = fat16_file_write(&self_p->u.fat16, src_p, size);
+        break;
 
 #endif
 
 #if CONFIG_SPIFFS == 1
 
     case fs_type_spiffs_t:
-        return (spiffs_write(self_p->filesystem_p->fs.spiffs_p,
-                             self_p->u.spiffs,
-                             (void *)src_p,
-                             size));
+        res = spiffs_write(self_p->filesystem_p->fs.spiffs_p,
+                           self_p->u.spiffs,
+                           (void *)src_p,
+                           size);
+        break;
 
 #endif
 
 #if CONFIG_FILESYSTEM_GENERIC == 1
 
     case fs_type_generic_t:
-        return (self_p->filesystem_p->fs.generic.ops_p->file_write(self_p,
-                                                                   src_p,
-                                                                   size));
+        res = self_p->filesystem_p->fs.generic.ops_p->file_write(self_p,
+                                                                 src_p,
+                                                                 size);
+        break;
 
 #endif
 
     default:
         return (-1);
     }
+
+    /* Failed and empty writes do not modify the file. */
+    if (res > 0) {
+        increment_generation();
+    }
+
+    return (res);
 }
 
 int fs_seek(struct fs_file_t *self_p, int offset, int whence)
@@ -1368,7 +1405,17 @@ int fs_remove(const char *path_p)
 #if CONFIG_SPIFFS == 1
 
     case fs_type_spiffs_t:
-        return (spiffs_remove(filesystem_p->fs.spiffs_p, path_p));
+        {
+            int res;
+
+            res = spiffs_remove(filesystem_p->fs.spiffs_p, path_p);
+
+            if (res == 0) {
+                increment_generation();
+            }
+
+            return (res);
+        }
 
 #endif
 
@@ -1480,6 +1527,8 @@ int fs_format(const char *path_p)
             return (-1);
         }
 
+        increment_generation();
+
         return (0);
 
 #endif
@@ -1489,6 +1538,17 @@ int fs_format(const char *path_p)
     }
 }
 
+uint32_t fs_get_generation(void)
+{
+    uint32_t generation;
+
+    sys_lock();
+    generation = module.generation;
+    sys_unlock();
+
+    return (generation);
+}
+
 int fs_ls(const char *path_p,
           const char *filter_p,
           void *chout_p)
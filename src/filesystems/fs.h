@@ -200,6 +200,7 @@ struct fs_filesystem_t {
 /* A file. */
 struct fs_file_t {
     struct fs_filesystem_t *filesystem_p;
+    int flags;
     union {
 #if CONFIG_FAT16 == 1
         struct fat16_file_t fat16;
@@ -440,6 +441,17 @@ int fs_dir_read(struct fs_dir_t *dir_p,
  */
 int fs_remove(const char *path_p);
 
+/**
+ * Get the file system generation. It is incremented after each
+ * modification of a file through this module, that is, writes,
+ * closing files opened for writing, removals and formatting. Data
+ * derived from files, for example a cache of checksums, is stale if
+ * the generation has changed since it was derived.
+ *
+ * @return Current generation.
+ */
+uint32_t fs_get_generation(void);
+
 /**
  * Gets file status by path.
  *
@@ -49,6 +49,18 @@ static const FAR char not_found_fmt[] =
     "Content-Length: %d\r\n"
     "\r\n";
 
+static const FAR char static_file_fmt[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: %s\r\n"
+    "Content-Length: %lu\r\n"
+    "ETag: %s\r\n"
+    "\r\n";
+
+static const FAR char not_modified_fmt[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "ETag: %s\r\n"
+    "\r\n";
+
 static const FAR char bad_request_header[] =
     "HTTP/1.1 400 Bad Request\r\n"
     "Content-Type: text/plain\r\n"
@@ -56,294 +68,1127 @@ static const FAR char bad_request_header[] =
     "\r\n"
     "Failed to parse the HTTP header.";
 
-static int read_initial_request_line(void *chan_p,
-                                     char *buf_p,
-                                     struct http_server_request_t *request_p)
+#if CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE < 128
+#    error "The static file chunk must fit the response header."
+#endif
+
+/* Static file content types by file name extension. */
+static const struct {
+    const char *extension_p;
+    const char *content_type_p;
+} content_types[] = {
+    { ".html", "text/html" },
+    { ".css", "text/css" },
+    { ".js", "application/javascript" },
+    { ".json", "application/json" },
+    { ".txt", "text/plain" },
+    { ".png", "image/png" },
+    { ".jpg", "image/jpeg" },
+    { ".ico", "image/x-icon" },
+    { ".svg", "image/svg+xml" }
+};
+
+/* Request body framing. */
+#define BODY_MODE_RAW                                       0
+#define BODY_MODE_LENGTH                                    1
+#define BODY_MODE_CHUNK_SIZE                                2
+#define BODY_MODE_CHUNK_DATA                                3
+
+/**
+ * Wait for input from the transport until the deadline, if any.
+ * Returns -ETIMEDOUT if no input was received in time.
+ */
+static int input_wait(struct http_server_connection_input_t *self_p)
 {
-    char *action_p = NULL;
-    char *path_p = NULL;
-    char *proto_p = NULL;
-    size_t size;
+    struct time_t timeout;
 
-    *buf_p++ = '\0';
-    action_p = buf_p;
-    size = 0;
+    if (self_p->deadline.enabled == 0) {
+        return (0);
+    }
 
-    while (1) {
-        if (size == CONFIG_HTTP_SERVER_REQUEST_BUFFER_SIZE) {
-            return (-ENOMEM);
-        }
+    if (chan_size(self_p->chan_p) > 0) {
+        return (0);
+    }
 
-        if (chan_read(chan_p, buf_p, sizeof(*buf_p)) != sizeof(*buf_p)) {
-            return (-EIO);
-        }
+    time_get(&timeout);
+    time_subtract(&timeout, &self_p->deadline.time, &timeout);
 
-        buf_p++;
+    if ((timeout.seconds < 0) || (timeout.nanoseconds < 0)) {
+        return (-ETIMEDOUT);
+    }
 
-        /* The line ending is "\r\n". */
-        if ((buf_p[-2] == '\r') && (buf_p[-1] == '\n')) {
-            buf_p[-2] = '\0';
-            break;
-        }
+    if (chan_poll(self_p->chan_p, &timeout) == NULL) {
+        return (-ETIMEDOUT);
+    }
 
-        /* Action and path has ' ' as terminator. */
-        if (buf_p[-1] == ' ') {
-            buf_p[-1] = '\0';
+    return (0);
+}
 
-            if (path_p == NULL) {
-                path_p = buf_p;
-            } else if (proto_p == NULL) {
-                proto_p = buf_p;
-            }
-        }
+/**
+ * Read at least one byte from the transport into the input buffer,
+ * and more if the transport has more available.
+ */
+static int input_fill(struct http_server_connection_input_t *self_p)
+{
+    int res;
+    size_t size;
+    size_t left;
 
-        size++;
-    }
+    res = input_wait(self_p);
 
-    /* Path and protocol are mandatory. */
-    if ((path_p == NULL) || (proto_p == NULL)) {
-        return (-1);
+    if (res != 0) {
+        return (res);
     }
 
-    log_object_print(NULL,
-                     LOG_DEBUG,
-                     OSTR("%s %s %s\r\n"), action_p, path_p, proto_p);
+    left = (sizeof(self_p->buffer.buf) - self_p->buffer.size);
+    size = chan_size(self_p->chan_p);
 
-    /* Save the action and path in the request struct. */
-    size = sizeof(request_p->path);
-    strncpy(request_p->path, path_p, size - 1);
-    request_p->path[size - 1] = '\0';
+    if (size < 1) {
+        size = 1;
+    } else if (size > left) {
+        size = left;
+    }
 
-    if (strcmp(action_p, "GET") == 0) {
-        request_p->action = http_server_request_action_get_t;
-    } else if (strcmp(action_p, "POST") == 0) {
-        request_p->action = http_server_request_action_post_t;
-    } else {
-        return (-1);
+    if (chan_read(self_p->chan_p,
+                  &self_p->buffer.buf[self_p->buffer.size],
+                  size) != size) {
+        return (-EIO);
     }
 
+    self_p->buffer.size += size;
+
     return (0);
 }
 
-static int read_header_line(void *chan_p,
-                            char *buf_p,
-                            char **header_pp,
-                            char **value_pp)
+/**
+ * Read a line ending with "\r\n" from the input. The line ending is
+ * replaced by a null termination, and the line is valid until the
+ * input is read again.
+ */
+static int input_read_line(struct http_server_connection_input_t *self_p,
+                           char **line_pp)
 {
+    int res;
+    char *buf_p;
+    size_t i;
     size_t size;
-    *buf_p++ = '\0';
-    *header_pp = buf_p;
-    *value_pp = NULL;
-    size = 0;
+
+    buf_p = &self_p->buffer.buf[0];
+    i = self_p->buffer.pos;
 
     while (1) {
-        if (size == CONFIG_HTTP_SERVER_REQUEST_BUFFER_SIZE) {
+        /* Search for the line ending in the buffered data. */
+        while (i + 1 < self_p->buffer.size) {
+            if ((buf_p[i] == '\r') && (buf_p[i + 1] == '\n')) {
+                buf_p[i] = '\0';
+                *line_pp = &buf_p[self_p->buffer.pos];
+                self_p->buffer.pos = (i + 2);
+
+                return (0);
+            }
+
+            i++;
+        }
+
+        /* Move the partial line to the beginning of the buffer to
+           make room for more data. */
+        if (self_p->buffer.pos > 0) {
+            size = (self_p->buffer.size - self_p->buffer.pos);
+            memmove(buf_p, &buf_p[self_p->buffer.pos], size);
+            i -= self_p->buffer.pos;
+            self_p->buffer.pos = 0;
+            self_p->buffer.size = size;
+        }
+
+        if (self_p->buffer.size == sizeof(self_p->buffer.buf)) {
             return (-ENOMEM);
         }
 
-        if (chan_read(chan_p, buf_p, sizeof(*buf_p)) != sizeof(*buf_p)) {
-            return (-EIO);
+        res = input_fill(self_p);
+
+        if (res != 0) {
+            return (res);
         }
+    }
+}
+
+/**
+ * Read up to given number of bytes, first from the input buffer and
+ * then from the transport.
+ */
+static ssize_t input_read_data(struct http_server_connection_input_t *self_p,
+                               void *buf_p,
+                               size_t size)
+{
+    int res;
+    size_t buffered;
+    size_t available;
 
-        buf_p++;
+    buffered = (self_p->buffer.size - self_p->buffer.pos);
 
-        /* The line ending is "\r\n". */
-        if ((buf_p[-2] == '\r') && (buf_p[-1] == '\n')) {
-            buf_p[-2] = '\0';
-            break;
+    if (buffered == 0) {
+        res = input_wait(self_p);
+
+        if (res != 0) {
+            return (res);
         }
 
-        /* Value starts after ': '. */
-        if ((buf_p[-2] == ':') && (buf_p[-1] == ' ')) {
-            if (*value_pp == NULL) {
-                buf_p[-2] = '\0';
-                *value_pp = buf_p;
+        /* Only read received data in multiplexed mode. */
+        if (self_p->deadline.enabled == 1) {
+            available = chan_size(self_p->chan_p);
+
+            if (size > available) {
+                size = available;
             }
         }
 
-        size++;
+        return (chan_read(self_p->chan_p, buf_p, size));
     }
 
-    if (*value_pp != NULL) {
-        return (0);
-    } else {
-        /* Empty line. */
-        return (1);
+    if (size > buffered) {
+        size = buffered;
     }
+
+    memcpy(buf_p, &self_p->buffer.buf[self_p->buffer.pos], size);
+    self_p->buffer.pos += size;
+
+    return (size);
 }
 
-static int read_request(struct http_server_t *self_p,
-                        struct http_server_connection_t *connection_p,
-                        struct http_server_request_t *request_p)
+/**
+ * Read a chunk size line of a chunked request body. The trailer is
+ * read after the last chunk.
+ */
+static int input_read_chunk_size(struct http_server_connection_input_t *self_p)
 {
     int res;
-    char buf[CONFIG_HTTP_SERVER_REQUEST_BUFFER_SIZE];
-    char *header_p;
-    char *value_p;
-    size_t size;
+    char *line_p;
+    long size;
 
-    /* Read the intial line in the request. */
-    res = read_initial_request_line(connection_p->chan_p,
-                                    buf,
-                                    request_p);
+    res = input_read_line(self_p, &line_p);
 
     if (res != 0) {
         return (res);
     }
 
-    memset(&request_p->headers, 0, sizeof(request_p->headers));
+    /* Chunk extensions, if any, are ignored. */
+    if ((std_strtolb(line_p, &size, 16) == NULL) || (size < 0)) {
+        return (-EPROTO);
+    }
 
-    /* Read the header lines. */
-    while (1) {
-        res = read_header_line(connection_p->chan_p,
-                               buf,
-                               &header_p,
-                               &value_p);
+    if (size > 0) {
+        self_p->body.mode = BODY_MODE_CHUNK_DATA;
+        self_p->body.left = size;
 
-        if (res == 1) {
-            break;
-        } else if (res < 0) {
-            return (res);
-        }
+        return (0);
+    }
 
-        log_object_print(NULL, LOG_DEBUG, OSTR("%s: %s\r\n"), header_p, value_p);
+    /* Skip the trailer. */
+    do {
+        res = input_read_line(self_p, &line_p);
 
-        /* Save the header field in the request object. */
-        if (strcmp(header_p, "Sec-WebSocket-Key") == 0) {
-            request_p->headers.sec_websocket_key.present = 1;
-            size = sizeof(request_p->headers.sec_websocket_key.value);
-            strncpy(request_p->headers.sec_websocket_key.value, value_p, size - 1);
-            request_p->headers.sec_websocket_key.value[size - 1] = '\0';
-        } else if (strcmp(header_p, "Content-Type") == 0) {
-            request_p->headers.content_type.present = 1;
-            size = sizeof(request_p->headers.content_type.value);
-            strncpy(request_p->headers.content_type.value, value_p, size - 1);
-            request_p->headers.content_type.value[size - 1] = '\0';
-        } else if (strcmp(header_p, "Content-Length") == 0) {
-            if (std_strtol(value_p, &request_p->headers.content_length.value) != NULL) {
-                request_p->headers.content_length.present = 1;
-            }
-        } else if (strcmp(header_p, "Authorization") == 0) {
-            request_p->headers.authorization.present = 1;
-            size = sizeof(request_p->headers.authorization.value);
-            strncpy(request_p->headers.authorization.value, value_p, size - 1);
-            request_p->headers.authorization.value[size - 1] = '\0';
-        } else if (strcmp(header_p, "Expect") == 0) {
-            request_p->headers.expect.present = 1;
-            size = sizeof(request_p->headers.expect.value);
-            strncpy(request_p->headers.expect.value, value_p, size - 1);
-            request_p->headers.expect.value[size - 1] = '\0';
+        if (res != 0) {
+            return (res);
         }
-    }
+    } while (line_p[0] != '\0');
+
+    self_p->body.mode = BODY_MODE_LENGTH;
+    self_p->body.left = 0;
 
     return (0);
 }
 
 /**
- * Search for given path in the routes array and return its callback.
+ * Read from the request body, or after a protocol upgrade, from the
+ * connection. Chunked bodies are decoded. Returns zero(0) at the end
+ * of the body.
  */
-static http_server_route_callback_t
-find_route_callback(struct http_server_t *self_p,
-                    const char *path_p)
+static ssize_t input_read(void *self_p,
+                          void *buf_p,
+                          size_t size)
 {
-    const struct http_server_route_t *route_p;
+    struct http_server_connection_input_t *input_p;
+    ssize_t res;
+    char *line_p;
+    char *b_p;
+    size_t left;
+    size_t n;
+
+    input_p = self_p;
+    b_p = buf_p;
+    left = size;
+
+    while (left > 0) {
+        if (input_p->body.mode == BODY_MODE_CHUNK_SIZE) {
+            res = input_read_chunk_size(input_p);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            continue;
+        }
+
+        n = left;
 
-    route_p = self_p->routes_p;
+        if (input_p->body.mode == BODY_MODE_CHUNK_DATA) {
+            /* The chunk data is followed by "\r\n". */
+            if (input_p->body.left == 0) {
+                res = input_read_line(input_p, &line_p);
 
-    while (route_p->path_p != NULL) {
-        if (strncmp(route_p->path_p, path_p, strlen(route_p->path_p)) == 0) {
-            return (route_p->callback);
+                if (res != 0) {
+                    return (res);
+                }
+
+                if (line_p[0] != '\0') {
+                    return (-EPROTO);
+                }
+
+                input_p->body.mode = BODY_MODE_CHUNK_SIZE;
+
+                continue;
+            }
+        } else if (input_p->body.mode == BODY_MODE_LENGTH) {
+            if (input_p->body.left == 0) {
+                break;
+            }
+        }
+
+        if ((input_p->body.mode != BODY_MODE_RAW)
+            && (n > input_p->body.left)) {
+            n = input_p->body.left;
+        }
+
+        res = input_read_data(input_p, b_p, n);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        b_p += res;
+        left -= res;
+
+        if (input_p->body.mode == BODY_MODE_RAW) {
+            input_p->body.raw += res;
+        } else {
+            input_p->body.left -= res;
         }
 
-        route_p++;
+        /* The connection was closed. Less than requested is read
+           from the buffer, or from the transport in multiplexed
+           mode, without the connection being closed. */
+        if (res == 0) {
+            break;
+        }
     }
 
-    return (NULL);
+    return (size - left);
 }
 
-static int handle_request(struct http_server_t *self_p,
-                          struct http_server_connection_t *connection_p)
+static ssize_t input_write(void *self_p,
+                           const void *buf_p,
+                           size_t size)
 {
-    int res;
-    struct http_server_request_t request;
-    http_server_route_callback_t callback;
+    struct http_server_connection_input_t *input_p;
 
-    /* Read the HTTP request. */
-    res = read_request(self_p, connection_p, &request);
+    input_p = self_p;
 
-    if (res != 0) {
-        /* Reply with a Bad Request if the header could not be read.*/
-        std_fprintf(connection_p->chan_p, bad_request_header);
+    return (chan_write(input_p->chan_p, buf_p, size));
+}
 
-        return (res);
+static size_t input_size(void *self_p)
+{
+    struct http_server_connection_input_t *input_p;
+    size_t size;
+
+    input_p = self_p;
+    size = (input_p->buffer.size - input_p->buffer.pos);
+    size += chan_size(input_p->chan_p);
+
+    if ((input_p->body.mode != BODY_MODE_RAW)
+        && (size > input_p->body.left)) {
+        size = input_p->body.left;
     }
 
-    /* Find the callback for given path. */
-    callback = find_route_callback(self_p, request.path);
+    return (size);
+}
 
-    if (callback == NULL) {
-        callback = self_p->on_no_route;
+/**
+ * Read the part of the request body not read by the route callback,
+ * to find the start of the next request.
+ */
+static int input_skip_body(struct http_server_connection_input_t *self_p)
+{
+    ssize_t res;
+    char buf[16];
+
+    do {
+        res = input_read(self_p, &buf[0], sizeof(buf));
+    } while (res > 0);
+
+    return (res);
+}
+
+/**
+ * Find the end of the buffered line starting at given position.
+ * Returns the position of its "\r\n", or -1 if the line is not
+ * complete.
+ */
+static ssize_t input_find_line_end(struct http_server_connection_input_t *self_p,
+                                   size_t pos)
+{
+    const char *buf_p;
+
+    buf_p = &self_p->buffer.buf[0];
+
+    while (pos + 1 < self_p->buffer.size) {
+        if ((buf_p[pos] == '\r') && (buf_p[pos + 1] == '\n')) {
+            return (pos);
+        }
+
+        pos++;
     }
 
-    /* Call the callback and write the response if requested. */
-    return (callback(connection_p, &request));
+    return (-1);
 }
 
 /**
- * The connection thread serves a client for the duration of the
- * socket lifetime.
+ * Returns true(1) if a complete request, including its body, is
+ * buffered. The buffer is only scanned, it is parsed when the request
+ * is handled.
  */
-static void *connection_main(void *arg_p)
+static int input_has_request(struct http_server_connection_input_t *self_p)
 {
-    struct http_server_connection_t *connection_p = arg_p;
-    struct http_server_t *self_p = connection_p->self_p;
-    uint32_t mask;
+    const char *buf_p;
+    ssize_t end;
+    size_t pos;
+    long length;
+    int chunked;
+
+    buf_p = &self_p->buffer.buf[0];
+    pos = self_p->buffer.pos;
+    length = 0;
+    chunked = 0;
+
+    /* Empty lines before the request line are ignored. */
+    while (1) {
+        end = input_find_line_end(self_p, pos);
 
-    /* thrd_init_env(buf, sizeof(buf)); */
-    /* thrd_set_env("CWD", self_p->root_path_p); */
-    thrd_set_name(connection_p->thrd.name_p);
+        if (end < 0) {
+            return (0);
+        }
 
-    /* Wait for a connection from the listener. */
+        if (end > pos) {
+            break;
+        }
+
+        pos += 2;
+    }
+
+    /* The header lines, ending with an empty line. */
     while (1) {
-        log_object_print(NULL,
-                         LOG_DEBUG,
-                         OSTR("Connection thread '%s' waiting for a new connection.\r\n"),
-                         thrd_get_name());
+        pos = (end + 2);
+        end = input_find_line_end(self_p, pos);
 
-        mask = 0x1;
-        event_read(&connection_p->events, &mask, sizeof(mask));
+        if (end < 0) {
+            return (0);
+        }
 
-        if (mask & 0x1) {
-#if CONFIG_HTTP_SERVER_SSL == 1
-            if (self_p->ssl_context_p != NULL) {
-                ssl_socket_open(&connection_p->ssl_socket,
-                                self_p->ssl_context_p,
-                                &connection_p->socket,
-                                SSL_SOCKET_SERVER_SIDE,
-                                NULL);
-            }
-#endif
+        if (end == pos) {
+            break;
+        }
 
-            handle_request(self_p, connection_p);
+        if (strncmp(&buf_p[pos], "Content-Length:", 15) == 0) {
+            pos += 15;
 
-#if CONFIG_HTTP_SERVER_SSL == 1
-            if (self_p->ssl_context_p != NULL) {
-                (void)ssl_socket_close(&connection_p->ssl_socket);
+            while (buf_p[pos] == ' ') {
+                pos++;
             }
-#endif
 
-            (void)socket_close(&connection_p->socket);
+            if (std_strtol(&buf_p[pos], &length) == NULL) {
+                length = 0;
+            }
+        } else if (strncmp(&buf_p[pos], "Transfer-Encoding:", 18) == 0) {
+            chunked = 1;
+        }
+    }
 
-            /* Add thread to the free list. */
-            sys_lock();
-            connection_p->state = http_server_connection_state_free_t;
-            sys_unlock();
-            mask = 0x1;
-            event_write(&self_p->events, &mask, sizeof(mask));
+    pos = (end + 2);
+
+    if (chunked == 0) {
+        return ((long)(self_p->buffer.size - pos) >= length);
+    }
+
+    /* The chunks, ending with a zero sized chunk and the trailer. */
+    while (1) {
+        end = input_find_line_end(self_p, pos);
+
+        if (end < 0) {
+            return (0);
+        }
+
+        /* Errors are reported when the request is handled. */
+        if ((std_strtolb(&buf_p[pos], &length, 16) == NULL)
+            || (length < 0)) {
+            return (1);
+        }
+
+        if (length == 0) {
+            break;
+        }
+
+        /* The chunk data is followed by "\r\n". */
+        pos = (end + 2);
+
+        if (length > (long)(self_p->buffer.size - pos) - 2) {
+            return (0);
         }
+
+        pos += (length + 2);
     }
 
-    return (NULL);
+    while (end > pos) {
+        pos = (end + 2);
+        end = input_find_line_end(self_p, pos);
+
+        if (end < 0) {
+            return (0);
+        }
+    }
+
+    return (1);
+}
+
+static int read_initial_request_line(struct http_server_connection_input_t *input_p,
+                                     struct http_server_request_t *request_p)
+{
+    int res;
+    char *action_p;
+    char *path_p;
+    char *proto_p;
+    size_t size;
+
+    /* Empty lines before the request line are ignored. */
+    do {
+        res = input_read_line(input_p, &action_p);
+
+        if (res != 0) {
+            return (res);
+        }
+    } while (action_p[0] == '\0');
+
+    /* Action and path has ' ' as terminator. Path and protocol are
+       mandatory. */
+    path_p = strchr(action_p, ' ');
+
+    if (path_p == NULL) {
+        return (-1);
+    }
+
+    *path_p++ = '\0';
+    proto_p = strchr(path_p, ' ');
+
+    if (proto_p == NULL) {
+        return (-1);
+    }
+
+    *proto_p++ = '\0';
+
+    log_object_print(NULL,
+                     LOG_DEBUG,
+                     OSTR("%s %s %s\r\n"), action_p, path_p, proto_p);
+
+    /* Save the action and path in the request struct. */
+    size = sizeof(request_p->path);
+    strncpy(request_p->path, path_p, size - 1);
+    request_p->path[size - 1] = '\0';
+
+    if (strcmp(action_p, "GET") == 0) {
+        request_p->action = http_server_request_action_get_t;
+    } else if (strcmp(action_p, "POST") == 0) {
+        request_p->action = http_server_request_action_post_t;
+    } else {
+        return (-1);
+    }
+
+    /* HTTP/1.1 connections are persistent by default. Connections
+       using older protocol versions are always closed after the
+       response. */
+    request_p->keep_alive = (strcmp(proto_p, "HTTP/1.1") == 0);
+
+    return (0);
+}
+
+static int read_header_line(struct http_server_connection_input_t *input_p,
+                            char **header_pp,
+                            char **value_pp)
+{
+    int res;
+    char *value_p;
+
+    res = input_read_line(input_p, header_pp);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    /* Empty line. */
+    if ((*header_pp)[0] == '\0') {
+        return (1);
+    }
+
+    /* Value starts after ':' and optional white space. */
+    value_p = strchr(*header_pp, ':');
+
+    if (value_p == NULL) {
+        return (-1);
+    }
+
+    *value_p++ = '\0';
+
+    while (*value_p == ' ') {
+        value_p++;
+    }
+
+    *value_pp = value_p;
+
+    return (0);
+}
+
+static int read_request(struct http_server_t *self_p,
+                        struct http_server_connection_t *connection_p,
+                        struct http_server_request_t *request_p)
+{
+    int res;
+    struct http_server_connection_input_t *input_p;
+    char *header_p;
+    char *value_p;
+    size_t size;
+
+    input_p = &connection_p->input;
+
+    /* Read the intial line in the request. */
+    res = read_initial_request_line(input_p, request_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    memset(&request_p->headers, 0, sizeof(request_p->headers));
+
+    /* Read the header lines. */
+    while (1) {
+        res = read_header_line(input_p, &header_p, &value_p);
+
+        if (res == 1) {
+            break;
+        } else if (res < 0) {
+            return (res);
+        }
+
+        log_object_print(NULL, LOG_DEBUG, OSTR("%s: %s\r\n"), header_p, value_p);
+
+        /* Save the header field in the request object. */
+        if (strcmp(header_p, "Sec-WebSocket-Key") == 0) {
+            request_p->headers.sec_websocket_key.present = 1;
+            size = sizeof(request_p->headers.sec_websocket_key.value);
+            strncpy(request_p->headers.sec_websocket_key.value, value_p, size - 1);
+            request_p->headers.sec_websocket_key.value[size - 1] = '\0';
+        } else if (strcmp(header_p, "Content-Type") == 0) {
+            request_p->headers.content_type.present = 1;
+            size = sizeof(request_p->headers.content_type.value);
+            strncpy(request_p->headers.content_type.value, value_p, size - 1);
+            request_p->headers.content_type.value[size - 1] = '\0';
+        } else if (strcmp(header_p, "Content-Length") == 0) {
+            if (std_strtol(value_p, &request_p->headers.content_length.value) != NULL) {
+                request_p->headers.content_length.present = 1;
+            }
+        } else if (strcmp(header_p, "Authorization") == 0) {
+            request_p->headers.authorization.present = 1;
+            size = sizeof(request_p->headers.authorization.value);
+            strncpy(request_p->headers.authorization.value, value_p, size - 1);
+            request_p->headers.authorization.value[size - 1] = '\0';
+        } else if (strcmp(header_p, "Expect") == 0) {
+            request_p->headers.expect.present = 1;
+            size = sizeof(request_p->headers.expect.value);
+            strncpy(request_p->headers.expect.value, value_p, size - 1);
+            request_p->headers.expect.value[size - 1] = '\0';
+        } else if (strcmp(header_p, "Connection") == 0) {
+            request_p->headers.connection.present = 1;
+            size = sizeof(request_p->headers.connection.value);
+            strncpy(request_p->headers.connection.value, value_p, size - 1);
+            request_p->headers.connection.value[size - 1] = '\0';
+        } else if (strcmp(header_p, "Transfer-Encoding") == 0) {
+            request_p->headers.transfer_encoding.present = 1;
+            size = sizeof(request_p->headers.transfer_encoding.value);
+            strncpy(request_p->headers.transfer_encoding.value, value_p, size - 1);
+            request_p->headers.transfer_encoding.value[size - 1] = '\0';
+        } else if (strcmp(header_p, "If-None-Match") == 0) {
+            request_p->headers.if_none_match.present = 1;
+            size = sizeof(request_p->headers.if_none_match.value);
+            strncpy(request_p->headers.if_none_match.value, value_p, size - 1);
+            request_p->headers.if_none_match.value[size - 1] = '\0';
+        }
+    }
+
+    if (request_p->headers.connection.present == 1) {
+        if (strcmp(request_p->headers.connection.value, "close") == 0) {
+            request_p->keep_alive = 0;
+        } else if ((strstr(request_p->headers.connection.value,
+                           "Upgrade") != NULL)
+                   || (strstr(request_p->headers.connection.value,
+                              "upgrade") != NULL)) {
+            request_p->keep_alive = 0;
+        }
+    }
+
+    /* The route callback takes over the connection after a protocol
+       upgrade, so no more requests are read from it. */
+    if (request_p->headers.sec_websocket_key.present == 1) {
+        request_p->keep_alive = 0;
+    }
+
+    /* Prepare the input for the body. A request without a length is
+       only read from by the route callback after a protocol
+       upgrade. */
+    input_p->body.raw = 0;
+    input_p->body.left = 0;
+
+    if (request_p->headers.transfer_encoding.present == 1) {
+        if (strcmp(request_p->headers.transfer_encoding.value,
+                   "chunked") != 0) {
+            return (-1);
+        }
+
+        input_p->body.mode = BODY_MODE_CHUNK_SIZE;
+    } else if (request_p->headers.content_length.present == 1) {
+        if (request_p->headers.content_length.value < 0) {
+            return (-1);
+        }
+
+        input_p->body.mode = BODY_MODE_LENGTH;
+        input_p->body.left = request_p->headers.content_length.value;
+    } else {
+        input_p->body.mode = BODY_MODE_RAW;
+    }
+
+    return (0);
+}
+
+/**
+ * Get the size of the path segment starting at given position. The
+ * segment ends at the next '/', at the query string or at the end of
+ * the path.
+ */
+static size_t segment_size(const char *segment_p)
+{
+    size_t size;
+
+    size = 0;
+
+    while ((segment_p[size] != '/')
+           && (segment_p[size] != '?')
+           && (segment_p[size] != '\0')) {
+        size++;
+    }
+
+    return (size);
+}
+
+static int is_param(struct http_server_route_node_t *node_p)
+{
+    return ((node_p->size > 0) && (node_p->segment_p[0] == ':'));
+}
+
+static int is_wildcard(struct http_server_route_node_t *node_p)
+{
+    return ((node_p->size == 1) && (node_p->segment_p[0] == '*'));
+}
+
+/**
+ * Add given route to the route table. The children of a node are
+ * kept ordered with exact segments first, then parameters and last
+ * the wildcard, so the most specific route is matched first.
+ */
+static int route_table_add(struct http_server_t *self_p,
+                           const struct http_server_route_t *route_p,
+                           int *length_p)
+{
+    struct http_server_route_node_t *parent_p;
+    struct http_server_route_node_t *node_p;
+    struct http_server_route_node_t **next_pp;
+    const char *segment_p;
+    size_t size;
+
+    if (route_p->path_p[0] != '/') {
+        return (-EINVAL);
+    }
+
+    parent_p = &self_p->route_table.root;
+    segment_p = &route_p->path_p[1];
+
+    while (1) {
+        size = segment_size(segment_p);
+        node_p = parent_p->children_p;
+
+        while (node_p != NULL) {
+            if ((node_p->size == size)
+                && (memcmp(node_p->segment_p, segment_p, size) == 0)) {
+                break;
+            }
+
+            node_p = node_p->next_p;
+        }
+
+        if (node_p == NULL) {
+            if (*length_p == membersof(self_p->route_table.nodes)) {
+                return (-ENOMEM);
+            }
+
+            node_p = &self_p->route_table.nodes[*length_p];
+            (*length_p)++;
+            node_p->segment_p = segment_p;
+            node_p->size = size;
+            node_p->callback = NULL;
+            node_p->children_p = NULL;
+            next_pp = &parent_p->children_p;
+
+            if (is_wildcard(node_p)) {
+                while (*next_pp != NULL) {
+                    next_pp = &(*next_pp)->next_p;
+                }
+            } else if (is_param(node_p)) {
+                while ((*next_pp != NULL) && !is_wildcard(*next_pp)) {
+                    next_pp = &(*next_pp)->next_p;
+                }
+            }
+
+            node_p->next_p = *next_pp;
+            *next_pp = node_p;
+        }
+
+        if (segment_p[size] != '/') {
+            break;
+        }
+
+        /* The wildcard must be the last segment. */
+        if (is_wildcard(node_p)) {
+            return (-EINVAL);
+        }
+
+        parent_p = node_p;
+        segment_p += (size + 1);
+    }
+
+    /* The first of identical routes is used. */
+    if (node_p->callback == NULL) {
+        node_p->callback = route_p->callback;
+    }
+
+    return (0);
+}
+
+/**
+ * Compile given routes array into the route table.
+ */
+static int route_table_init(struct http_server_t *self_p,
+                            const struct http_server_route_t *routes_p)
+{
+    int res;
+    int length;
+
+    self_p->route_table.root.children_p = NULL;
+    length = 0;
+
+    while (routes_p->path_p != NULL) {
+        res = route_table_add(self_p, routes_p, &length);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        routes_p++;
+    }
+
+    return (0);
+}
+
+static int request_add_param(struct http_server_request_t *request_p,
+                             struct http_server_route_node_t *node_p,
+                             const char *value_p,
+                             size_t size)
+{
+    int i;
+
+    i = request_p->params.length;
+
+    if (i == membersof(request_p->params.entries)) {
+        return (-ENOMEM);
+    }
+
+    request_p->params.entries[i].name_p = &node_p->segment_p[is_param(node_p)];
+    request_p->params.entries[i].value_p = value_p;
+    request_p->params.entries[i].size = size;
+    request_p->params.length++;
+
+    return (0);
+}
+
+/**
+ * Find the callback of the route below given node matching the path
+ * starting with given segment, and save the path parameters in the
+ * request. Other children are only tried if the path does not match
+ * below the most specific child.
+ */
+static http_server_route_callback_t
+route_table_find(struct http_server_route_node_t *parent_p,
+                 const char *segment_p,
+                 struct http_server_request_t *request_p)
+{
+    struct http_server_route_node_t *node_p;
+    http_server_route_callback_t callback;
+    size_t size;
+    int length;
+
+    size = segment_size(segment_p);
+    length = request_p->params.length;
+
+    for (node_p = parent_p->children_p;
+         node_p != NULL;
+         node_p = node_p->next_p) {
+        if (is_wildcard(node_p)) {
+            if (request_add_param(request_p,
+                                  node_p,
+                                  segment_p,
+                                  strcspn(segment_p, "?")) != 0) {
+                return (NULL);
+            }
+
+            return (node_p->callback);
+        } else if (is_param(node_p)) {
+            if (size == 0) {
+                continue;
+            }
+
+            if (request_add_param(request_p, node_p, segment_p, size) != 0) {
+                continue;
+            }
+        } else if ((node_p->size != size)
+                   || (memcmp(node_p->segment_p, segment_p, size) != 0)) {
+            continue;
+        }
+
+        if (segment_p[size] == '/') {
+            callback = route_table_find(node_p,
+                                        &segment_p[size + 1],
+                                        request_p);
+        } else {
+            callback = node_p->callback;
+        }
+
+        if (callback != NULL) {
+            return (callback);
+        }
+
+        request_p->params.length = length;
+    }
+
+    return (NULL);
+}
+
+/**
+ * Search for given path in the route table and return its callback.
+ */
+static http_server_route_callback_t
+find_route_callback(struct http_server_t *self_p,
+                    struct http_server_request_t *request_p)
+{
+    request_p->params.length = 0;
+
+    if (request_p->path[0] != '/') {
+        return (NULL);
+    }
+
+    return (route_table_find(&self_p->route_table.root,
+                             &request_p->path[1],
+                             request_p));
+}
+
+/**
+ * Read and handle one request. Returns zero(0) if the connection
+ * shall be kept open for another request, otherwise non-zero.
+ */
+static int handle_request(struct http_server_t *self_p,
+                          struct http_server_connection_t *connection_p)
+{
+    int res;
+    struct http_server_request_t request;
+    http_server_route_callback_t callback;
+
+    /* Read the HTTP request. */
+    res = read_request(self_p, connection_p, &request);
+
+    if (res != 0) {
+        /* Reply with a Bad Request if the header could not be read,
+           unless the connection was closed by the client. */
+        if (res != -EIO) {
+            std_fprintf(connection_p->chan_p, bad_request_header);
+        }
+
+        return (res);
+    }
+
+    /* Find the callback for given path. */
+    callback = find_route_callback(self_p, &request);
+
+    if (callback == NULL) {
+        callback = self_p->on_no_route;
+    }
+
+    /* Call the callback and write the response if requested. */
+    res = callback(connection_p, &request);
+
+    if (res < 0) {
+        return (res);
+    }
+
+    if (request.keep_alive == 0) {
+        return (1);
+    }
+
+    /* A request without a body. The connection is closed if the route
+       callback read from it, or may have read a body without a length
+       from the socket, as the next request cannot be found. */
+    if (connection_p->input.body.mode == BODY_MODE_RAW) {
+        return ((connection_p->input.body.raw > 0)
+                || (request.action == http_server_request_action_post_t));
+    }
+
+    return (input_skip_body(&connection_p->input));
+}
+
+/**
+ * Returns true(1) if there is buffered or received input on given
+ * connection.
+ */
+static int has_input(struct http_server_connection_t *connection_p)
+{
+    if (connection_p->input.buffer.pos < connection_p->input.buffer.size) {
+        return (1);
+    }
+
+    return (chan_size(connection_p->input.chan_p) > 0);
+}
+
+/**
+ * Wait for the next request on given connection. Returns zero(0)
+ * when input is available, or -ETIMEDOUT if the connection has been
+ * idle for too long.
+ */
+static int wait_for_request(struct http_server_connection_t *connection_p)
+{
+    struct time_t timeout;
+
+    if (has_input(connection_p)) {
+        return (0);
+    }
+
+    timeout.seconds = (CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS / 1000);
+    timeout.nanoseconds =
+        ((CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS % 1000) * 1000000L);
+
+    /* Encrypted input is also received on the socket. */
+    if (chan_poll(&connection_p->socket, &timeout) == NULL) {
+        log_object_print(NULL,
+                         LOG_DEBUG,
+                         OSTR("Closing idle connection.\r\n"));
+
+        return (-ETIMEDOUT);
+    }
+
+    return (0);
+}
+
+/**
+ * Prepare given accepted connection for its first request.
+ */
+static void connection_open(struct http_server_t *self_p,
+                            struct http_server_connection_t *connection_p)
+{
+#if CONFIG_HTTP_SERVER_SSL == 1
+    if (self_p->ssl_context_p != NULL) {
+        ssl_socket_open(&connection_p->ssl_socket,
+                        self_p->ssl_context_p,
+                        &connection_p->socket,
+                        SSL_SOCKET_SERVER_SIDE,
+                        NULL);
+    }
+#endif
+
+    connection_p->input.buffer.pos = 0;
+    connection_p->input.buffer.size = 0;
+    connection_p->input.body.mode = BODY_MODE_RAW;
+    connection_p->input.deadline.enabled = (self_p->number_of_connections > 0);
+}
+
+static void connection_close(struct http_server_t *self_p,
+                             struct http_server_connection_t *connection_p)
+{
+#if CONFIG_HTTP_SERVER_SSL == 1
+    if (self_p->ssl_context_p != NULL) {
+        (void)ssl_socket_close(&connection_p->ssl_socket);
+    }
+#endif
+
+    (void)socket_close(&connection_p->socket);
+}
+
+/**
+ * The connection thread serves a client for the duration of the
+ * socket lifetime. Requests are handled one after another on
+ * persistent connections, including pipelined requests.
+ */
+static void *connection_main(void *arg_p)
+{
+    struct http_server_connection_t *connection_p = arg_p;
+    struct http_server_t *self_p = connection_p->self_p;
+    uint32_t mask;
+
+    /* thrd_init_env(buf, sizeof(buf)); */
+    /* thrd_set_env("CWD", self_p->root_path_p); */
+    thrd_set_name(connection_p->thrd.name_p);
+
+    /* Wait for a connection from the listener. */
+    while (1) {
+        log_object_print(NULL,
+                         LOG_DEBUG,
+                         OSTR("Connection thread '%s' waiting for a new connection.\r\n"),
+                         thrd_get_name());
+
+        mask = 0x1;
+        event_read(&connection_p->events, &mask, sizeof(mask));
+
+        if (mask & 0x1) {
+            connection_open(self_p, connection_p);
+
+            while (wait_for_request(connection_p) == 0) {
+                if (handle_request(self_p, connection_p) != 0) {
+                    break;
+                }
+            }
+
+            connection_close(self_p, connection_p);
+
+            /* Add thread to the free list. */
+            sys_lock();
+            connection_p->state = http_server_connection_state_free_t;
+            sys_unlock();
+            mask = 0x1;
+            event_write(&self_p->events, &mask, sizeof(mask));
+        }
+    }
+
+    return (NULL);
 }
 
 static int handle_accept(struct http_server_t *self_p,
@@ -351,110 +1196,422 @@ static int handle_accept(struct http_server_t *self_p,
 {
     uint32_t mask;
 
-    mask = 0x1;
-    event_write(&connection_p->events, &mask, sizeof(mask));
+    mask = 0x1;
+    event_write(&connection_p->events, &mask, sizeof(mask));
+
+    return (0);
+}
+
+static struct http_server_connection_t *
+allocate_connection(struct http_server_t *self_p)
+{
+    uint32_t mask;
+    struct http_server_connection_t *connection_p;
+
+    while (1) {
+        sys_lock();
+
+        connection_p = self_p->connections_p;
+
+        while (connection_p->thrd.stack.buf_p != NULL) {
+            if (connection_p->state == http_server_connection_state_free_t) {
+                connection_p->state = http_server_connection_state_allocated_t;
+                break;
+            }
+
+            connection_p++;
+        }
+
+        sys_unlock();
+
+        /* Connection available. */
+        if (connection_p->thrd.name_p != NULL) {
+            break;
+        }
+
+        mask = 0x1;
+        event_read(&self_p->events, &mask, sizeof(mask));
+    }
+
+    return (connection_p);
+}
+
+/**
+ * Open the listener socket and start listening for connections.
+ */
+static int listener_open(struct http_server_t *self_p,
+                         int backlog)
+{
+    struct http_server_listener_t *listener_p;
+    struct inet_addr_t addr;
+
+    listener_p = self_p->listener_p;
+
+    if (socket_open_tcp(&listener_p->socket) != 0) {
+        log_object_print(NULL,
+                         LOG_ERROR,
+                         OSTR("failed to open socket\r\n"));
+        return (-1);
+    }
+
+    if (inet_aton(listener_p->address_p, &addr.ip) != 0) {
+        return (-1);
+    }
+
+    addr.port = listener_p->port;
+
+    if (socket_bind(&listener_p->socket, &addr) != 0) {
+        log_object_print(NULL,
+                         LOG_ERROR,
+                         OSTR("failed to bind socket\r\n"));
+        return (-1);
+    }
+
+    if (socket_listen(&listener_p->socket, backlog) != 0) {
+        log_object_print(NULL,
+                         LOG_ERROR,
+                         OSTR("failed to listen on socket\r\n"));
+        return (-1);
+    }
+
+    log_object_print(NULL,
+                     LOG_INFO,
+                     OSTR("serving HTTP on %s:%u\r\n"),
+                     listener_p->address_p,
+                     listener_p->port);
+
+    return (0);
+}
+
+/**
+ * The listener thread main function. The listener listens for
+ * connections from clients.
+ */
+static void *listener_main(void *arg_p)
+{
+    struct http_server_t *self_p = arg_p;
+    struct http_server_listener_t *listener_p;
+    struct http_server_connection_t *connection_p;
+    struct inet_addr_t addr;
+
+    thrd_set_name(self_p->listener_p->thrd.name_p);
+
+    listener_p = self_p->listener_p;
+
+    if (listener_open(self_p, 3) != 0) {
+        return (NULL);
+    }
+
+    /* Wait for clients to connect. */
+    while (1) {
+        /* Allocate a connection. */
+        connection_p = allocate_connection(self_p);
+
+        /* Wait for a client to connect. */
+        socket_accept(&listener_p->socket,
+                      &connection_p->socket,
+                      &addr);
+
+        handle_accept(self_p, connection_p);
+    }
+
+    return (NULL);
+}
+
+/**
+ * Returns true(1) if given connection has been idle for too long at
+ * given time.
+ */
+static int is_idle_expired(struct http_server_connection_t *connection_p,
+                           struct time_t *now_p)
+{
+    struct time_t idle;
+
+    time_subtract(&idle, now_p, &connection_p->timestamp);
+
+    return ((idle.seconds * 1000L + idle.nanoseconds / 1000000L)
+            >= CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS);
+}
+
+/**
+ * Accept a pending connection. If all connections are open the least
+ * recently used connection is closed to make room for the new one.
+ */
+static void multiplexer_accept(struct http_server_t *self_p,
+                               struct time_t *now_p)
+{
+    struct http_server_connection_t *connection_p;
+    struct http_server_connection_t *oldest_p;
+    struct inet_addr_t addr;
+    int i;
+
+    connection_p = NULL;
+    oldest_p = NULL;
+
+    for (i = 0; i < self_p->number_of_connections; i++) {
+        connection_p = &self_p->connections_p[i];
+
+        if (connection_p->state == http_server_connection_state_free_t) {
+            break;
+        }
+
+        if ((oldest_p == NULL)
+            || (time_compare(&connection_p->timestamp,
+                             &oldest_p->timestamp) == time_compare_less_than_t)) {
+            oldest_p = connection_p;
+        }
+    }
+
+    if (connection_p->state != http_server_connection_state_free_t) {
+        log_object_print(NULL,
+                         LOG_DEBUG,
+                         OSTR("Closing the least recently used connection.\r\n"));
+        connection_p = oldest_p;
+        connection_close(self_p, connection_p);
+        connection_p->state = http_server_connection_state_free_t;
+    }
+
+    if (socket_accept(&self_p->listener_p->socket,
+                      &connection_p->socket,
+                      &addr) != 0) {
+        return;
+    }
+
+    connection_open(self_p, connection_p);
+    connection_p->state = http_server_connection_state_allocated_t;
+    connection_p->timestamp = *now_p;
+}
+
+/**
+ * Read the data received on given connection into its input buffer,
+ * without blocking. Returns zero(0) or negative error code if the
+ * connection was closed by the client.
+ */
+static int multiplexer_receive(struct http_server_connection_t *connection_p)
+{
+    struct http_server_connection_input_t *input_p;
+    size_t size;
+    size_t left;
+
+    input_p = &connection_p->input;
+
+    /* Move a partial request to the beginning of the buffer to make
+       room for more data. */
+    if (input_p->buffer.pos > 0) {
+        size = (input_p->buffer.size - input_p->buffer.pos);
+        memmove(&input_p->buffer.buf[0],
+                &input_p->buffer.buf[input_p->buffer.pos],
+                size);
+        input_p->buffer.pos = 0;
+        input_p->buffer.size = size;
+    }
+
+    left = (sizeof(input_p->buffer.buf) - input_p->buffer.size);
+    size = chan_size(input_p->chan_p);
+
+    if (size > left) {
+        size = left;
+    }
+
+    if (size == 0) {
+        return (0);
+    }
+
+    /* The client has until the keep alive timeout to complete a new
+       request. */
+    if (input_p->buffer.size == 0) {
+        time_get(&connection_p->timestamp);
+    }
+
+    if (chan_read(input_p->chan_p,
+                  &input_p->buffer.buf[input_p->buffer.size],
+                  size) != size) {
+        return (-EIO);
+    }
+
+    input_p->buffer.size += size;
 
     return (0);
 }
 
-static struct http_server_connection_t *
-allocate_connection(struct http_server_t *self_p)
+/**
+ * Returns true(1) if the next request on given connection can be
+ * handled, that is, if it has been completely received or fills the
+ * input buffer.
+ */
+static int multiplexer_is_ready(struct http_server_connection_t *connection_p)
 {
-    uint32_t mask;
-    struct http_server_connection_t *connection_p;
+    struct http_server_connection_input_t *input_p;
 
-    while (1) {
-        sys_lock();
+    input_p = &connection_p->input;
 
-        connection_p = self_p->connections_p;
+    if (input_p->buffer.size == sizeof(input_p->buffer.buf)) {
+        return (1);
+    }
 
-        while (connection_p->thrd.stack.buf_p != NULL) {
-            if (connection_p->state == http_server_connection_state_free_t) {
-                connection_p->state = http_server_connection_state_allocated_t;
-                break;
-            }
+    return (input_has_request(input_p));
+}
 
-            connection_p++;
-        }
+/**
+ * Handle all requests received on given connection. The rest of a
+ * request not fitting in the input buffer must be received before
+ * the request timeout. Returns zero(0) if the connection shall be
+ * kept open.
+ */
+static int multiplexer_serve(struct http_server_t *self_p,
+                             struct http_server_connection_t *connection_p)
+{
+    int res;
+    struct http_server_connection_input_t *input_p;
+    struct time_t timeout;
 
-        sys_unlock();
+    input_p = &connection_p->input;
+    timeout.seconds = (CONFIG_HTTP_SERVER_REQUEST_TIMEOUT_MS / 1000);
+    timeout.nanoseconds =
+        ((CONFIG_HTTP_SERVER_REQUEST_TIMEOUT_MS % 1000) * 1000000L);
 
-        /* Connection available. */
-        if (connection_p->thrd.name_p != NULL) {
-            break;
+    /* Pipelined requests are handled right away. */
+    do {
+        time_get(&input_p->deadline.time);
+        time_add(&input_p->deadline.time, &input_p->deadline.time, &timeout);
+        res = handle_request(self_p, connection_p);
+
+        if (res != 0) {
+            return (res);
         }
+    } while (input_has_request(input_p));
 
-        mask = 0x1;
-        event_read(&self_p->events, &mask, sizeof(mask));
-    }
+    time_get(&connection_p->timestamp);
 
-    return (connection_p);
+    return (0);
 }
 
 /**
- * The listener thread main function. The listener listens for
- * connections from clients.
+ * The listener thread main function in multiplexed mode. The thread
+ * polls the listener socket and all open connections, and serves
+ * them as input arrives.
  */
-static void *listener_main(void *arg_p)
+static void *multiplexer_main(void *arg_p)
 {
     struct http_server_t *self_p = arg_p;
-    struct http_server_listener_t *listener_p;
     struct http_server_connection_t *connection_p;
-    struct inet_addr_t addr;
+    struct chan_t *workspace[CONFIG_HTTP_SERVER_CONNECTIONS_MAX + 1];
+    struct chan_list_t list;
+    struct time_t now;
+    struct time_t keep_alive;
+    struct time_t timeout;
+    struct time_t *timeout_p;
+    int i;
 
     thrd_set_name(self_p->listener_p->thrd.name_p);
 
-    listener_p = self_p->listener_p;
+    keep_alive.seconds = (CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS / 1000);
+    keep_alive.nanoseconds =
+        ((CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS % 1000) * 1000000L);
 
-    if (socket_open_tcp(&listener_p->socket) != 0) {
-        log_object_print(NULL,
-                         LOG_ERROR,
-                         OSTR("failed to open socket\r\n"));
+    if (listener_open(self_p, self_p->number_of_connections) != 0) {
         return (NULL);
     }
 
-    if (inet_aton(listener_p->address_p, &addr.ip) != 0) {
-        return (NULL);
-    }
+    while (1) {
+        chan_list_init(&list, &workspace[0], sizeof(workspace));
+        chan_list_add(&list, &self_p->listener_p->socket);
+        timeout_p = NULL;
 
-    addr.port = listener_p->port;
+        /* Wait until the oldest idle connection expires at most. */
+        for (i = 0; i < self_p->number_of_connections; i++) {
+            connection_p = &self_p->connections_p[i];
 
-    if (socket_bind(&listener_p->socket, &addr) != 0) {
-        log_object_print(NULL,
-                         LOG_ERROR,
-                         OSTR("failed to bind socket\r\n"));
-        return (NULL);
-    }
+            if (connection_p->state == http_server_connection_state_free_t) {
+                continue;
+            }
 
-    if (socket_listen(&listener_p->socket, 3) != 0) {
-        log_object_print(NULL,
-                         LOG_ERROR,
-                         OSTR("failed to listen on socket\r\n"));
-        return (NULL);
-    }
+            chan_list_add(&list, &connection_p->socket);
 
-    log_object_print(NULL,
-                     LOG_INFO,
-                     OSTR("serving HTTP on %s:%u\r\n"),
-                     listener_p->address_p,
-                     listener_p->port);
+            if ((timeout_p == NULL)
+                || (time_compare(&connection_p->timestamp,
+                                 timeout_p) == time_compare_less_than_t)) {
+                timeout = connection_p->timestamp;
+                timeout_p = &timeout;
+            }
+        }
 
-    /* Wait for clients to connect. */
-    while (1) {
-        /* Allocate a connection. */
-        connection_p = allocate_connection(self_p);
+        if (timeout_p != NULL) {
+            time_get(&now);
+            time_add(&timeout, &timeout, &keep_alive);
+            time_subtract(&timeout, &timeout, &now);
 
-        /* Wait for a client to connect. */
-        socket_accept(&listener_p->socket,
-                      &connection_p->socket,
-                      &addr);
+            if ((timeout.seconds < 0) || (timeout.nanoseconds < 0)) {
+                timeout.seconds = 0;
+                timeout.nanoseconds = 0;
+            }
+        }
 
-        handle_accept(self_p, connection_p);
+        (void)chan_list_poll(&list, timeout_p);
+        chan_list_destroy(&list);
+        time_get(&now);
+
+        /* Receive on all connections, serve the completely received
+           requests, and close idle connections. A partial request
+           is kept in the connection input buffer until the rest of
+           it is received. */
+        for (i = 0; i < self_p->number_of_connections; i++) {
+            connection_p = &self_p->connections_p[i];
+
+            if (connection_p->state == http_server_connection_state_free_t) {
+                continue;
+            }
+
+            if (multiplexer_receive(connection_p) == 0) {
+                if (multiplexer_is_ready(connection_p)) {
+                    if (multiplexer_serve(self_p, connection_p) == 0) {
+                        continue;
+                    }
+                } else if (!is_idle_expired(connection_p, &now)) {
+                    continue;
+                } else {
+                    log_object_print(NULL,
+                                     LOG_DEBUG,
+                                     OSTR("Closing idle connection.\r\n"));
+                }
+            }
+
+            connection_close(self_p, connection_p);
+            connection_p->state = http_server_connection_state_free_t;
+        }
+
+        if (chan_size(&self_p->listener_p->socket) > 0) {
+            multiplexer_accept(self_p, &now);
+        }
     }
 
     return (NULL);
 }
 
+/**
+ * Set up the buffered input channel the route callbacks read and
+ * write through.
+ */
+static void connection_init_chan(struct http_server_t *self_p,
+                                 struct http_server_connection_t *connection_p)
+{
+#if CONFIG_HTTP_SERVER_SSL == 1
+    if (self_p->ssl_context_p == NULL) {
+        connection_p->input.chan_p = &connection_p->socket;
+    } else {
+        connection_p->input.chan_p = &connection_p->ssl_socket;
+    }
+#else
+    connection_p->input.chan_p = &connection_p->socket;
+#endif
+
+    chan_init(&connection_p->input.base,
+              input_read,
+              input_write,
+              input_size);
+    connection_p->chan_p = &connection_p->input;
+}
+
 int http_server_init(struct http_server_t *self_p,
                      struct http_server_listener_t *listener_p,
                      struct http_server_connection_t *connections_p,
@@ -476,6 +1633,8 @@ int http_server_init(struct http_server_t *self_p,
     self_p->routes_p = routes_p;
     self_p->on_no_route = on_no_route;
     self_p->ssl_context_p = NULL;
+    self_p->number_of_connections = 0;
+    memset(&self_p->etags, 0, sizeof(self_p->etags));
 
     connection_p = self_p->connections_p;
 
@@ -489,7 +1648,42 @@ int http_server_init(struct http_server_t *self_p,
 
     event_init(&self_p->events);
 
-    return (0);
+    return (route_table_init(self_p, routes_p));
+}
+
+int http_server_init_multiplexed(struct http_server_t *self_p,
+                                 struct http_server_listener_t *listener_p,
+                                 struct http_server_connection_t *connections_p,
+                                 int length,
+                                 const char *root_path_p,
+                                 const struct http_server_route_t *routes_p,
+                                 http_server_route_callback_t on_no_route)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(listener_p != NULL, EINVAL)
+    ASSERTN(connections_p != NULL, EINVAL);
+    ASSERTN(length > 0, EINVAL);
+    ASSERTN(length <= CONFIG_HTTP_SERVER_CONNECTIONS_MAX, EINVAL);
+    ASSERTN(routes_p != NULL, EINVAL);
+    ASSERTN(on_no_route != NULL, EINVAL);
+
+    int i;
+
+    self_p->listener_p = listener_p;
+    self_p->connections_p = connections_p;
+    self_p->number_of_connections = length;
+    self_p->root_path_p = root_path_p;
+    self_p->routes_p = routes_p;
+    self_p->on_no_route = on_no_route;
+    self_p->ssl_context_p = NULL;
+    memset(&self_p->etags, 0, sizeof(self_p->etags));
+
+    for (i = 0; i < length; i++) {
+        connections_p[i].state = http_server_connection_state_free_t;
+        connections_p[i].self_p = self_p;
+    }
+
+    return (route_table_init(self_p, routes_p));
 }
 
 #if CONFIG_HTTP_SERVER_SSL == 1
@@ -500,6 +1694,12 @@ int http_server_wrap_ssl(struct http_server_t *self_p,
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(context_p != NULL, EINVAL);
 
+    /* The handshake would block all connections of a multiplexed
+       server. */
+    if (self_p->number_of_connections > 0) {
+        return (-ENOSYS);
+    }
+
     self_p->ssl_context_p = context_p;
 
     return (0);
@@ -512,6 +1712,24 @@ int http_server_start(struct http_server_t *self_p)
     ASSERTN(self_p != NULL, EINVAL);
 
     struct http_server_connection_t *connection_p;
+    int i;
+
+    /* All connections are served by the listener thread in
+       multiplexed mode. */
+    if (self_p->number_of_connections > 0) {
+        for (i = 0; i < self_p->number_of_connections; i++) {
+            connection_init_chan(self_p, &self_p->connections_p[i]);
+        }
+
+        self_p->listener_p->thrd.id_p =
+            thrd_spawn(multiplexer_main,
+                       self_p,
+                       0,
+                       self_p->listener_p->thrd.stack.buf_p,
+                       self_p->listener_p->thrd.stack.size);
+
+        return (0);
+    }
 
     /* Spawn the listener thread. */
     self_p->listener_p->thrd.id_p =
@@ -525,16 +1743,7 @@ int http_server_start(struct http_server_t *self_p)
 
     /* Spawn the connection threads. */
     while (connection_p->thrd.stack.buf_p != NULL) {
-#if CONFIG_HTTP_SERVER_SSL == 1
-        if (self_p->ssl_context_p == NULL) {
-            connection_p->chan_p = &connection_p->socket;
-        } else {
-            connection_p->chan_p = &connection_p->ssl_socket;
-        }
-#else
-        connection_p->chan_p = &connection_p->socket;
-#endif
-
+        connection_init_chan(self_p, connection_p);
         connection_p->thrd.id_p =
             thrd_spawn(connection_main,
                        connection_p,
@@ -596,6 +1805,21 @@ int http_server_response_write(struct http_server_connection_t *connection_p,
                            response_p->content.size);
     }
 
+    /* Write small content together with the header, as a single
+       segment, to not be delayed by the TCP Nagle algorithm. */
+    if ((response_p->content.buf_p != NULL)
+        && (response_p->content.size <= sizeof(buf) - size)) {
+        memcpy(&buf[size], response_p->content.buf_p, response_p->content.size);
+        size += response_p->content.size;
+        res = chan_write(connection_p->chan_p, buf, size);
+
+        if (res != size) {
+            return (-1);
+        }
+
+        return (response_p->content.size);
+    }
+
     res = chan_write(connection_p->chan_p, buf, size);
 
     if (res != size) {
@@ -617,3 +1841,310 @@ int http_server_response_write(struct http_server_connection_t *connection_p,
 
     return (res);
 }
+
+ssize_t http_server_request_get_param(struct http_server_request_t *request_p,
+                                      const char *name_p,
+                                      char *buf_p,
+                                      size_t size)
+{
+    ASSERTN(request_p != NULL, EINVAL);
+    ASSERTN(name_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    int i;
+    size_t length;
+    const char *param_name_p;
+
+    length = strlen(name_p);
+
+    for (i = 0; i < request_p->params.length; i++) {
+        param_name_p = request_p->params.entries[i].name_p;
+
+        if ((strncmp(param_name_p, name_p, length) != 0)
+            || ((param_name_p[length] != '/')
+                && (param_name_p[length] != '\0'))) {
+            continue;
+        }
+
+        if (request_p->params.entries[i].size >= size) {
+            return (-ENOMEM);
+        }
+
+        memcpy(buf_p,
+               request_p->params.entries[i].value_p,
+               request_p->params.entries[i].size);
+        buf_p[request_p->params.entries[i].size] = '\0';
+
+        return (request_p->params.entries[i].size);
+    }
+
+    return (-ENOENT);
+}
+
+/**
+ * Open the file with given request path in the root path, and get
+ * its size.
+ */
+static int static_file_open(struct http_server_t *self_p,
+                            struct fs_file_t *file_p,
+                            const char *request_path_p,
+                            char *path_p,
+                            size_t *size_p)
+{
+    ssize_t size;
+    size_t root_size;
+
+    /* Files outside the root path are not served. */
+    if (strstr(request_path_p, "..") != NULL) {
+        return (-ENOENT);
+    }
+
+    root_size = 0;
+    size = strcspn(request_path_p, "?");
+
+    if (self_p->root_path_p != NULL) {
+        root_size = strlen(self_p->root_path_p);
+
+        if (root_size + size >= CONFIG_FS_PATH_MAX) {
+            return (-ENOENT);
+        }
+
+        memcpy(&path_p[0], self_p->root_path_p, root_size);
+    } else if (size >= CONFIG_FS_PATH_MAX) {
+        return (-ENOENT);
+    }
+
+    memcpy(&path_p[root_size], request_path_p, size);
+    path_p[root_size + size] = '\0';
+
+    if (fs_open(file_p, path_p, FS_READ) != 0) {
+        return (-ENOENT);
+    }
+
+    /* Seeking does not read the file. */
+    if (fs_seek(file_p, 0, FS_SEEK_END) == 0) {
+        size = fs_tell(file_p);
+
+        if ((size >= 0) && (fs_seek(file_p, 0, FS_SEEK_SET) == 0)) {
+            *size_p = size;
+
+            return (0);
+        }
+    }
+
+    fs_close(file_p);
+
+    return (-EIO);
+}
+
+/**
+ * Get the entity tag crc of given file, calculating it if it is not
+ * remembered. The crc of the path identifies the file. A remembered
+ * crc is only used if no file has been modified since it was
+ * calculated, as the file may have been rewritten with the same
+ * size.
+ */
+static int static_file_get_crc(struct http_server_t *self_p,
+                               struct fs_file_t *file_p,
+                               const char *path_p,
+                               size_t size,
+                               char *buf_p,
+                               uint32_t *crc_p)
+{
+    int i;
+    uint32_t path_crc;
+    uint32_t generation;
+    uint32_t crc;
+    ssize_t res;
+    size_t left;
+
+    path_crc = crc_32(0, path_p, strlen(path_p));
+
+    /* Read before the file, so a modification while calculating the
+       crc makes the entry stale. */
+    generation = fs_get_generation();
+
+    sys_lock();
+
+    for (i = 0; i < membersof(self_p->etags.entries); i++) {
+        if ((self_p->etags.entries[i].path_crc == path_crc)
+            && (self_p->etags.entries[i].size == size)
+            && (self_p->etags.entries[i].generation == generation)) {
+            *crc_p = self_p->etags.entries[i].crc;
+            sys_unlock();
+
+            return (0);
+        }
+    }
+
+    sys_unlock();
+
+    crc = 0;
+    left = size;
+
+    while (left > 0) {
+        res = fs_read(file_p,
+                      buf_p,
+                      MIN(left, CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE));
+
+        if (res <= 0) {
+            return (-EIO);
+        }
+
+        crc = crc_32(crc, buf_p, res);
+        left -= res;
+    }
+
+    if (fs_seek(file_p, 0, FS_SEEK_SET) != 0) {
+        return (-EIO);
+    }
+
+    /* Replace the oldest remembered tag. */
+    sys_lock();
+    i = self_p->etags.next;
+    self_p->etags.entries[i].path_crc = path_crc;
+    self_p->etags.entries[i].size = size;
+    self_p->etags.entries[i].generation = generation;
+    self_p->etags.entries[i].crc = crc;
+    self_p->etags.next = ((i + 1) % membersof(self_p->etags.entries));
+    sys_unlock();
+
+    *crc_p = crc;
+
+    return (0);
+}
+
+static const char *static_file_content_type(const char *path_p)
+{
+    int i;
+    const char *extension_p;
+
+    extension_p = strrchr(path_p, '.');
+
+    if (extension_p != NULL) {
+        for (i = 0; i < membersof(content_types); i++) {
+            if (strcmp(extension_p, content_types[i].extension_p) == 0) {
+                return (content_types[i].content_type_p);
+            }
+        }
+    }
+
+    return ("application/octet-stream");
+}
+
+/**
+ * Write the response header and the file, reading it in chunks. The
+ * first chunk is written together with the header.
+ */
+static int static_file_write(struct http_server_connection_t *connection_p,
+                             struct fs_file_t *file_p,
+                             const char *path_p,
+                             size_t size,
+                             const char *etag_p,
+                             char *buf_p)
+{
+    ssize_t res;
+    size_t pos;
+
+    pos = std_sprintf(buf_p,
+                      static_file_fmt,
+                      static_file_content_type(path_p),
+                      (unsigned long)size,
+                      etag_p);
+
+    while (1) {
+        if ((size > 0) && (pos < CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE)) {
+            res = fs_read(file_p,
+                          &buf_p[pos],
+                          MIN(size,
+                              CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE - pos));
+
+            if (res <= 0) {
+                return (-EIO);
+            }
+
+            pos += res;
+            size -= res;
+        }
+
+        if (chan_write(connection_p->chan_p, buf_p, pos) != pos) {
+            return (-EIO);
+        }
+
+        if (size == 0) {
+            break;
+        }
+
+        pos = 0;
+    }
+
+    return (0);
+}
+
+int http_server_static_file(struct http_server_connection_t *connection_p,
+                            struct http_server_request_t *request_p)
+{
+    ASSERTN(connection_p != NULL, EINVAL);
+    ASSERTN(request_p != NULL, EINVAL);
+
+    int res;
+    struct fs_file_t file;
+    struct http_server_response_t response;
+    char path[CONFIG_FS_PATH_MAX];
+    char buf[CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE];
+    char etag[24];
+    size_t size;
+    uint32_t crc;
+
+    if ((request_p->action != http_server_request_action_get_t)
+        || (static_file_open(connection_p->self_p,
+                             &file,
+                             request_p->path,
+                             &path[0],
+                             &size) != 0)) {
+        response.code = http_server_response_code_404_not_found_t;
+        response.content.type = http_server_content_type_text_plain_t;
+        response.content.buf_p = NULL;
+        response.content.size = 0;
+
+        res = http_server_response_write(connection_p, request_p, &response);
+
+        return (res < 0 ? res : 0);
+    }
+
+    res = static_file_get_crc(connection_p->self_p,
+                              &file,
+                              &path[0],
+                              size,
+                              &buf[0],
+                              &crc);
+
+    if (res == 0) {
+        std_sprintf(&etag[0],
+                    FSTR("\"%lx-%lx\""),
+                    (unsigned long)size,
+                    (unsigned long)crc);
+
+        /* The client already has the file. */
+        if ((request_p->headers.if_none_match.present == 1)
+            && (strstr(request_p->headers.if_none_match.value,
+                       &etag[0]) != NULL)) {
+            size = std_sprintf(&buf[0], not_modified_fmt, &etag[0]);
+
+            if (chan_write(connection_p->chan_p, &buf[0], size) != size) {
+                res = -EIO;
+            }
+        } else {
+            res = static_file_write(connection_p,
+                                    &file,
+                                    &path[0],
+                                    size,
+                                    &etag[0],
+                                    &buf[0]);
+        }
+    }
+
+    fs_close(&file);
+
+    return (res);
+}
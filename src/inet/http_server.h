@@ -54,6 +54,7 @@ enum http_server_content_type_t {
  */
 enum http_server_response_code_t {
     http_server_response_code_200_ok_t = 200,
+    http_server_response_code_304_not_modified_t = 304,
     http_server_response_code_400_bad_request_t = 400,
     http_server_response_code_401_unauthorized_t = 401,
     http_server_response_code_404_not_found_t = 404
@@ -94,7 +95,34 @@ struct http_server_request_t {
             int present;
             char value[20];
         } expect;
+        struct {
+            int present;
+            char value[24];
+        } connection;
+        struct {
+            int present;
+            char value[16];
+        } transfer_encoding;
+        struct {
+            int present;
+            char value[40];
+        } if_none_match;
     } headers;
+    /* Path parameters of the matching route. */
+    struct {
+        int length;
+        struct {
+            /* Parameter name in the route path, after the ':'. */
+            const char *name_p;
+            /* Value in the request path. Not null terminated. */
+            const char *value_p;
+            size_t size;
+        } entries[CONFIG_HTTP_SERVER_ROUTE_PARAMS_MAX];
+    } params;
+    /* Non-zero if the connection is kept open for another request
+       after this one. Set to zero in the route callback to close the
+       connection after the response. */
+    int keep_alive;
 };
 
 /**
@@ -129,6 +157,32 @@ struct http_server_listener_t {
     struct socket_t socket;
 };
 
+/**
+ * Buffered connection input. The request line and the headers are
+ * parsed in the buffer, and the route callbacks read the request
+ * body, or the upgraded protocol data, through the channel.
+ */
+struct http_server_connection_input_t {
+    struct chan_t base;
+    void *chan_p;
+    struct {
+        char buf[CONFIG_HTTP_SERVER_REQUEST_BUFFER_SIZE];
+        size_t pos;
+        size_t size;
+    } buffer;
+    struct {
+        int mode;
+        long left;
+        size_t raw;
+    } body;
+    /* Reads from the transport time out at this time in multiplexed
+       mode. */
+    struct {
+        int enabled;
+        struct time_t time;
+    } deadline;
+};
+
 struct http_server_connection_t {
     enum http_server_connection_state_t state;
     struct {
@@ -144,24 +198,62 @@ struct http_server_connection_t {
 #if CONFIG_HTTP_SERVER_SSL == 1
     struct ssl_socket_t ssl_socket;
 #endif
+    struct http_server_connection_input_t input;
+    /* Route callbacks read the request body from, and write the
+       response to, this channel. Part of the body may already be
+       buffered, so do not read from the socket directly. */
     void *chan_p;
     struct event_t events;
+    /* Time of the last request, or of the first received byte of a
+       partial request, in multiplexed mode. */
+    struct time_t timestamp;
 };
 
 /**
- * Call given callback for given path.
+ * Call given callback for given path. A path segment starting with
+ * ``:`` is a parameter matching any non-empty segment, for example
+ * ``/users/:id``. A last path segment ``*`` matches the rest of the
+ * path, for example /static/\*. Get the values with
+ * `http_server_request_get_param()`.
  */
 struct http_server_route_t {
     const char *path_p;
     http_server_route_callback_t callback;
 };
 
+/**
+ * A path segment in the route table.
+ */
+struct http_server_route_node_t {
+    const char *segment_p;
+    size_t size;
+    http_server_route_callback_t callback;
+    struct http_server_route_node_t *children_p;
+    struct http_server_route_node_t *next_p;
+};
+
 struct http_server_t {
     const char *root_path_p;
     const struct http_server_route_t *routes_p;
     http_server_route_callback_t on_no_route;
+    /* The routes compiled into a tree of path segments. */
+    struct {
+        struct http_server_route_node_t root;
+        struct http_server_route_node_t nodes[CONFIG_HTTP_SERVER_ROUTE_NODES_MAX];
+    } route_table;
+    /* Recently calculated static file entity tags. */
+    struct {
+        struct {
+            uint32_t path_crc;
+            uint32_t size;
+            uint32_t generation;
+            uint32_t crc;
+        } entries[CONFIG_HTTP_SERVER_STATIC_FILE_ETAGS_MAX];
+        int next;
+    } etags;
     struct http_server_listener_t *listener_p;
     struct http_server_connection_t *connections_p;
+    int number_of_connections;
     struct ssl_context_t *ssl_context_p;
     struct event_t events;
 };
@@ -173,12 +265,18 @@ struct http_server_t {
  * @param[in] self_p Http server to initialize.
  * @param[in] listener_p Listener.
  * @param[in] connections_p A NULL terminated list of connections.
- * @param[in] root_path_p Working directory for the connection threads.
- * @param[in] routes_p An array of routes.
+ * @param[in] root_path_p Directory of the files served by
+ *                        `http_server_static_file()`, or NULL.
+ * @param[in] routes_p An array of routes. It is compiled into a route
+ *                     table, so lookups do not depend on the number
+ *                     of routes. The first of several matching routes
+ *                     is preferred, but exact path segments always
+ *                     take precedence over parameters and wildcards.
  * @param[in] on_no_route Callback called for all requests without a
  *                        matching route in route_p.
  *
- * @return zero(0) or negative error code.
+ * @return zero(0) or negative error code. -ENOMEM if the route table
+ *         is too small for given routes.
  */
 int http_server_init(struct http_server_t *self_p,
                      struct http_server_listener_t *listener_p,
@@ -187,16 +285,62 @@ int http_server_init(struct http_server_t *self_p,
                      const struct http_server_route_t *routes_p,
                      http_server_route_callback_t on_no_route);
 
+/**
+ * Initialize given http server in multiplexed mode. All connections
+ * are served by the listener thread, which polls the listener socket
+ * and the open connections, and handles requests as they arrive. The
+ * connections have no threads, so many more persistent connections
+ * can be kept open in the same amount of RAM. The least recently used
+ * connection is closed when a client connects and all connections are
+ * open.
+ *
+ * Received data is buffered per connection, and a request is handled
+ * first when it has been completely received, or fills the request
+ * buffer. A connection is closed if a started request is not complete
+ * within ``CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS``, so slow clients
+ * do not delay other connections. The rest of a request not fitting
+ * in the buffer is read while handling it, and the connection is
+ * closed if it is not received within
+ * ``CONFIG_HTTP_SERVER_REQUEST_TIMEOUT_MS``.
+ *
+ * Route callbacks must not block for long, as no other connection is
+ * served meanwhile. Use `http_server_init()` for long lived
+ * connections, for example websockets, and for SSL.
+ *
+ * @param[in] self_p Http server to initialize.
+ * @param[in] listener_p Listener. Its thread serves all connections.
+ * @param[in] connections_p An array of connections. Their thread
+ *                          members are not used.
+ * @param[in] length Number of connections in the array, at most
+ *                   ``CONFIG_HTTP_SERVER_CONNECTIONS_MAX``.
+ * @param[in] root_path_p Directory of the files served by
+ *                        `http_server_static_file()`, or NULL.
+ * @param[in] routes_p An array of routes. See `http_server_init()`.
+ * @param[in] on_no_route Callback called for all requests without a
+ *                        matching route in route_p.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_server_init_multiplexed(struct http_server_t *self_p,
+                                 struct http_server_listener_t *listener_p,
+                                 struct http_server_connection_t *connections_p,
+                                 int length,
+                                 const char *root_path_p,
+                                 const struct http_server_route_t *routes_p,
+                                 http_server_route_callback_t on_no_route);
+
 /**
  * Wrap given HTTP server in SSL, to make it secure.
  *
  * This function must be called after `http_server_init()` and before
- * `http_server_start()`.
+ * `http_server_start()`. Multiplexed servers cannot be wrapped in
+ * SSL, as the handshake blocks until completed.
  *
  * @param[in] self_p Http server to wrap in SSL.
  * @param[in] context_p SSL context to wrap the server in.
  *
- * @return zero(0) or negative error code.
+ * @return zero(0) or negative error code. -ENOSYS for a multiplexed
+ *         server.
  */
 int http_server_wrap_ssl(struct http_server_t *self_p,
                          struct ssl_context_t *context_p);
@@ -243,4 +387,45 @@ int http_server_response_write(struct http_server_connection_t *connection_p,
                                struct http_server_request_t *request_p,
                                struct http_server_response_t *response_p);
 
+/**
+ * Copy the value of given path parameter of the current request into
+ * given buffer as a null terminated string. The wildcard at the end
+ * of a route path is named ``*``.
+ *
+ * @param[in] request_p Current request.
+ * @param[in] name_p Parameter name, without the ``:``.
+ * @param[out] buf_p Buffer to copy the value into.
+ * @param[in] size Size of the buffer.
+ *
+ * @return Length of the value or negative error code. -ENOENT if the
+ *         route has no such parameter, and -ENOMEM if the value does
+ *         not fit in the buffer.
+ */
+ssize_t http_server_request_get_param(struct http_server_request_t *request_p,
+                                      const char *name_p,
+                                      char *buf_p,
+                                      size_t size);
+
+/**
+ * Route callback responding with the file with the request path,
+ * without the query string, in the root path of the server. Files
+ * are read in chunks of ``CONFIG_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE``
+ * bytes and sent with an ``ETag`` header. The file is not read if the
+ * client has a cached copy with the same tag in its
+ * ``If-None-Match`` header, except to calculate the tag the first
+ * time, as recently calculated tags are remembered until a file is
+ * modified, see `fs_get_generation()`. Responds with 404 Not Found
+ * if there is no such file.
+ *
+ * Add it to the routes array with a wildcard path, for example
+ * /static/\*, or use it as the no route callback.
+ *
+ * @param[in] connection_p Current connection.
+ * @param[in] request_p Current request.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_server_static_file(struct http_server_connection_t *connection_p,
+                            struct http_server_request_t *request_p);
+
 #endif
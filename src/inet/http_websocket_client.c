@@ -30,6 +30,89 @@
 
 #include "simba.h"
 
+/**
+ * Encode a masked frame header for given payload size. Returns the
+ * header size.
+ */
+static size_t encode_header(uint8_t *header_p,
+                            int type,
+                            uint32_t size,
+                            const uint8_t *masking_key_p)
+{
+    size_t header_size = 2;
+
+    header_p[0] = (INET_HTTP_WEBSOCKET_FIN | type);
+
+    if (size < 126) {
+        header_p[1] = (INET_HTTP_WEBSOCKET_MASK | size);
+    } else if (size < 65536) {
+        header_p[1] = (INET_HTTP_WEBSOCKET_MASK | 126);
+        header_p[2] = ((size >> 8) & 0xff);
+        header_p[3] = ((size >> 0) & 0xff);
+        header_size += 2;
+    } else {
+        header_p[1] = (INET_HTTP_WEBSOCKET_MASK | 127);
+        header_p[2] = 0;
+        header_p[3] = 0;
+        header_p[4] = 0;
+        header_p[5] = 0;
+        header_p[6] = ((size >> 24) & 0xff);
+        header_p[7] = ((size >> 16) & 0xff);
+        header_p[8] = ((size >>  8) & 0xff);
+        header_p[9] = ((size >>  0) & 0xff);
+        header_size += 8;
+    }
+
+    memcpy(&header_p[header_size], masking_key_p, 4);
+    header_size += 4;
+
+    return (header_size);
+}
+
+/**
+ * Read the header of the next frame.
+ */
+static int read_frame_header(struct http_websocket_client_t *self_p)
+{
+    uint8_t buf[10];
+
+    if (socket_read(&self_p->server.socket, buf, 2) != 2) {
+        return (-EIO);
+    }
+
+    self_p->frame.masked = ((buf[1] & INET_HTTP_WEBSOCKET_MASK) != 0);
+    self_p->frame.left = (buf[1] & ~INET_HTTP_WEBSOCKET_MASK);
+
+    if (self_p->frame.left == 126) {
+        if (socket_read(&self_p->server.socket, &buf[2], 2) != 2) {
+            return (-EIO);
+        }
+
+        self_p->frame.left = ((uint32_t)(buf[2]) << 8 | buf[3]);
+    } else if (self_p->frame.left == 127) {
+        if (socket_read(&self_p->server.socket, &buf[2], 8) != 8) {
+            return (-EIO);
+        }
+
+        self_p->frame.left = ((uint32_t)(buf[6]) << 24
+                              | (uint32_t)(buf[7]) << 16
+                              | (uint32_t)(buf[8]) << 8
+                              | buf[9]);
+    }
+
+    if (self_p->frame.masked == 1) {
+        if (socket_read(&self_p->server.socket,
+                        &self_p->frame.masking_key[0],
+                        4) != 4) {
+            return (-EIO);
+        }
+    }
+
+    self_p->frame.pos = 0;
+
+    return (0);
+}
+
 static int readline(struct http_websocket_client_t *self_p,
                     const FAR char *expected_p,
                     size_t size)
@@ -101,6 +184,10 @@ int http_websocket_client_connect(struct http_websocket_client_t *self_p)
     int res;
     struct inet_addr_t server_addr;
 
+    self_p->frame.left = 0;
+    self_p->write.left = 0;
+    self_p->write.header_size = 0;
+
     /* Open a TCP socket and connect to the server. */
     if (socket_open_tcp(&self_p->server.socket) != 0) {
         return (-EIO);
@@ -159,57 +246,43 @@ ssize_t http_websocket_client_read(struct http_websocket_client_t *self_p,
     ASSERTN(buf_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
-    uint8_t buf[16];
-    size_t left = size, n;
+    uint8_t *b_p;
+    size_t left;
+    size_t n;
+    int res;
+
+    b_p = buf_p;
+    left = size;
 
     while (left > 0) {
-        /* Read buffered frame data. */
-        if (self_p->frame.left > 0) {
-            if (left > self_p->frame.left) {
-                n = self_p->frame.left;
-            } else {
-                n = left;
-            }
+        if (self_p->frame.left == 0) {
+            res = read_frame_header(self_p);
 
-            if (socket_read(&self_p->server.socket, buf_p, n) != n) {
-                return (-EIO);
+            if (res != 0) {
+                return (res);
             }
 
-            self_p->frame.left -= n;
-            left -= n;
+            continue;
         }
 
-        if (left > 0) {
-            /* Read the next frame. */
-            if (socket_read(&self_p->server.socket, buf, 2) != 2) {
-                return (-EIO);
-            }
-
-            self_p->frame.left = (buf[1] & ~INET_HTTP_WEBSOCKET_MASK);
-
-            if (self_p->frame.left == 126) {
-                if (socket_read(&self_p->server.socket, &buf[2], 2) != 2) {
-                    return (-EIO);
-                }
-
-                self_p->frame.left = ((uint32_t)(buf[2]) << 8 | buf[3]);
-            } else if (self_p->frame.left == 127) {
-                if (socket_read(&self_p->server.socket, &buf[2], 8) != 8) {
-                    return (-EIO);
-                }
+        /* Read buffered frame data. */
+        n = MIN(left, self_p->frame.left);
 
-                self_p->frame.left = ((uint32_t)(buf[6]) << 24
-                                      | (uint32_t)(buf[7]) << 16
-                                      | (uint32_t)(buf[8]) << 8
-                                      | buf[9]);
-            }
+        if (socket_read(&self_p->server.socket, b_p, n) != n) {
+            return (-EIO);
+        }
 
-            if (buf[1] & INET_HTTP_WEBSOCKET_MASK) {
-                if (socket_read(&self_p->server.socket, buf, 4) != 4) {
-                    return (-EIO);
-                }
-            }
+        if (self_p->frame.masked == 1) {
+            self_p->frame.pos = inet_http_websocket_mask(
+                b_p,
+                n,
+                &self_p->frame.masking_key[0],
+                self_p->frame.pos);
         }
+
+        self_p->frame.left -= n;
+        b_p += n;
+        left -= n;
     }
 
     return (size);
@@ -224,47 +297,92 @@ ssize_t http_websocket_client_write(struct http_websocket_client_t *self_p,
     ASSERTN(buf_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
-    const uint8_t masking_key[4] = { 0x00, 0x00, 0x00, 0x00 };
-    uint8_t header[16];
-    size_t header_size = 2;
+    int res;
 
-    header[0] = (INET_HTTP_WEBSOCKET_FIN | type);
+    res = http_websocket_client_write_begin(self_p, type, size);
 
-    if (size < 126) {
-        header[1] = (INET_HTTP_WEBSOCKET_MASK | size);
-    } else if (size < 65536) {
-        header[1] = (INET_HTTP_WEBSOCKET_MASK | 126);
-        header[2] = ((size >> 8) & 0xff);
-        header[3] = ((size >> 0) & 0xff);
-        header_size += 2;
-    } else {
-        header[1] = (INET_HTTP_WEBSOCKET_MASK | 127);
-        header[2] = 0;
-        header[3] = 0;
-        header[4] = 0;
-        header[5] = 0;
-        header[6] = ((size >> 24) & 0xff);
-        header[7] = ((size >> 16) & 0xff);
-        header[8] = ((size >>  8) & 0xff);
-        header[9] = ((size >>  0) & 0xff);
-        header_size += 8;
+    if (res != 0) {
+        return (res);
     }
 
-    header[header_size + 0] = masking_key[0];
-    header[header_size + 1] = masking_key[1];
-    header[header_size + 2] = masking_key[2];
-    header[header_size + 3] = masking_key[3];
-    header_size += 4;
+    return (http_websocket_client_write_chunk(self_p, buf_p, size));
+}
 
-    if (socket_write(&self_p->server.socket,
-                     header,
-                     header_size) != header_size) {
-        return (-EIO);
+int http_websocket_client_write_begin(struct http_websocket_client_t *self_p,
+                                      int type,
+                                      uint32_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    memset(&self_p->write.masking_key[0],
+           0,
+           sizeof(self_p->write.masking_key));
+    self_p->write.header_size = encode_header(&self_p->write.header[0],
+                                              type,
+                                              size,
+                                              &self_p->write.masking_key[0]);
+    self_p->write.left = size;
+    self_p->write.pos = 0;
+
+    /* The header is written with the first payload chunk, if any. */
+    if (size == 0) {
+        if (socket_write(&self_p->server.socket,
+                         &self_p->write.header[0],
+                         self_p->write.header_size)
+            != self_p->write.header_size) {
+            return (-EIO);
+        }
+
+        self_p->write.header_size = 0;
     }
 
-    if (socket_write(&self_p->server.socket, buf_p, size) != size) {
-        return (-EIO);
+    return (0);
+}
+
+ssize_t http_websocket_client_write_chunk(struct http_websocket_client_t *self_p,
+                                          const void *buf_p,
+                                          size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size <= self_p->write.left, EINVAL);
+
+    uint8_t buf[CONFIG_HTTP_WEBSOCKET_WRITE_BUFFER_SIZE];
+    const uint8_t *b_p;
+    size_t pos;
+    size_t n;
+    size_t left;
+
+    b_p = buf_p;
+    left = size;
+
+    /* The frame header is written together with the first part of
+       the payload. */
+    pos = self_p->write.header_size;
+    memcpy(&buf[0], &self_p->write.header[0], pos);
+    self_p->write.header_size = 0;
+
+    /* Mask the payload in the buffer, one buffer at a time. */
+    while (left > 0) {
+        n = MIN(left, sizeof(buf) - pos);
+        memcpy(&buf[pos], b_p, n);
+        self_p->write.pos = inet_http_websocket_mask(
+            &buf[pos],
+            n,
+            &self_p->write.masking_key[0],
+            self_p->write.pos);
+        pos += n;
+
+        if (socket_write(&self_p->server.socket, &buf[0], pos) != pos) {
+            return (-EIO);
+        }
+
+        b_p += n;
+        left -= n;
+        pos = 0;
     }
 
+    self_p->write.left -= size;
+
     return (size);
 }
@@ -41,7 +41,17 @@ struct http_websocket_client_t {
     } server;
     struct {
         size_t left;
+        uint8_t masking_key[4];
+        int8_t pos;
+        int8_t masked;
     } frame;
+    struct {
+        uint32_t left;
+        uint8_t header[14];
+        uint8_t header_size;
+        uint8_t masking_key[4];
+        int8_t pos;
+    } write;
     const char *path_p;
 };
 
@@ -105,4 +115,35 @@ ssize_t http_websocket_client_write(struct http_websocket_client_t *self_p,
                                     const void *buf_p,
                                     uint32_t size);
 
+/**
+ * Start writing a message of given size to given http. Write the
+ * message payload with one or more calls to
+ * `http_websocket_client_write_chunk()`. The frame header is written
+ * together with the first payload chunk.
+ *
+ * @param[in] self_p Http to write to.
+ * @param[in] type One of ``HTTP_TYPE_TEXT`` and ``HTTP_TYPE_BINARY``.
+ * @param[in] size Total number of payload bytes in the message.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_websocket_client_write_begin(struct http_websocket_client_t *self_p,
+                                      int type,
+                                      uint32_t size);
+
+/**
+ * Mask and write the next part of the message payload, started by
+ * `http_websocket_client_write_begin()`.
+ *
+ * @param[in] self_p Http to write to.
+ * @param[in] buf_p Buffer to write.
+ * @param[in] size Number of bytes to write. Must not exceed the
+ *                 number of payload bytes left in the message.
+ *
+ * @return Number of bytes written or negative error code.
+ */
+ssize_t http_websocket_client_write_chunk(struct http_websocket_client_t *self_p,
+                                          const void *buf_p,
+                                          size_t size);
+
 #endif
@@ -30,6 +30,127 @@
 
 #include "simba.h"
 
+/**
+ * Encode a frame header for given payload size. Returns the header
+ * size.
+ */
+static size_t encode_header(uint8_t *header_p,
+                            int type,
+                            uint32_t size)
+{
+    size_t header_size = 2;
+
+    header_p[0] = (INET_HTTP_WEBSOCKET_FIN | type);
+
+    if (size < 126) {
+        header_p[1] = size;
+    } else if (size < 65536) {
+        header_p[1] = 126;
+        header_p[2] = ((size >> 8) & 0xff);
+        header_p[3] = ((size >> 0) & 0xff);
+        header_size += 2;
+    } else {
+        header_p[1] = 127;
+        header_p[2] = 0;
+        header_p[3] = 0;
+        header_p[4] = 0;
+        header_p[5] = 0;
+        header_p[6] = ((size >> 24) & 0xff);
+        header_p[7] = ((size >> 16) & 0xff);
+        header_p[8] = ((size >>  8) & 0xff);
+        header_p[9] = ((size >>  0) & 0xff);
+        header_size += 8;
+    }
+
+    return (header_size);
+}
+
+/**
+ * Read the header of the next frame.
+ */
+static int read_frame_header(struct http_websocket_server_t *self_p,
+                             int *type_p)
+{
+    uint8_t buf[10];
+
+    if (socket_read(self_p->socket_p, buf, 2) != 2) {
+        return (-EIO);
+    }
+
+    if (type_p != NULL) {
+        *type_p = (buf[0] & 0x0f);
+    }
+
+    self_p->read.fin = ((buf[0] & INET_HTTP_WEBSOCKET_FIN) != 0);
+    self_p->read.masked = ((buf[1] & INET_HTTP_WEBSOCKET_MASK) != 0);
+    self_p->read.left = (buf[1] & ~INET_HTTP_WEBSOCKET_MASK);
+
+    if (self_p->read.left == 126) {
+        if (socket_read(self_p->socket_p, &buf[2], 2) != 2) {
+            return (-EIO);
+        }
+
+        self_p->read.left = ((uint32_t)(buf[2]) << 8 | buf[3]);
+    } else if (self_p->read.left == 127) {
+        if (socket_read(self_p->socket_p, &buf[2], 8) != 8) {
+            return (-EIO);
+        }
+
+        self_p->read.left = ((uint32_t)(buf[6]) << 24
+                             | (uint32_t)(buf[7]) << 16
+                             | (uint32_t)(buf[8]) << 8
+                             | buf[9]);
+    }
+
+    /* Read the mask. */
+    if (self_p->read.masked == 1) {
+        if (socket_read(self_p->socket_p,
+                        &self_p->read.masking_key[0],
+                        4) != 4) {
+            return (-EIO);
+        }
+    }
+
+    self_p->read.pos = 0;
+
+    return (0);
+}
+
+/**
+ * Discard the rest of the message being read, many bytes per socket
+ * read.
+ */
+static int discard(struct http_websocket_server_t *self_p)
+{
+    uint8_t buf[32];
+    size_t n;
+    int res;
+
+    while (1) {
+        while (self_p->read.left > 0) {
+            n = MIN(self_p->read.left, sizeof(buf));
+
+            if (socket_read(self_p->socket_p, buf, n) != n) {
+                return (-EIO);
+            }
+
+            self_p->read.left -= n;
+        }
+
+        if (self_p->read.fin == 1) {
+            break;
+        }
+
+        res = read_frame_header(self_p, NULL);
+
+        if (res != 0) {
+            return (res);
+        }
+    }
+
+    return (0);
+}
+
 int http_websocket_server_init(struct http_websocket_server_t *self_p,
                                struct socket_t *socket_p)
 {
@@ -37,6 +158,10 @@ int http_websocket_server_init(struct http_websocket_server_t *self_p,
     ASSERTN(socket_p != NULL, EINVAL)
 
     self_p->socket_p = socket_p;
+    self_p->read.left = 0;
+    self_p->read.fin = 1;
+    self_p->write.left = 0;
+    self_p->write.header_size = 0;
 
     return (0);
 }
@@ -99,6 +224,66 @@ int http_websocket_server_handshake(struct http_websocket_server_t *self_p,
     return (0);
 }
 
+int http_websocket_server_read_begin(struct http_websocket_server_t *self_p,
+                                     int *type_p)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(type_p != NULL, EINVAL)
+
+    int res;
+
+    /* Discard leftover data of the previous message. */
+    res = discard(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (read_frame_header(self_p, type_p));
+}
+
+ssize_t http_websocket_server_read_chunk(struct http_websocket_server_t *self_p,
+                                         void *buf_p,
+                                         size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(buf_p != NULL, EINVAL)
+    ASSERTN(size > 0, EINVAL)
+
+    int res;
+    size_t n;
+
+    /* Continue in the next frame at the end of a fragment. */
+    while (self_p->read.left == 0) {
+        if (self_p->read.fin == 1) {
+            return (0);
+        }
+
+        res = read_frame_header(self_p, NULL);
+
+        if (res != 0) {
+            return (res);
+        }
+    }
+
+    n = MIN(size, self_p->read.left);
+
+    if (socket_read(self_p->socket_p, buf_p, n) != n) {
+        return (-EIO);
+    }
+
+    if (self_p->read.masked == 1) {
+        self_p->read.pos = inet_http_websocket_mask(buf_p,
+                                                    n,
+                                                    &self_p->read.masking_key[0],
+                                                    self_p->read.pos);
+    }
+
+    self_p->read.left -= n;
+
+    return (n);
+}
+
 ssize_t http_websocket_server_read(struct http_websocket_server_t *self_p,
                                    int *type_p,
                                    void *buf_p,
@@ -108,84 +293,112 @@ ssize_t http_websocket_server_read(struct http_websocket_server_t *self_p,
     ASSERTN(buf_p != NULL, EINVAL)
     ASSERTN(size > 0, EINVAL)
 
-    uint8_t buf[16], *b_p = buf_p;
-    size_t payload_left, left = size, n;
-    int fin = 0;
-    uint8_t masking_key[4];
-    int pos;
-    int i;
+    ssize_t res;
+    uint8_t *b_p;
+    size_t left;
 
-    while (fin == 0) {
-        /* Read the next frame. */
-        if (socket_read(self_p->socket_p, buf, 2) != 2) {
-            return (-EIO);
-        }
+    res = http_websocket_server_read_begin(self_p, type_p);
 
-        fin = (buf[0] & INET_HTTP_WEBSOCKET_FIN);
-        payload_left = (buf[1] & ~INET_HTTP_WEBSOCKET_MASK);
+    if (res != 0) {
+        return (res);
+    }
 
-        if (payload_left == 126) {
-            if (socket_read(self_p->socket_p, &buf[2], 2) != 2) {
-                return (-EIO);
-            }
+    b_p = buf_p;
+    left = size;
 
-            payload_left = ((uint32_t)(buf[2]) << 8 | buf[3]);
-        } else if (payload_left == 127) {
-            if (socket_read(self_p->socket_p, &buf[2], 8) != 8) {
-                return (-EIO);
-            }
+    while (left > 0) {
+        res = http_websocket_server_read_chunk(self_p, b_p, left);
 
-            payload_left = ((uint32_t)(buf[6]) << 24
-                    | (uint32_t)(buf[7]) << 16
-                    | (uint32_t)(buf[8]) << 8
-                    | buf[9]);
+        if (res < 0) {
+            return (res);
+        } else if (res == 0) {
+            break;
         }
 
-        /* Read the mask. */
-        if (buf[1] & INET_HTTP_WEBSOCKET_MASK) {
-            if (socket_read(self_p->socket_p,
-                            &masking_key[0],
-                            sizeof(masking_key)) != sizeof(masking_key)) {
-                return (-EIO);
-            }
-        } else {
-            memset(&masking_key[0], 0, sizeof(masking_key));
-        }
+        b_p += res;
+        left -= res;
+    }
 
-        /* Read the payload. */
-        pos = 0;
+    /* Longer messages are truncated. */
+    res = discard(self_p);
 
-        while ((payload_left > 0) && (left > 0)) {
-            if (payload_left < left) {
-                n = payload_left;
-            } else {
-                n = left;
-            }
+    if (res != 0) {
+        return (res);
+    }
 
-            if (socket_read(self_p->socket_p, b_p, n) != n) {
-                return (-1);
-            }
+    return (size - left);
+}
 
-            for (i = 0; i < n; i++) {
-                *b_p++ ^= masking_key[pos % 4];
-                pos++;
-            }
+int http_websocket_server_write_begin(struct http_websocket_server_t *self_p,
+                                      int type,
+                                      uint32_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL)
 
-            left -= n;
-            payload_left -= n;
+    self_p->write.header_size = encode_header(&self_p->write.header[0],
+                                              type,
+                                              size);
+    self_p->write.left = size;
+
+    /* The header is written with the first payload chunk, if any. */
+    if (size == 0) {
+        if (socket_write(self_p->socket_p,
+                         &self_p->write.header[0],
+                         self_p->write.header_size)
+            != self_p->write.header_size) {
+            return (-EIO);
         }
 
-        /* Discard leftover data. */
-        while (payload_left > 0) {
-            if (socket_read(self_p->socket_p, buf, 1) != 1) {
-                return (-1);
-            }
+        self_p->write.header_size = 0;
+    }
+
+    return (0);
+}
 
-            payload_left--;
+ssize_t http_websocket_server_write_chunk(struct http_websocket_server_t *self_p,
+                                          const void *buf_p,
+                                          size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(buf_p != NULL, EINVAL)
+    ASSERTN(size <= self_p->write.left, EINVAL)
+
+    uint8_t buf[CONFIG_HTTP_WEBSOCKET_WRITE_BUFFER_SIZE];
+    const uint8_t *b_p;
+    size_t pos;
+    size_t n;
+    size_t left;
+
+    b_p = buf_p;
+    left = size;
+
+    /* Write the header together with the first part of the
+       payload. */
+    if (self_p->write.header_size > 0) {
+        pos = self_p->write.header_size;
+        memcpy(&buf[0], &self_p->write.header[0], pos);
+        n = MIN(left, sizeof(buf) - pos);
+        memcpy(&buf[pos], b_p, n);
+        pos += n;
+        self_p->write.header_size = 0;
+
+        if (socket_write(self_p->socket_p, &buf[0], pos) != pos) {
+            return (-EIO);
         }
+
+        b_p += n;
+        left -= n;
     }
 
-    return (size - left);
+    if (left > 0) {
+        if (socket_write(self_p->socket_p, b_p, left) != left) {
+            return (-EIO);
+        }
+    }
+
+    self_p->write.left -= size;
+
+    return (size);
 }
 
 ssize_t http_websocket_server_write(struct http_websocket_server_t *self_p,
@@ -197,40 +410,13 @@ ssize_t http_websocket_server_write(struct http_websocket_server_t *self_p,
     ASSERTN(buf_p != NULL, EINVAL)
     ASSERTN(size > 0, EINVAL)
 
-    uint8_t header[16];
-    size_t header_size = 2;
+    int res;
 
-    header[0] = (INET_HTTP_WEBSOCKET_FIN | type);
+    res = http_websocket_server_write_begin(self_p, type, size);
 
-    if (size < 126) {
-        header[1] = size;
-    } else if (size < 65536) {
-        header[1] = 126;
-        header[2] = ((size >> 8) & 0xff);
-        header[3] = ((size >> 0) & 0xff);
-        header_size += 2;
-    } else {
-        header[1] = 127;
-        header[2] = 0;
-        header[3] = 0;
-        header[4] = 0;
-        header[5] = 0;
-        header[6] = ((size >> 24) & 0xff);
-        header[7] = ((size >> 16) & 0xff);
-        header[8] = ((size >>  8) & 0xff);
-        header[9] = ((size >>  0) & 0xff);
-        header_size += 8;
-    }
-
-    if (socket_write(self_p->socket_p,
-                     header,
-                     header_size) != header_size) {
-        return (-EIO);
+    if (res != 0) {
+        return (res);
     }
 
-    if (socket_write(self_p->socket_p, buf_p, size) != size) {
-        return (-EIO);
-    }
-
-    return (size);
+    return (http_websocket_server_write_chunk(self_p, buf_p, size));
 }
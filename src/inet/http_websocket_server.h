@@ -35,6 +35,18 @@
 
 struct http_websocket_server_t {
     struct socket_t *socket_p;
+    struct {
+        uint32_t left;
+        uint8_t masking_key[4];
+        int8_t pos;
+        int8_t masked;
+        int8_t fin;
+    } read;
+    struct {
+        uint32_t left;
+        uint8_t header[10];
+        uint8_t header_size;
+    } write;
 };
 
 /**
@@ -77,6 +89,36 @@ ssize_t http_websocket_server_read(struct http_websocket_server_t *self_p,
                                    void *buf_p,
                                    size_t size);
 
+/**
+ * Start reading the next message from given websocket. Leftover data
+ * of the previous message is dropped. Read the message payload with
+ * `http_websocket_server_read_chunk()`. Use this function and
+ * `http_websocket_server_read_chunk()` to read messages larger than
+ * the read buffer.
+ *
+ * @param[in] self_p Websocket to read from.
+ * @param[out] type_p Read message type.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_websocket_server_read_begin(struct http_websocket_server_t *self_p,
+                                     int *type_p);
+
+/**
+ * Read the next part of the message payload, started by
+ * `http_websocket_server_read_begin()`.
+ *
+ * @param[in] self_p Websocket to read from.
+ * @param[in] buf_p Buffer to read into.
+ * @param[in] size Maximum number of bytes to read.
+ *
+ * @return Number of bytes read, zero(0) at the end of the message, or
+ *         negative error code.
+ */
+ssize_t http_websocket_server_read_chunk(struct http_websocket_server_t *self_p,
+                                         void *buf_p,
+                                         size_t size);
+
 /**
  * Write given message to given websocket.
  *
@@ -92,4 +134,35 @@ ssize_t http_websocket_server_write(struct http_websocket_server_t *self_p,
                                     const void *buf_p,
                                     uint32_t size);
 
+/**
+ * Start writing a message of given size to given websocket. Write
+ * the message payload with one or more calls to
+ * `http_websocket_server_write_chunk()`. The frame header is written
+ * together with the first payload chunk.
+ *
+ * @param[in] self_p Websocket to write to.
+ * @param[in] type One of ``HTTP_TYPE_TEXT`` and ``HTTP_TYPE_BINARY``.
+ * @param[in] size Total number of payload bytes in the message.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_websocket_server_write_begin(struct http_websocket_server_t *self_p,
+                                      int type,
+                                      uint32_t size);
+
+/**
+ * Write the next part of the message payload, started by
+ * `http_websocket_server_write_begin()`.
+ *
+ * @param[in] self_p Websocket to write to.
+ * @param[in] buf_p Buffer to write.
+ * @param[in] size Number of bytes to write. Must not exceed the
+ *                 number of payload bytes left in the message.
+ *
+ * @return Number of bytes written or negative error code.
+ */
+ssize_t http_websocket_server_write_chunk(struct http_websocket_server_t *self_p,
+                                          const void *buf_p,
+                                          size_t size);
+
 #endif
@@ -30,6 +30,14 @@
 
 #include "simba.h"
 
+/* Websocket masking word, a SIMD vector on Linux. Its size must be a
+   multiple of the masking key size. */
+#if defined(ARCH_LINUX)
+typedef uint8_t mask_word_t __attribute__ ((vector_size (16)));
+#else
+typedef uint32_t mask_word_t;
+#endif
+
 static uint32_t inet_checksum_begin(void)
 {
   return (0);
@@ -134,3 +142,51 @@ uint16_t inet_checksum(void *buf_p, size_t size)
 
     return (inet_checksum_end(acc));
 }
+
+int inet_http_websocket_mask(void *buf_p,
+                             size_t size,
+                             const uint8_t *masking_key_p,
+                             int pos)
+{
+    uint8_t *b_p;
+    uint8_t key[sizeof(mask_word_t)];
+    mask_word_t key_word;
+    mask_word_t word;
+    int i;
+
+    b_p = buf_p;
+
+    /* Byte by byte until the payload is word aligned. */
+    while ((size > 0) && (((uintptr_t)b_p % sizeof(word)) != 0)) {
+        *b_p++ ^= masking_key_p[pos];
+        pos = ((pos + 1) & 0x3);
+        size--;
+    }
+
+    if (size >= sizeof(word)) {
+        /* The masking key rotated to the current position and
+           repeated to fill a word. The word size is a multiple of
+           four, so the position is unchanged after each word. */
+        for (i = 0; i < sizeof(key); i++) {
+            key[i] = masking_key_p[(pos + i) & 0x3];
+        }
+
+        memcpy(&key_word, &key[0], sizeof(key_word));
+
+        while (size >= sizeof(word)) {
+            memcpy(&word, b_p, sizeof(word));
+            word ^= key_word;
+            memcpy(b_p, &word, sizeof(word));
+            b_p += sizeof(word);
+            size -= sizeof(word);
+        }
+    }
+
+    while (size > 0) {
+        *b_p++ ^= masking_key_p[pos];
+        pos = ((pos + 1) & 0x3);
+        size--;
+    }
+
+    return (pos);
+}
@@ -107,4 +107,22 @@ char *inet_ntoa(const struct inet_ip_addr_t *src_p,
  */
 uint16_t inet_checksum(void *buf_p, size_t size);
 
+/**
+ * Mask or unmask given websocket payload with given masking key. The
+ * payload is masked a word at a time, with the key rotated to the
+ * position of the first byte.
+ *
+ * @param[in,out] buf_p Payload to mask or unmask.
+ * @param[in] size Size of the payload.
+ * @param[in] masking_key_p Four bytes masking key.
+ * @param[in] pos Position in the masking key of the first byte, the
+ *                payload offset modulo four.
+ *
+ * @return Position in the masking key of the byte after the payload.
+ */
+int inet_http_websocket_mask(void *buf_p,
+                             size_t size,
+                             const uint8_t *masking_key_p,
+                             int pos);
+
 #endif
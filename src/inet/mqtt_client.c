@@ -61,7 +61,54 @@
 #define CONTROL_PUBLISH        3
 #define CONTROL_SUBSCRIBE      4
 #define CONTROL_UNSUBSCRIBE    5
-#define CONTROL_NONE           6
+#define CONTROL_PUBLISH_ASYNC  6
+#define CONTROL_NONE           7
+
+/** In-flight message states. */
+#define INFLIGHT_STATE_FREE           0
+#define INFLIGHT_STATE_WAIT_PUBACK    1
+#define INFLIGHT_STATE_WAIT_PUBREC    2
+#define INFLIGHT_STATE_WAIT_PUBCOMP   3
+
+/** Publish flags. */
+#define PUBLISH_FLAGS_DUP          0x08
+
+/** Outbox record header, followed by the topic and the payload. */
+#define OUTBOX_RECORD_HEADER_SIZE     6
+#define OUTBOX_RECORD_PENDING      0xa5
+#define OUTBOX_RECORD_DELIVERED    0x00
+
+/** Largest fixed header, topic length and packet identifier. */
+#define PUBLISH_OVERHEAD_MAX          9
+
+/**
+ * Publish request written to the client thread.
+ */
+struct publish_request_t {
+    struct mqtt_application_message_t *message_p;
+    struct mqtt_client_completion_t *completion_p;
+};
+
+/**
+ * Payload channel given to the on-publish callbacks. The payload is
+ * read from given buffer, or streamed from the input channel if the
+ * buffer is NULL.
+ */
+struct payload_chan_t {
+    struct chan_t base;
+    void *chin_p;
+    const uint8_t *buf_p;
+    size_t left;
+};
+
+/**
+ * On-publish callbacks of the subscriptions matching an incoming
+ * message.
+ */
+struct matches_t {
+    mqtt_on_publish_t callbacks[CONFIG_MQTT_CLIENT_SUBSCRIPTION_MATCHES_MAX];
+    int length;
+};
 
 static const char *message_fmt[] = {
     "forbidden",
@@ -85,6 +132,40 @@ static const char *message_fmt[] = {
 //! Interval required between MQTT packets.
 #define KEEP_ALIVE 300
 
+/**
+ * Encode the fixed header of a MQTT message into given buffer.
+ *
+ * @return Number of encoded bytes.
+ */
+static int encode_fixed_header(uint8_t *buf_p,
+                               int type,
+                               int flags,
+                               size_t size)
+{
+    int pos;
+    uint8_t encoded_byte;
+
+    buf_p[0] = (type << 4) | flags;
+    pos = 1;
+
+    do {
+        /* Encode the variable length size field. */
+        encoded_byte = (size % 128);
+        size /= 128;
+
+        /* If there are more data to encode, set the top bit of this
+           byte. */
+        if (size > 0) {
+            encoded_byte |= 0x80;
+        }
+
+        buf_p[pos] = encoded_byte;
+        pos++;
+    } while (size > 0);
+
+    return (pos);
+}
+
 /**
  * Write the fixed header of the MQTT message to the server.
  */
@@ -95,74 +176,681 @@ static int write_fixed_header(struct mqtt_client_t *self_p,
 {
     uint8_t buf[5];
     int pos;
-    uint8_t encoded_byte;
 
-    log_object_print(self_p->log_object_p,
-                     LOG_DEBUG,
-                     OSTR("Writing MQTT message '%s' to the server.\r\n"),
-                     message_fmt[type]);
+    log_object_print(self_p->log_object_p,
+                     LOG_DEBUG,
+                     OSTR("Writing MQTT message '%s' to the server.\r\n"),
+                     message_fmt[type]);
+
+    pos = encode_fixed_header(&buf[0], type, flags, size);
+
+    if (chan_write(self_p->transport.out_p, &buf[0], pos) != pos) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Read the fixed header of a MQTT message from the server.
+ */
+static int read_fixed_header(struct mqtt_client_t *self_p,
+                             int *type_p,
+                             int *flags_p,
+                             size_t *size_p)
+{
+    uint8_t byte;
+    long multiplier;
+
+    if (chan_read(self_p->transport.in_p, &byte, 1) != 1) {
+        return (-EIO);
+    }
+
+    *type_p = ((byte >> 4) & 0xf);
+    *flags_p = (byte & 0xf);
+
+    /* Read the variablie size field. */
+    multiplier = 1;
+    *size_p = 0;
+
+    do {
+        if (chan_read(self_p->transport.in_p, &byte, 1) != 1) {
+            return (-EIO);
+        }
+
+        *size_p += (byte & 0x7f) * multiplier;
+        multiplier *= 128;
+
+        if (multiplier > 128L * 128L * 128L) {
+            return (-1);
+        }
+    } while ((byte & 0x80) != 0);
+
+    return (0);
+}
+
+/**
+ * Write a packet that only consists of the fixed header and a packet
+ * identifier to the server.
+ */
+static int write_packet_id(struct mqtt_client_t *self_p,
+                           int type,
+                           int flags,
+                           uint16_t packet_id)
+{
+    int res;
+    uint8_t buf[2];
+
+    res = write_fixed_header(self_p, type, flags, 2);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    buf[0] = (packet_id >> 8);
+    buf[1] = packet_id;
+
+    if (chan_write(self_p->transport.out_p, &buf[0], 2) != 2) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Read the packet identifier of a packet that has no other variable
+ * header or payload.
+ */
+static int read_packet_id(struct mqtt_client_t *self_p,
+                          size_t size,
+                          uint16_t *packet_id_p)
+{
+    uint8_t buf[2];
+
+    if (size != 2) {
+        return (-EMSGSIZE);
+    }
+
+    if (chan_read(self_p->transport.in_p, &buf[0], size) != size) {
+        return (-EIO);
+    }
+
+    *packet_id_p = (((uint16_t)buf[0] << 8) | buf[1]);
+
+    return (0);
+}
+
+/**
+ * Read and throw away given number of bytes from the server.
+ */
+static int discard(struct mqtt_client_t *self_p,
+                   size_t size)
+{
+    uint8_t buf[16];
+    size_t n;
+
+    while (size > 0) {
+        n = MIN(size, sizeof(buf));
+
+        if (chan_read(self_p->transport.in_p, &buf[0], n) != n) {
+            return (-EIO);
+        }
+
+        size -= n;
+    }
+
+    return (0);
+}
+
+/**
+ * Find the in-flight message with given packet identifier.
+ */
+static struct mqtt_client_inflight_t *inflight_find(
+    struct mqtt_client_t *self_p,
+    uint16_t packet_id)
+{
+    int i;
+    struct mqtt_client_inflight_t *entry_p;
+
+    for (i = 0; i < membersof(self_p->inflight.entries); i++) {
+        entry_p = &self_p->inflight.entries[i];
+
+        if ((entry_p->state != INFLIGHT_STATE_FREE)
+            && (entry_p->packet_id == packet_id)) {
+            return (entry_p);
+        }
+    }
+
+    return (NULL);
+}
+
+/**
+ * Allocate an in-flight entry and a unique packet identifier for
+ * given message. The publisher has already reserved an entry by
+ * taking the in-flight semaphore. Messages sent from the outbox have
+ * no message pointer.
+ */
+static struct mqtt_client_inflight_t *inflight_alloc(
+    struct mqtt_client_t *self_p,
+    struct mqtt_application_message_t *message_p,
+    int qos,
+    int async)
+{
+    int i;
+    struct mqtt_client_inflight_t *entry_p;
+    uint16_t packet_id;
+
+    entry_p = NULL;
+
+    for (i = 0; i < membersof(self_p->inflight.entries); i++) {
+        if (self_p->inflight.entries[i].state == INFLIGHT_STATE_FREE) {
+            entry_p = &self_p->inflight.entries[i];
+            break;
+        }
+    }
+
+    if (entry_p == NULL) {
+        return (NULL);
+    }
+
+    /* Zero is not a valid packet identifier. */
+    do {
+        packet_id = self_p->inflight.next_packet_id++;
+    } while ((packet_id == 0) || (inflight_find(self_p, packet_id) != NULL));
+
+    entry_p->message_p = message_p;
+    entry_p->completion_p = NULL;
+    entry_p->outbox_offset = -1;
+    entry_p->packet_id = packet_id;
+    entry_p->async = async;
+
+    if (qos == mqtt_qos_1_t) {
+        entry_p->state = INFLIGHT_STATE_WAIT_PUBACK;
+    } else {
+        entry_p->state = INFLIGHT_STATE_WAIT_PUBREC;
+    }
+
+    return (entry_p);
+}
+
+/**
+ * Find the oldest in-flight message, or NULL if there are none.
+ */
+static struct mqtt_client_inflight_t *inflight_oldest(
+    struct mqtt_client_t *self_p)
+{
+    int i;
+    struct mqtt_client_inflight_t *entry_p;
+    struct mqtt_client_inflight_t *oldest_p;
+    uint16_t age;
+    uint16_t oldest_age;
+
+    oldest_p = NULL;
+    oldest_age = 0;
+
+    for (i = 0; i < membersof(self_p->inflight.entries); i++) {
+        entry_p = &self_p->inflight.entries[i];
+
+        if (entry_p->state == INFLIGHT_STATE_FREE) {
+            continue;
+        }
+
+        age = (self_p->inflight.next_packet_id - entry_p->packet_id);
+
+        if ((oldest_p == NULL) || (age > oldest_age)) {
+            oldest_p = entry_p;
+            oldest_age = age;
+        }
+    }
+
+    return (oldest_p);
+}
+
+/**
+ * Remove all records from the outbox.
+ */
+static int outbox_reset(struct mqtt_client_outbox_t *self_p)
+{
+    fs_close(&self_p->file);
+    fs_remove(self_p->path_p);
+    self_p->count = 0;
+    self_p->read_offset = 0;
+    self_p->write_offset = 0;
+    self_p->recovered_offset = 0;
+
+    return (fs_open(&self_p->file, self_p->path_p, FS_RDWR | FS_CREAT));
+}
+
+/**
+ * Read the header of the outbox record at given offset. The file
+ * position is left at the topic.
+ */
+static int outbox_read_header(struct mqtt_client_outbox_t *self_p,
+                              ssize_t offset,
+                              uint8_t *header_p)
+{
+    if (fs_seek(&self_p->file, offset, FS_SEEK_SET) != 0) {
+        return (-EIO);
+    }
+
+    if (fs_read(&self_p->file,
+                header_p,
+                OUTBOX_RECORD_HEADER_SIZE) != OUTBOX_RECORD_HEADER_SIZE) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+static size_t outbox_record_size(const uint8_t *header_p)
+{
+    return (OUTBOX_RECORD_HEADER_SIZE
+            + (((size_t)header_p[2] << 8) | header_p[3])
+            + (((size_t)header_p[4] << 8) | header_p[5]));
+}
+
+/**
+ * Count the pending records in the outbox file and find where to
+ * append new records. A partially written record at the end of the
+ * file is overwritten by the next appended record. The pending
+ * records found are sent with the duplicate flag set, as they may
+ * have been sent before a restart.
+ */
+static int outbox_scan(struct mqtt_client_outbox_t *self_p)
+{
+    uint8_t header[OUTBOX_RECORD_HEADER_SIZE];
+    ssize_t size;
+    ssize_t offset;
+    ssize_t record_size;
+
+    if (fs_seek(&self_p->file, 0, FS_SEEK_END) != 0) {
+        return (-EIO);
+    }
+
+    size = fs_tell(&self_p->file);
+
+    if (size < 0) {
+        return (-EIO);
+    }
+
+    self_p->count = 0;
+    offset = 0;
+
+    while (offset + OUTBOX_RECORD_HEADER_SIZE <= size) {
+        if (outbox_read_header(self_p, offset, &header[0]) != 0) {
+            return (-EIO);
+        }
+
+        if ((header[0] != OUTBOX_RECORD_PENDING)
+            && (header[0] != OUTBOX_RECORD_DELIVERED)) {
+            break;
+        }
+
+        record_size = outbox_record_size(&header[0]);
+
+        if (offset + record_size > size) {
+            break;
+        }
+
+        if (header[0] == OUTBOX_RECORD_PENDING) {
+            self_p->count++;
+        }
+
+        offset += record_size;
+    }
+
+    if (self_p->count == 0) {
+        return (outbox_reset(self_p));
+    }
+
+    self_p->read_offset = 0;
+    self_p->write_offset = offset;
+    self_p->recovered_offset = offset;
+
+    return (0);
+}
+
+/**
+ * Append given message to the outbox, using a single file write.
+ */
+static int outbox_append(struct mqtt_client_outbox_t *self_p,
+                         struct mqtt_application_message_t *message_p,
+                         int flags)
+{
+    uint8_t *buf_p;
+    size_t size;
+
+    /* The message must also fit in the buffer when sent. */
+    if ((message_p->topic.size
+         + message_p->payload.size
+         + PUBLISH_OVERHEAD_MAX) > self_p->buf.size) {
+        return (-EMSGSIZE);
+    }
+
+    buf_p = self_p->buf.buf_p;
+    buf_p[0] = OUTBOX_RECORD_PENDING;
+    buf_p[1] = ((message_p->qos << 1) | flags);
+    buf_p[2] = (message_p->topic.size >> 8);
+    buf_p[3] = message_p->topic.size;
+    buf_p[4] = (message_p->payload.size >> 8);
+    buf_p[5] = message_p->payload.size;
+    size = OUTBOX_RECORD_HEADER_SIZE;
+    memcpy(&buf_p[size], message_p->topic.buf_p, message_p->topic.size);
+    size += message_p->topic.size;
+    memcpy(&buf_p[size], message_p->payload.buf_p, message_p->payload.size);
+    size += message_p->payload.size;
+
+    if (fs_seek(&self_p->file, self_p->write_offset, FS_SEEK_SET) != 0) {
+        return (-EIO);
+    }
+
+    if (fs_write(&self_p->file, buf_p, size) != size) {
+        return (-EIO);
+    }
+
+    self_p->write_offset += size;
+    self_p->count++;
+
+    return (0);
+}
+
+/**
+ * Overwrite given byte in the outbox file.
+ */
+static int outbox_write_byte(struct mqtt_client_outbox_t *self_p,
+                             ssize_t offset,
+                             uint8_t value)
+{
+    if (fs_seek(&self_p->file, offset, FS_SEEK_SET) != 0) {
+        return (-EIO);
+    }
+
+    if (fs_write(&self_p->file, &value, 1) != 1) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Mark the record at given offset as delivered. The file is emptied
+ * when all records have been delivered.
+ */
+static int outbox_delivered(struct mqtt_client_outbox_t *self_p,
+                            ssize_t offset)
+{
+    self_p->count--;
+
+    if (self_p->count == 0) {
+        return (outbox_reset(self_p));
+    }
+
+    return (outbox_write_byte(self_p, offset, OUTBOX_RECORD_DELIVERED));
+}
+
+/**
+ * Returns true(1) if QoS 1 and QoS 2 messages shall be stored in the
+ * outbox instead of being sent right away. New messages are stored
+ * until all older messages in the outbox have been delivered, to
+ * keep them in order.
+ */
+static int outbox_is_used(struct mqtt_client_t *self_p)
+{
+    if (self_p->outbox_p == NULL) {
+        return (0);
+    }
+
+    return ((self_p->state != mqtt_client_state_connected_t)
+            || (self_p->outbox_p->count > 0));
+}
+
+static int outbox_flush(struct mqtt_client_t *self_p,
+                        size_t size)
+{
+    log_object_print(self_p->log_object_p,
+                     LOG_DEBUG,
+                     OSTR("Writing %u bytes of outbox messages to the "
+                          "server.\r\n"),
+                     (unsigned int)size);
+
+    if (chan_write(self_p->transport.out_p,
+                   self_p->outbox_p->buf.buf_p,
+                   size) != size) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Send pending outbox records to the server, as many as there is
+ * room for in the in-flight window. The publish packets are
+ * coalesced into as few transport writes as the buffer allows. If a
+ * write fails the in-flight entries of the unsent records are
+ * released, and the records are sent again later.
+ */
+static int outbox_send(struct mqtt_client_t *self_p)
+{
+    int res;
+    int i;
+    int length;
+    struct mqtt_client_outbox_t *outbox_p;
+    struct mqtt_client_inflight_t *entry_p;
+    struct mqtt_client_inflight_t *entries[CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW];
+    uint8_t header[OUTBOX_RECORD_HEADER_SIZE];
+    uint8_t *buf_p;
+    uint8_t flags;
+    size_t pos;
+    size_t start;
+    size_t topic_size;
+    size_t payload_size;
+    size_t size;
+
+    outbox_p = self_p->outbox_p;
+
+    if ((outbox_p == NULL)
+        || (self_p->state != mqtt_client_state_connected_t)) {
+        return (0);
+    }
+
+    res = 0;
+    buf_p = outbox_p->buf.buf_p;
+    pos = 0;
+    length = 0;
+
+    while (outbox_p->read_offset < outbox_p->write_offset) {
+        res = outbox_read_header(outbox_p, outbox_p->read_offset, &header[0]);
+
+        if (res != 0) {
+            break;
+        }
+
+        if (header[0] != OUTBOX_RECORD_PENDING) {
+            outbox_p->read_offset += outbox_record_size(&header[0]);
+            continue;
+        }
+
+        entry_p = inflight_alloc(self_p, NULL, (header[1] >> 1) & 0x3, 0);
+
+        if (entry_p == NULL) {
+            break;
+        }
+
+        entry_p->outbox_offset = outbox_p->read_offset;
+        entries[length++] = entry_p;
+        topic_size = (((size_t)header[2] << 8) | header[3]);
+        payload_size = (((size_t)header[4] << 8) | header[5]);
+        size = (topic_size + payload_size + 4);
+
+        if (pos + size + 5 > outbox_p->buf.size) {
+            if (outbox_flush(self_p, pos) != 0) {
+                pos = 0;
+                break;
+            }
+
+            /* Only the current record is left unsent. */
+            entries[0] = entry_p;
+            length = 1;
+            pos = 0;
+        }
+
+        /* The publish packet flags are stored in the record. */
+        flags = header[1];
+
+        if (outbox_p->read_offset < outbox_p->recovered_offset) {
+            flags |= PUBLISH_FLAGS_DUP;
+        }
+
+        start = pos;
+        pos += encode_fixed_header(&buf_p[pos], MQTT_PUBLISH, flags, size);
+        buf_p[pos++] = header[2];
+        buf_p[pos++] = header[3];
+
+        if (fs_read(&outbox_p->file, &buf_p[pos], topic_size) != topic_size) {
+            entry_p->state = INFLIGHT_STATE_FREE;
+            length--;
+            pos = start;
+            res = -EIO;
+            break;
+        }
 
-    buf[0] = (type << 4) | flags;
-    pos = 1;
+        pos += topic_size;
+        buf_p[pos++] = (entry_p->packet_id >> 8);
+        buf_p[pos++] = entry_p->packet_id;
+
+        if (fs_read(&outbox_p->file,
+                    &buf_p[pos],
+                    payload_size) != payload_size) {
+            entry_p->state = INFLIGHT_STATE_FREE;
+            length--;
+            pos = start;
+            res = -EIO;
+            break;
+        }
 
-    do {
-        /* Encode the variable length size field. */
-        encoded_byte = (size % 128);
-        size /= 128;
+        pos += payload_size;
+        outbox_p->read_offset += (OUTBOX_RECORD_HEADER_SIZE
+                                  + topic_size
+                                  + payload_size);
+    }
 
-        /* If there are more data to encode, set the top bit of this
-           byte. */
-        if (size > 0) {
-            encoded_byte |= 0x80;
+    if (pos > 0) {
+        if (outbox_flush(self_p, pos) == 0) {
+            length = 0;
         }
+    }
 
-        buf[pos] = encoded_byte;
-        pos++;
-    } while (size > 0);
+    if (length > 0) {
+        /* Release the entries of the unsent records. They are sent
+           again starting with the oldest one. */
+        outbox_p->read_offset = entries[0]->outbox_offset;
 
-    if (chan_write(self_p->transport.out_p, &buf[0], pos) != pos) {
-        return (-EIO);
+        for (i = 0; i < length; i++) {
+            entries[i]->state = INFLIGHT_STATE_FREE;
+        }
+
+        res = -EIO;
     }
 
-    return (0);
+    return (res);
 }
 
 /**
- * Read the fixed header of a MQTT message from the server.
+ * Notify a waiting publisher with given result.
  */
-static int read_fixed_header(struct mqtt_client_t *self_p,
-                             int *type_p,
-                             int *flags_p,
-                             size_t *size_p)
+static void completion_signal(struct mqtt_client_completion_t *completion_p,
+                              int res)
 {
-    uint8_t byte;
-    long multiplier;
+    completion_p->res = res;
+    sem_give(&completion_p->sem, 1);
+}
 
-    if (chan_read(self_p->transport.in_p, &byte, 1) != 1) {
-        return (-EIO);
-    }
+/**
+ * Free given in-flight entry and notify the publisher with given
+ * result.
+ */
+static void inflight_complete(struct mqtt_client_t *self_p,
+                              struct mqtt_client_inflight_t *entry_p,
+                              int res)
+{
+    entry_p->state = INFLIGHT_STATE_FREE;
 
-    *type_p = ((byte >> 4) & 0xf);
-    *flags_p = (byte & 0xf);
+    /* Sent from the outbox. */
+    if (entry_p->message_p == NULL) {
+        if (res == 0) {
+            outbox_delivered(self_p->outbox_p, entry_p->outbox_offset);
+        }
 
-    /* Read the variablie size field. */
-    multiplier = 1;
-    *size_p = 0;
+        return;
+    }
 
-    do {
-        if (chan_read(self_p->transport.in_p, &byte, 1) != 1) {
-            return (-EIO);
+    sem_give(&self_p->inflight.sem, 1);
+
+    if (entry_p->async == 1) {
+        if (self_p->on_publish_complete != NULL) {
+            self_p->on_publish_complete(self_p, entry_p->message_p, res);
         }
+    } else {
+        completion_signal(entry_p->completion_p, res);
+    }
+}
 
-        *size_p += (byte & 0x7f) * multiplier;
-        multiplier *= 128;
+/**
+ * Complete all in-flight messages with given error. If an outbox is
+ * used the messages are stored in it instead, oldest first, to be
+ * sent again with the duplicate flag set.
+ *
+ * QoS 2 messages already received by the server, waiting for the
+ * pubcomp message, are completed as delivered. The session is always
+ * clean, so the release cannot be resumed after reconnecting, and
+ * publishing them again would deliver them twice.
+ */
+static void inflight_abort(struct mqtt_client_t *self_p,
+                           int res)
+{
+    struct mqtt_client_outbox_t *outbox_p;
+    struct mqtt_client_inflight_t *entry_p;
+    int flags;
 
-        if (multiplier > 128L * 128L * 128L) {
-            return (-1);
+    outbox_p = self_p->outbox_p;
+
+    while ((entry_p = inflight_oldest(self_p)) != NULL) {
+        if (entry_p->state == INFLIGHT_STATE_WAIT_PUBCOMP) {
+            inflight_complete(self_p, entry_p, 0);
+        } else if (outbox_p == NULL) {
+            inflight_complete(self_p, entry_p, res);
+        } else if (entry_p->message_p == NULL) {
+            if (entry_p->state == INFLIGHT_STATE_WAIT_PUBACK) {
+                flags = (mqtt_qos_1_t << 1);
+            } else {
+                flags = (mqtt_qos_2_t << 1);
+            }
+
+            entry_p->state = INFLIGHT_STATE_FREE;
+            outbox_write_byte(outbox_p,
+                              entry_p->outbox_offset + 1,
+                              flags | PUBLISH_FLAGS_DUP);
+        } else {
+            inflight_complete(self_p,
+                              entry_p,
+                              outbox_append(outbox_p,
+                                            entry_p->message_p,
+                                            PUBLISH_FLAGS_DUP));
         }
-    } while ((byte & 0x80) != 0);
+    }
 
-    return (0);
+    if (outbox_p != NULL) {
+        outbox_p->read_offset = 0;
+    }
+}
+
+/**
+ * The connection to the server has been closed or lost.
+ */
+static void set_disconnected(struct mqtt_client_t *self_p)
+{
+    self_p->state = mqtt_client_state_disconnected_t;
+    inflight_abort(self_p, -ENOTCONN);
 }
 
 /**
@@ -233,6 +921,9 @@ static int handle_response_connack(struct mqtt_client_t *self_p,
         return (-1);
     }
 
+    /* A clean session starts without any pending incoming QoS 2
+       messages. */
+    memset(&self_p->incoming, 0, sizeof(self_p->incoming));
     self_p->state = mqtt_client_state_connected_t;
 
     return (0);
@@ -248,7 +939,7 @@ static int handle_control_disconnect(struct mqtt_client_t *self_p)
         return (-1);
     }
 
-    self_p->state = mqtt_client_state_disconnected_t;
+    set_disconnected(self_p);
 
     return (0);
 }
@@ -292,21 +983,16 @@ static int handle_response_ping(struct mqtt_client_t *self_p,
 }
 
 /**
- * Send the publish message to the server.
+ * Write a publish packet to the server.
  */
-static int handle_control_publish(struct mqtt_client_t *self_p)
+static int write_publish(struct mqtt_client_t *self_p,
+                         struct mqtt_application_message_t *message_p,
+                         uint16_t packet_id)
 {
     int res = 0;
     uint8_t buf[2];
-    struct mqtt_application_message_t *message_p;
     size_t size;
 
-    if (queue_read(&self_p->control.in,
-                   &message_p,
-                   sizeof(message_p)) != sizeof(message_p)) {
-        return (-1);
-    }
-
     /* Write the fixed header. */
     size = (message_p->topic.size + message_p->payload.size + 2);
 
@@ -338,8 +1024,8 @@ static int handle_control_publish(struct mqtt_client_t *self_p)
     }
 
     if (message_p->qos > 0) {
-        buf[0] = 0;
-        buf[1] = 1;
+        buf[0] = (packet_id >> 8);
+        buf[1] = packet_id;
 
         if (chan_write(self_p->transport.out_p, &buf[0], 2) != 2) {
             return (-EIO);
@@ -355,41 +1041,185 @@ static int handle_control_publish(struct mqtt_client_t *self_p)
         }
     }
 
-    self_p->message.type = CONTROL_PUBLISH;
-
     return (0);
 }
 
+/**
+ * Send the publish message to the server. QoS 1 and QoS 2 messages
+ * are added to the in-flight window until acknowledged by the
+ * server, or stored in the outbox if they cannot be sent right
+ * away. Asynchronous publishers are notified as soon as the message
+ * has been written or stored. Blocking publishers of in-flight
+ * messages are notified when their own entry is completed.
+ */
+static int handle_control_publish(struct mqtt_client_t *self_p,
+                                  int async)
+{
+    int res;
+    int stored;
+    struct publish_request_t request;
+    struct mqtt_application_message_t *message_p;
+    struct mqtt_client_inflight_t *entry_p;
+
+    if (queue_read(&self_p->control.in,
+                   &request,
+                   sizeof(request)) != sizeof(request)) {
+        return (-1);
+    }
+
+    message_p = request.message_p;
+
+    entry_p = NULL;
+    stored = 0;
+
+    if ((message_p->qos > 0) && outbox_is_used(self_p)) {
+        res = outbox_append(self_p->outbox_p, message_p, 0);
+        stored = 1;
+    } else if (self_p->state != mqtt_client_state_connected_t) {
+        res = -ENOTCONN;
+    } else if (message_p->qos == mqtt_qos_0_t) {
+        res = write_publish(self_p, message_p, 0);
+    } else {
+        entry_p = inflight_alloc(self_p, message_p, message_p->qos, async);
+
+        if (entry_p == NULL) {
+            res = -ENOMEM;
+        } else {
+            if (async == 0) {
+                entry_p->completion_p = request.completion_p;
+            }
+
+            res = write_publish(self_p, message_p, entry_p->packet_id);
+
+            if (res != 0) {
+                /* The connection is broken. Store this and all other
+                   in-flight messages in the outbox, if used. */
+                entry_p->state = INFLIGHT_STATE_FREE;
+                entry_p = NULL;
+                set_disconnected(self_p);
+
+                if (self_p->outbox_p != NULL) {
+                    res = outbox_append(self_p->outbox_p,
+                                        message_p,
+                                        PUBLISH_FLAGS_DUP);
+                    stored = 1;
+                }
+            }
+        }
+    }
+
+    if ((res != 0) || (message_p->qos == mqtt_qos_0_t) || (stored == 1)) {
+        /* Not in flight. Release the reserved window entry. */
+        if (message_p->qos > 0) {
+            if (entry_p != NULL) {
+                entry_p->state = INFLIGHT_STATE_FREE;
+            }
+
+            sem_give(&self_p->inflight.sem, 1);
+        }
+
+        completion_signal(request.completion_p, res);
+
+        if ((res == 0)
+            && (async == 1)
+            && (self_p->on_publish_complete != NULL)) {
+            self_p->on_publish_complete(self_p, message_p, 0);
+        }
+    } else if (async == 1) {
+        completion_signal(request.completion_p, res);
+    }
+
+    if (stored == 1) {
+        res = outbox_send(self_p);
+    }
+
+    return (res);
+}
+
 /**
  * Handle the puback message from the server.
  */
 static int handle_response_puback(struct mqtt_client_t *self_p,
                                   size_t size)
 {
-    uint8_t buf[2];
+    int res;
+    uint16_t packet_id;
+    struct mqtt_client_inflight_t *entry_p;
 
-    if (self_p->message.type != CONTROL_PUBLISH) {
-        return (-1);
+    res = read_packet_id(self_p, size, &packet_id);
+
+    if (res != 0) {
+        return (res);
     }
 
-    self_p->message.type = CONTROL_NONE;
+    entry_p = inflight_find(self_p, packet_id);
 
-    if (size != 2) {
-        return (-EMSGSIZE);
+    if ((entry_p == NULL)
+        || (entry_p->state != INFLIGHT_STATE_WAIT_PUBACK)) {
+        return (-1);
     }
 
-    if (chan_read(self_p->transport.in_p, &buf[0], size) != size) {
-        return (-EIO);
+    inflight_complete(self_p, entry_p, 0);
+
+    return (0);
+}
+
+/**
+ * Handle the pubrec message from the server by releasing the
+ * message.
+ */
+static int handle_response_pubrec(struct mqtt_client_t *self_p,
+                                  size_t size)
+{
+    int res;
+    uint16_t packet_id;
+    struct mqtt_client_inflight_t *entry_p;
+
+    res = read_packet_id(self_p, size, &packet_id);
+
+    if (res != 0) {
+        return (res);
     }
 
-    if (buf[0] != 0) {
+    entry_p = inflight_find(self_p, packet_id);
+
+    /* The server may send the pubrec message again if it did not
+       receive the pubrel message. */
+    if ((entry_p == NULL)
+        || (entry_p->state == INFLIGHT_STATE_WAIT_PUBACK)) {
         return (-1);
     }
 
-    if (buf[1] != 1) {
+    entry_p->state = INFLIGHT_STATE_WAIT_PUBCOMP;
+
+    return (write_packet_id(self_p, MQTT_PUBREL, 2, packet_id));
+}
+
+/**
+ * Handle the pubcomp message from the server.
+ */
+static int handle_response_pubcomp(struct mqtt_client_t *self_p,
+                                   size_t size)
+{
+    int res;
+    uint16_t packet_id;
+    struct mqtt_client_inflight_t *entry_p;
+
+    res = read_packet_id(self_p, size, &packet_id);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    entry_p = inflight_find(self_p, packet_id);
+
+    if ((entry_p == NULL)
+        || (entry_p->state != INFLIGHT_STATE_WAIT_PUBCOMP)) {
         return (-1);
     }
 
+    inflight_complete(self_p, entry_p, 0);
+
     return (0);
 }
 
@@ -523,61 +1353,306 @@ static int handle_control_unsubscribe(struct mqtt_client_t *self_p)
         return (-EIO);
     }
 
-    /* Write the topic filter length. */
-    buf[0] = ((message_p->topic.size >> 8) & 0xff);
-    buf[1] = (message_p->topic.size & 0xff);
+    /* Write the topic filter length. */
+    buf[0] = ((message_p->topic.size >> 8) & 0xff);
+    buf[1] = (message_p->topic.size & 0xff);
+
+    if (chan_write(self_p->transport.out_p, &buf[0], 2) != 2) {
+        return (-EIO);
+    }
+
+    /* Write the topic filter. */
+    if (chan_write(self_p->transport.out_p,
+                   message_p->topic.buf_p,
+                   message_p->topic.size) != message_p->topic.size) {
+        return (-EIO);
+    }
+
+    self_p->message.type = CONTROL_UNSUBSCRIBE;
+
+    return (0);
+}
+
+/**
+ * Handle the unsuback message from the server.
+ */
+static int handle_response_unsuback(struct mqtt_client_t *self_p,
+                                    size_t size)
+{
+    uint8_t buf[3];
+
+    if (self_p->message.type != CONTROL_UNSUBSCRIBE) {
+        return (-1);
+    }
+
+    self_p->message.type = CONTROL_NONE;
+
+    if (size != 2) {
+        return (-EMSGSIZE);
+    }
+
+    if (chan_read(self_p->transport.in_p, &buf[0], size) != size) {
+        return (-EIO);
+    }
+
+    if (buf[0] != 0) {
+        return (-1);
+    }
+
+    if (buf[1] != 2) {
+        return (-1);
+    }
+
+    return (0);
+}
+
+/**
+ * Read at most the payload size from the transport channel.
+ */
+static ssize_t payload_chan_read(void *self_p,
+                                 void *buf_p,
+                                 size_t size)
+{
+    struct payload_chan_t *chan_p;
+    ssize_t res;
+
+    chan_p = self_p;
+
+    if (size > chan_p->left) {
+        size = chan_p->left;
+    }
+
+    if (size == 0) {
+        return (0);
+    }
+
+    if (chan_p->buf_p != NULL) {
+        memcpy(buf_p, chan_p->buf_p, size);
+        chan_p->buf_p += size;
+        res = size;
+    } else {
+        res = chan_read(chan_p->chin_p, buf_p, size);
+    }
+
+    if (res > 0) {
+        chan_p->left -= res;
+    }
+
+    return (res);
+}
+
+static size_t payload_chan_size(void *self_p)
+{
+    return (((struct payload_chan_t *)self_p)->left);
+}
+
+static int is_wildcard(struct mqtt_client_topic_node_t *node_p,
+                       char wildcard)
+{
+    return ((node_p->size == 1) && (node_p->level_p[0] == wildcard));
+}
+
+/**
+ * Find the child of given node with given topic level.
+ */
+static struct mqtt_client_topic_node_t *topic_node_find(
+    struct mqtt_client_topic_node_t *parent_p,
+    const char *level_p,
+    size_t size)
+{
+    struct mqtt_client_topic_node_t *node_p;
+
+    node_p = parent_p->children_p;
+
+    while (node_p != NULL) {
+        if ((node_p->size == size)
+            && (memcmp(node_p->level_p, level_p, size) == 0)) {
+            return (node_p);
+        }
+
+        node_p = node_p->next_p;
+    }
+
+    return (NULL);
+}
+
+/**
+ * Find or add the child of given node with given topic level. The
+ * children are kept ordered with exact levels first, then `+` and
+ * last `#`, so the most specific match is dispatched first.
+ */
+static struct mqtt_client_topic_node_t *topic_node_add(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_topic_node_t *parent_p,
+    const char *level_p,
+    size_t size)
+{
+    struct mqtt_client_topic_node_t *node_p;
+    struct mqtt_client_topic_node_t **next_pp;
+
+    node_p = topic_node_find(parent_p, level_p, size);
+
+    if (node_p != NULL) {
+        return (node_p);
+    }
+
+    node_p = self_p->subscriptions.free_p;
 
-    if (chan_write(self_p->transport.out_p, &buf[0], 2) != 2) {
-        return (-EIO);
+    if (node_p == NULL) {
+        return (NULL);
     }
 
-    /* Write the topic filter. */
-    if (chan_write(self_p->transport.out_p,
-                   message_p->topic.buf_p,
-                   message_p->topic.size) != message_p->topic.size) {
-        return (-EIO);
+    self_p->subscriptions.free_p = node_p->next_p;
+    node_p->level_p = level_p;
+    node_p->size = size;
+    node_p->children_p = NULL;
+    node_p->subscriptions_p = NULL;
+    next_pp = &parent_p->children_p;
+
+    if (is_wildcard(node_p, '#')) {
+        while (*next_pp != NULL) {
+            next_pp = &(*next_pp)->next_p;
+        }
+    } else if (is_wildcard(node_p, '+')) {
+        while ((*next_pp != NULL) && !is_wildcard(*next_pp, '#')) {
+            next_pp = &(*next_pp)->next_p;
+        }
     }
 
-    self_p->message.type = CONTROL_UNSUBSCRIBE;
+    node_p->next_p = *next_pp;
+    *next_pp = node_p;
 
-    return (0);
+    return (node_p);
 }
 
 /**
- * Handle the unsuback message from the server.
+ * Return all nodes below given node without children and
+ * subscriptions to the free list.
  */
-static int handle_response_unsuback(struct mqtt_client_t *self_p,
-                                    size_t size)
+static void topic_node_prune(struct mqtt_client_t *self_p,
+                             struct mqtt_client_topic_node_t *parent_p)
 {
-    uint8_t buf[3];
+    struct mqtt_client_topic_node_t *node_p;
+    struct mqtt_client_topic_node_t **next_pp;
 
-    if (self_p->message.type != CONTROL_UNSUBSCRIBE) {
-        return (-1);
+    next_pp = &parent_p->children_p;
+
+    while (*next_pp != NULL) {
+        node_p = *next_pp;
+        topic_node_prune(self_p, node_p);
+
+        if ((node_p->children_p == NULL)
+            && (node_p->subscriptions_p == NULL)) {
+            *next_pp = node_p->next_p;
+            node_p->next_p = self_p->subscriptions.free_p;
+            self_p->subscriptions.free_p = node_p;
+        } else {
+            next_pp = &node_p->next_p;
+        }
     }
+}
 
-    self_p->message.type = CONTROL_NONE;
+/**
+ * Get the size of given topic level, and a pointer to the next level,
+ * or NULL if it is the last level.
+ */
+static size_t topic_level_next(const char *level_p,
+                               const char **next_pp)
+{
+    const char *next_p;
 
-    if (size != 2) {
-        return (-EMSGSIZE);
+    next_p = strchr(level_p, '/');
+
+    if (next_p == NULL) {
+        *next_pp = NULL;
+
+        return (strlen(level_p));
     }
 
-    if (chan_read(self_p->transport.in_p, &buf[0], size) != size) {
-        return (-EIO);
+    *next_pp = (next_p + 1);
+
+    return (next_p - level_p);
+}
+
+/**
+ * Add the callbacks of given subscriptions to given matches.
+ */
+static int matches_add(struct matches_t *matches_p,
+                       struct mqtt_client_subscription_t *subscription_p)
+{
+    while (subscription_p != NULL) {
+        if (matches_p->length == membersof(matches_p->callbacks)) {
+            return (-ENOMEM);
+        }
+
+        matches_p->callbacks[matches_p->length++] = subscription_p->on_publish;
+        subscription_p = subscription_p->next_p;
     }
 
-    if (buf[0] != 0) {
-        return (-1);
+    return (0);
+}
+
+/**
+ * Find all subscriptions below given node matching given topic level
+ * and the levels after it. A NULL level means that the whole topic
+ * has been matched.
+ */
+static int match(struct mqtt_client_t *self_p,
+                 struct mqtt_client_topic_node_t *parent_p,
+                 const char *level_p,
+                 struct matches_t *matches_p)
+{
+    int res;
+    int wildcards;
+    struct mqtt_client_topic_node_t *node_p;
+    const char *next_p;
+    size_t level_size;
+
+    if (level_p == NULL) {
+        res = matches_add(matches_p, parent_p->subscriptions_p);
+
+        /* A multi level wildcard also matches its parent level. */
+        node_p = topic_node_find(parent_p, "#", 1);
+
+        if ((res == 0) && (node_p != NULL)) {
+            res = matches_add(matches_p, node_p->subscriptions_p);
+        }
+
+        return (res);
     }
 
-    if (buf[1] != 2) {
-        return (-1);
+    res = 0;
+    level_size = topic_level_next(level_p, &next_p);
+
+    /* Wildcards do not match topics starting with '$'. */
+    wildcards = ((parent_p != &self_p->subscriptions.root)
+                 || (level_p[0] != '$'));
+
+    for (node_p = parent_p->children_p;
+         (node_p != NULL) && (res == 0);
+         node_p = node_p->next_p) {
+        if (is_wildcard(node_p, '#')) {
+            if (wildcards) {
+                res = matches_add(matches_p, node_p->subscriptions_p);
+            }
+        } else if (is_wildcard(node_p, '+')) {
+            if (wildcards) {
+                res = match(self_p, node_p, next_p, matches_p);
+            }
+        } else if ((node_p->size == level_size)
+                   && (memcmp(node_p->level_p, level_p, level_size) == 0)) {
+            res = match(self_p, node_p, next_p, matches_p);
+        }
     }
 
-    return (0);
+    return (res);
 }
 
 /**
- * Handle the publish message from the server.
+ * Handle the publish message from the server. The payload is given
+ * to the matching subscriptions in the topic registry, or to the
+ * on-publish callback if no subscription matches. The callbacks are
+ * called with the registry unlocked.
  */
 static int handle_publish(struct mqtt_client_t *self_p,
                           size_t size,
@@ -589,6 +1664,11 @@ static int handle_publish(struct mqtt_client_t *self_p,
     uint8_t buf[2];
     uint8_t qos;
     char topic[128];
+    uint16_t packet_id;
+    uint16_t *free_id_p;
+    int i;
+    struct matches_t matches;
+    struct payload_chan_t payload;
 
     /* Read the variable header. */
     if (chan_read(self_p->transport.in_p, buf, 2) != 2) {
@@ -625,10 +1705,13 @@ static int handle_publish(struct mqtt_client_t *self_p,
             return (-EIO);
         }
 
+        packet_id = (((uint16_t)buf[0] << 8) | buf[1]);
+        payload_size = (size - topic_size - 4);
+
         if (qos == 1) {
-            res = write_fixed_header(self_p, MQTT_PUBACK, 0, 2);
+            res = write_packet_id(self_p, MQTT_PUBACK, 0, packet_id);
         } else if (qos == 2) {
-            res = write_fixed_header(self_p, MQTT_PUBREC, 0, 2);
+            res = write_packet_id(self_p, MQTT_PUBREC, 0, packet_id);
         } else {
             res = (-EPROTO);
         }
@@ -637,22 +1720,112 @@ static int handle_publish(struct mqtt_client_t *self_p,
             return (res);
         }
 
-        /* Write the variable header. */
-        if (chan_write(self_p->transport.out_p, &buf[0], 2) != 2) {
+        if (qos == 2) {
+            /* A QoS 2 message is only delivered to the application
+               once, even if the server sends it again before it has
+               been released. */
+            free_id_p = NULL;
+
+            for (i = 0; i < membersof(self_p->incoming.packet_ids); i++) {
+                if (self_p->incoming.packet_ids[i] == packet_id) {
+                    return (discard(self_p, payload_size));
+                }
+
+                if (self_p->incoming.packet_ids[i] == 0) {
+                    free_id_p = &self_p->incoming.packet_ids[i];
+                }
+            }
+
+            if (free_id_p != NULL) {
+                *free_id_p = packet_id;
+            }
+        }
+    }
+
+    matches.length = 0;
+
+    mutex_lock(&self_p->subscriptions.mutex);
+    res = match(self_p, &self_p->subscriptions.root, topic, &matches);
+    mutex_unlock(&self_p->subscriptions.mutex);
+
+    chan_init(&payload.base,
+              payload_chan_read,
+              chan_write_null,
+              payload_chan_size);
+    payload.chin_p = self_p->transport.in_p;
+    payload.buf_p = NULL;
+    payload.left = payload_size;
+
+    /* Read the payload once if it is given to several callbacks. */
+    if ((matches.length > 1)
+        && (payload_size > 0)
+        && (payload_size <= sizeof(self_p->payload_buf))) {
+        if (chan_read(self_p->transport.in_p,
+                      &self_p->payload_buf[0],
+                      payload_size) != payload_size) {
             return (-EIO);
         }
+    }
 
-        payload_size = (size - topic_size - 4);
+    for (i = 0; i < matches.length; i++) {
+        if ((matches.length > 1)
+            && (payload_size <= sizeof(self_p->payload_buf))) {
+            payload.buf_p = &self_p->payload_buf[0];
+            payload.left = payload_size;
+        }
+
+        if (matches.callbacks[i](self_p,
+                                 topic,
+                                 &payload,
+                                 payload.left) != 0) {
+            res = -1;
+        }
     }
 
-    if (self_p->on_publish(self_p,
-                           topic,
-                           self_p->transport.in_p,
-                           payload_size) != 0) {
-        return (-1);
+    if ((matches.length == 0) && (self_p->on_publish != NULL)) {
+        if (self_p->on_publish(self_p,
+                               topic,
+                               &payload,
+                               payload_size) != 0) {
+            res = -1;
+        }
     }
 
-    return (0);
+    /* Keep the transport in sync if the callbacks did not read the
+       whole payload. */
+    if (payload.buf_p == NULL) {
+        if (discard(self_p, payload.left) != 0) {
+            return (-EIO);
+        }
+    }
+
+    return (res);
+}
+
+/**
+ * Handle the pubrel message from the server, the last step of an
+ * incoming QoS 2 message.
+ */
+static int handle_pubrel(struct mqtt_client_t *self_p,
+                         size_t size)
+{
+    int res;
+    int i;
+    uint16_t packet_id;
+
+    res = read_packet_id(self_p, size, &packet_id);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    for (i = 0; i < membersof(self_p->incoming.packet_ids); i++) {
+        if (self_p->incoming.packet_ids[i] == packet_id) {
+            self_p->incoming.packet_ids[i] = 0;
+        }
+    }
+
+    return (write_packet_id(self_p, MQTT_PUBCOMP, 0, packet_id));
 }
 
 /**
@@ -679,6 +1852,14 @@ static int read_control_message(struct mqtt_client_t *self_p)
                 res = handle_control_connect(self_p);
                 break;
 
+            case CONTROL_PUBLISH:
+                res = handle_control_publish(self_p, 0);
+                break;
+
+            case CONTROL_PUBLISH_ASYNC:
+                res = handle_control_publish(self_p, 1);
+                break;
+
             default:
                 break;
             }
@@ -699,7 +1880,11 @@ static int read_control_message(struct mqtt_client_t *self_p)
                 break;
 
             case CONTROL_PUBLISH:
-                res = handle_control_publish(self_p);
+                res = handle_control_publish(self_p, 0);
+                break;
+
+            case CONTROL_PUBLISH_ASYNC:
+                res = handle_control_publish(self_p, 1);
                 break;
 
             case CONTROL_SUBSCRIBE:
@@ -738,6 +1923,8 @@ static int read_server_message(struct mqtt_client_t *self_p)
     size = 0;
 
     if (read_fixed_header(self_p, &type, &flags, &size) != 0) {
+        set_disconnected(self_p);
+
         return (-EIO);
     }
 
@@ -751,16 +1938,37 @@ static int read_server_message(struct mqtt_client_t *self_p)
     case MQTT_CONNACK:
         res = handle_response_connack(self_p,  size);
         chan_write(&self_p->control.out, &res, sizeof(res));
+
+        if (res == 0) {
+            res = outbox_send(self_p);
+        }
+
         break;
 
     case MQTT_PUBACK:
         res = handle_response_puback(self_p, size);
-        chan_write(&self_p->control.out, &res, sizeof(res));
+
+        if (res == 0) {
+            res = outbox_send(self_p);
+        }
+
         break;
 
     case MQTT_PUBREC:
+        res = handle_response_pubrec(self_p, size);
+        break;
+
     case MQTT_PUBREL:
+        res = handle_pubrel(self_p, size);
+        break;
+
     case MQTT_PUBCOMP:
+        res = handle_response_pubcomp(self_p, size);
+
+        if (res == 0) {
+            res = outbox_send(self_p);
+        }
+
         break;
 
     case MQTT_SUBACK:
@@ -823,12 +2031,31 @@ int mqtt_client_init(struct mqtt_client_t *self_p,
     self_p->transport.in_p = transport_in_p;
     queue_init(&self_p->control.out, NULL, 0);
     queue_init(&self_p->control.in, NULL, 0);
+    mutex_init(&self_p->control.mutex);
+    memset(&self_p->inflight.entries[0],
+           0,
+           sizeof(self_p->inflight.entries));
+    sem_init(&self_p->inflight.sem, 0, membersof(self_p->inflight.entries));
+    self_p->inflight.next_packet_id = 1;
+    memset(&self_p->incoming, 0, sizeof(self_p->incoming));
+    self_p->outbox_p = NULL;
+    memset(&self_p->subscriptions.root,
+           0,
+           sizeof(self_p->subscriptions.root));
+    self_p->subscriptions.free_p = NULL;
+    mutex_init(&self_p->subscriptions.mutex);
     self_p->on_publish = on_publish;
+    self_p->on_publish_complete = NULL;
     self_p->on_error = on_error;
 
     return (0);
 }
 
+/**
+ * Write given control message to the client thread and wait for the
+ * result. Only one thread at a time waits for a result on the control
+ * output queue.
+ */
 static int control_routine(struct mqtt_client_t *self_p,
                            char type,
                            void *buf_p,
@@ -836,6 +2063,8 @@ static int control_routine(struct mqtt_client_t *self_p,
 {
     int res;
 
+    mutex_lock(&self_p->control.mutex);
+
     queue_write(&self_p->control.in, &type, sizeof(type));
 
     if (size > 0) {
@@ -844,6 +2073,8 @@ static int control_routine(struct mqtt_client_t *self_p,
 
     queue_read(&self_p->control.out, &res, sizeof(res));
 
+    mutex_unlock(&self_p->control.mutex);
+
     return (res);
 }
 
@@ -868,16 +2099,265 @@ int mqtt_client_ping(struct mqtt_client_t *self_p)
     return (control_routine(self_p, CONTROL_PING, NULL, 0));
 }
 
+/**
+ * Write given publish request to the client thread and wait for its
+ * result on a completion of our own, as several publishers may wait
+ * at the same time.
+ */
+static int publish(struct mqtt_client_t *self_p,
+                   char type,
+                   struct mqtt_application_message_t *message_p)
+{
+    struct publish_request_t request;
+    struct mqtt_client_completion_t completion;
+
+    /* Reserve an entry in the in-flight window. It is released by
+       the client thread. */
+    if (message_p->qos > 0) {
+        sem_take(&self_p->inflight.sem, NULL);
+    }
+
+    sem_init(&completion.sem, 1, 1);
+    request.message_p = message_p;
+    request.completion_p = &completion;
+
+    mutex_lock(&self_p->control.mutex);
+    queue_write(&self_p->control.in, &type, sizeof(type));
+    queue_write(&self_p->control.in, &request, sizeof(request));
+    mutex_unlock(&self_p->control.mutex);
+
+    sem_take(&completion.sem, NULL);
+
+    return (completion.res);
+}
+
+int mqtt_client_subscriptions_init(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_topic_node_t *nodes_p,
+    int length)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(nodes_p != NULL, EINVAL)
+    ASSERTN(length > 0, EINVAL)
+
+    int i;
+
+    mutex_lock(&self_p->subscriptions.mutex);
+
+    self_p->subscriptions.root.children_p = NULL;
+    self_p->subscriptions.root.subscriptions_p = NULL;
+    self_p->subscriptions.free_p = NULL;
+
+    for (i = 0; i < length; i++) {
+        nodes_p[i].next_p = self_p->subscriptions.free_p;
+        self_p->subscriptions.free_p = &nodes_p[i];
+    }
+
+    mutex_unlock(&self_p->subscriptions.mutex);
+
+    return (0);
+}
+
+int mqtt_client_subscription_init(
+    struct mqtt_client_subscription_t *self_p,
+    const char *filter_p,
+    mqtt_on_publish_t on_publish)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(filter_p != NULL, EINVAL)
+    ASSERTN(on_publish != NULL, EINVAL)
+
+    self_p->filter_p = filter_p;
+    self_p->on_publish = on_publish;
+    self_p->next_p = NULL;
+
+    return (0);
+}
+
+int mqtt_client_subscription_add(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_subscription_t *subscription_p)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(subscription_p != NULL, EINVAL)
+
+    struct mqtt_client_topic_node_t *node_p;
+    struct mqtt_client_subscription_t **next_pp;
+    const char *level_p;
+    const char *next_p;
+    size_t size;
+
+    level_p = subscription_p->filter_p;
+
+    if (level_p[0] == '\0') {
+        return (-EINVAL);
+    }
+
+    /* Validate the wildcards in the filter. */
+    do {
+        size = topic_level_next(level_p, &next_p);
+
+        if ((memchr(level_p, '+', size) != NULL)
+            || (memchr(level_p, '#', size) != NULL)) {
+            if (size != 1) {
+                return (-EINVAL);
+            }
+
+            if ((level_p[0] == '#') && (next_p != NULL)) {
+                return (-EINVAL);
+            }
+        }
+
+        level_p = next_p;
+    } while (level_p != NULL);
+
+    mutex_lock(&self_p->subscriptions.mutex);
+
+    node_p = &self_p->subscriptions.root;
+    level_p = subscription_p->filter_p;
+
+    do {
+        size = topic_level_next(level_p, &next_p);
+        node_p = topic_node_add(self_p, node_p, level_p, size);
+
+        if (node_p == NULL) {
+            topic_node_prune(self_p, &self_p->subscriptions.root);
+            mutex_unlock(&self_p->subscriptions.mutex);
+
+            return (-ENOMEM);
+        }
+
+        level_p = next_p;
+    } while (level_p != NULL);
+
+    /* Keep the subscriptions in the order they were added. */
+    next_pp = &node_p->subscriptions_p;
+
+    while (*next_pp != NULL) {
+        next_pp = &(*next_pp)->next_p;
+    }
+
+    subscription_p->next_p = NULL;
+    *next_pp = subscription_p;
+
+    mutex_unlock(&self_p->subscriptions.mutex);
+
+    return (0);
+}
+
+int mqtt_client_subscription_remove(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_subscription_t *subscription_p)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(subscription_p != NULL, EINVAL)
+
+    int res;
+    struct mqtt_client_topic_node_t *node_p;
+    struct mqtt_client_subscription_t **next_pp;
+    const char *level_p;
+    const char *next_p;
+    size_t size;
+
+    res = -ENOENT;
+
+    mutex_lock(&self_p->subscriptions.mutex);
+
+    node_p = &self_p->subscriptions.root;
+    level_p = subscription_p->filter_p;
+
+    do {
+        size = topic_level_next(level_p, &next_p);
+        node_p = topic_node_find(node_p, level_p, size);
+        level_p = next_p;
+    } while ((node_p != NULL) && (level_p != NULL));
+
+    if (node_p != NULL) {
+        next_pp = &node_p->subscriptions_p;
+
+        while (*next_pp != NULL) {
+            if (*next_pp == subscription_p) {
+                *next_pp = subscription_p->next_p;
+                topic_node_prune(self_p, &self_p->subscriptions.root);
+                res = 0;
+                break;
+            }
+
+            next_pp = &(*next_pp)->next_p;
+        }
+    }
+
+    mutex_unlock(&self_p->subscriptions.mutex);
+
+    return (res);
+}
+
+int mqtt_client_outbox_init(struct mqtt_client_t *self_p,
+                            struct mqtt_client_outbox_t *outbox_p,
+                            const char *path_p,
+                            void *buf_p,
+                            size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(outbox_p != NULL, EINVAL)
+    ASSERTN(path_p != NULL, EINVAL)
+    ASSERTN(buf_p != NULL, EINVAL)
+    ASSERTN(size > OUTBOX_RECORD_HEADER_SIZE, EINVAL)
+
+    int res;
+
+    outbox_p->path_p = path_p;
+    outbox_p->buf.buf_p = buf_p;
+    outbox_p->buf.size = size;
+
+    res = fs_open(&outbox_p->file, path_p, FS_RDWR | FS_CREAT);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    res = outbox_scan(outbox_p);
+
+    if (res != 0) {
+        fs_close(&outbox_p->file);
+
+        return (res);
+    }
+
+    self_p->outbox_p = outbox_p;
+
+    return (0);
+}
+
+int mqtt_client_set_on_publish_complete(
+    struct mqtt_client_t *self_p,
+    mqtt_on_publish_complete_t on_publish_complete)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+
+    self_p->on_publish_complete = on_publish_complete;
+
+    return (0);
+}
+
 int mqtt_client_publish(struct mqtt_client_t *self_p,
                         struct mqtt_application_message_t *message_p)
 {
     ASSERTN(self_p != NULL, EINVAL)
     ASSERTN(message_p != NULL, EINVAL)
+    ASSERTN(message_p->qos <= mqtt_qos_2_t, EINVAL)
 
-    return (control_routine(self_p,
-                            CONTROL_PUBLISH,
-                            &message_p,
-                            sizeof(message_p)));
+    return (publish(self_p, CONTROL_PUBLISH, message_p));
+}
+
+int mqtt_client_publish_async(struct mqtt_client_t *self_p,
+                              struct mqtt_application_message_t *message_p)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(message_p != NULL, EINVAL)
+    ASSERTN(message_p->qos <= mqtt_qos_2_t, EINVAL)
+
+    return (publish(self_p, CONTROL_PUBLISH_ASYNC, message_p));
 }
 
 int mqtt_client_subscribe(struct mqtt_client_t *self_p,
@@ -75,6 +75,90 @@ typedef size_t (*mqtt_on_publish_t)(struct mqtt_client_t *client_p,
 typedef int (*mqtt_on_error_t)(struct mqtt_client_t *client_p,
                                int error);
 
+struct mqtt_application_message_t;
+
+/**
+ * Prototype of the on-publish-complete callback function. Called by
+ * the client thread when a message published with
+ * `mqtt_client_publish_async()` has been delivered to the server, or
+ * stored in the outbox.
+ *
+ * @param[in] client_p The client.
+ * @param[in] message_p The published message.
+ * @param[in] res zero(0) if the message was delivered, otherwise
+ *                negative error code.
+ */
+typedef void (*mqtt_on_publish_complete_t)(
+    struct mqtt_client_t *client_p,
+    struct mqtt_application_message_t *message_p,
+    int res);
+
+/**
+ * A subscription in the client's topic registry. Incoming messages
+ * with a topic matching the filter are dispatched to the on-publish
+ * callback.
+ */
+struct mqtt_client_subscription_t {
+    const char *filter_p;
+    mqtt_on_publish_t on_publish;
+    struct mqtt_client_subscription_t *next_p;
+};
+
+/**
+ * A topic level node in the subscription trie.
+ */
+struct mqtt_client_topic_node_t {
+    const char *level_p;
+    size_t size;
+    struct mqtt_client_topic_node_t *children_p;
+    struct mqtt_client_topic_node_t *next_p;
+    struct mqtt_client_subscription_t *subscriptions_p;
+};
+
+/**
+ * Completion of a publish request. Owned by the publishing thread and
+ * signalled by the client thread with the result of the request.
+ */
+struct mqtt_client_completion_t {
+    struct sem_t sem;
+    int res;
+};
+
+/**
+ * An outgoing QoS 1 or QoS 2 message waiting for acknowledgement
+ * from the server. A blocking publisher waits on the completion of
+ * its own entry.
+ */
+struct mqtt_client_inflight_t {
+    struct mqtt_application_message_t *message_p;
+    struct mqtt_client_completion_t *completion_p;
+    ssize_t outbox_offset;
+    uint16_t packet_id;
+    int8_t state;
+    int8_t async;
+};
+
+/**
+ * Store-and-forward outbox. Outgoing QoS 1 and QoS 2 messages that
+ * cannot be sent to the server are appended to a file, and sent in
+ * order once connected.
+ */
+struct mqtt_client_outbox_t {
+    const char *path_p;
+    struct fs_file_t file;
+    struct {
+        uint8_t *buf_p;
+        size_t size;
+    } buf;
+    int count;
+    ssize_t read_offset;
+    ssize_t write_offset;
+    /* Records before this offset were found in the file when the
+       outbox was initialized, and may have been sent before a
+       restart. */
+    ssize_t recovered_offset;
+};
+
 /**
  * MQTT client.
  */
@@ -93,8 +177,26 @@ struct mqtt_client_t {
     struct {
         struct queue_t out;
         struct queue_t in;
+        struct mutex_t mutex;
     } control;
+    struct {
+        struct mqtt_client_inflight_t entries[
+            CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW];
+        struct sem_t sem;
+        uint16_t next_packet_id;
+    } inflight;
+    struct {
+        uint16_t packet_ids[CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW];
+    } incoming;
+    struct mqtt_client_outbox_t *outbox_p;
+    uint8_t payload_buf[CONFIG_MQTT_CLIENT_PAYLOAD_BUFFER_SIZE];
+    struct {
+        struct mqtt_client_topic_node_t root;
+        struct mqtt_client_topic_node_t *free_p;
+        struct mutex_t mutex;
+    } subscriptions;
     mqtt_on_publish_t on_publish;
+    mqtt_on_publish_complete_t on_publish_complete;
     mqtt_on_error_t on_error;
 };
 
@@ -122,7 +224,9 @@ struct mqtt_application_message_t {
  * @param[in] chout_p Output channel for client to server packets.
  * @param[in] chin_p Input channel for server to client packets.
  * @param[in] on_publish On-publish callback function. Called when the
- *                       server publishes a message.
+ *                       server publishes a message that does not match
+ *                       any subscription in the topic registry. May
+ *                       be NULL.
  * @param[in] on_error On-error callback function. Called when an error
  *                     occurs. If NULL, a default handler is used.
  *
@@ -174,18 +278,158 @@ int mqtt_client_disconnect(struct mqtt_client_t *self_p);
 int mqtt_client_ping(struct mqtt_client_t *self_p);
 
 /**
- * Publish given topic.
+ * Set the on-publish-complete callback function, called when a
+ * message published with `mqtt_client_publish_async()` has been
+ * delivered to the server.
+ *
+ * @param[in] self_p MQTT client.
+ * @param[in] on_publish_complete Callback function, or NULL.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mqtt_client_set_on_publish_complete(
+    struct mqtt_client_t *self_p,
+    mqtt_on_publish_complete_t on_publish_complete);
+
+/**
+ * Initialize the topic registry of given client with given topic
+ * level nodes. Each unique topic level in the subscription filters
+ * uses one node.
+ *
+ * @param[in] self_p MQTT client.
+ * @param[in] nodes_p Array of topic level nodes.
+ * @param[in] length Number of nodes in the array.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mqtt_client_subscriptions_init(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_topic_node_t *nodes_p,
+    int length);
+
+/**
+ * Initialize given subscription.
+ *
+ * @param[in] self_p Subscription to initialize.
+ * @param[in] filter_p Topic filter, optionally with the single level
+ *                     wildcard `+` and the multi level wildcard
+ *                     `#`. The string is referenced by the topic
+ *                     registry and must not be modified or freed,
+ *                     normally a string literal is used.
+ * @param[in] on_publish Called for each incoming message with a
+ *                       topic matching the filter.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mqtt_client_subscription_init(
+    struct mqtt_client_subscription_t *self_p,
+    const char *filter_p,
+    mqtt_on_publish_t on_publish);
+
+/**
+ * Add given subscription to the topic registry of given client. This
+ * only affects how incoming messages are dispatched in the client,
+ * use `mqtt_client_subscribe()` to subscribe to the topic on the
+ * server.
+ *
+ * Incoming messages are dispatched to all matching subscriptions,
+ * most specific filter first, but to at most
+ * `CONFIG_MQTT_CLIENT_SUBSCRIPTION_MATCHES_MAX` subscriptions. If
+ * several subscriptions match and the payload fits in
+ * `CONFIG_MQTT_CLIENT_PAYLOAD_BUFFER_SIZE` bytes, it is buffered and
+ * every callback reads the whole payload. Otherwise the payload is
+ * streamed from the transport channel to the callbacks, and a
+ * callback is given the part of the payload not already read by
+ * earlier callbacks. Any unread part of the payload is discarded
+ * after the last callback.
+ *
+ * The callbacks are called with the topic registry unlocked, so they
+ * may add and remove subscriptions.
+ *
+ * @param[in] self_p MQTT client.
+ * @param[in] subscription_p Subscription to add.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mqtt_client_subscription_add(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_subscription_t *subscription_p);
+
+/**
+ * Remove given subscription from the topic registry of given client.
+ * If called from an on-publish callback, the removed subscription may
+ * still be called for the message being dispatched.
+ *
+ * @param[in] self_p MQTT client.
+ * @param[in] subscription_p Subscription to remove.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mqtt_client_subscription_remove(
+    struct mqtt_client_t *self_p,
+    struct mqtt_client_subscription_t *subscription_p);
+
+/**
+ * Store QoS 1 and QoS 2 messages in given outbox file when they
+ * cannot be sent to the server. Stored messages are sent in order,
+ * with the duplicate flag set if they may have been sent before,
+ * once the client is connected. Messages left in the file by a
+ * previous session are sent as well.
+ *
+ * Call this function before the client thread is started.
  *
  * @param[in] self_p MQTT client.
- * @param[in] topic_p Topic.
- * @param[in] payload_p Payload to publish. May be NULL.
- * @param[in] payload_size Number of bytes in the payload.
+ * @param[in] outbox_p Outbox to initialize.
+ * @param[in] path_p Path of the outbox file, normally in a flash file
+ *                   system, for example SPIFFS.
+ * @param[in] buf_p Buffer used when storing messages and when sending
+ *                  stored messages. Messages that do not fit in the
+ *                  buffer are not stored.
+ * @param[in] size Size of the buffer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mqtt_client_outbox_init(struct mqtt_client_t *self_p,
+                            struct mqtt_client_outbox_t *outbox_p,
+                            const char *path_p,
+                            void *buf_p,
+                            size_t size);
+
+/**
+ * Publish given message and wait for the server to acknowledge
+ * it. The QoS 2 handshake is completed before this function returns.
+ *
+ * If an outbox is used, QoS 1 and QoS 2 messages that cannot be sent
+ * right away are stored in the outbox, and this function returns
+ * zero(0) once the message is stored.
+ *
+ * @param[in] self_p MQTT client.
+ * @param[in] message_p Message to publish.
  *
  * @return zero(0) or negative error code.
  */
 int mqtt_client_publish(struct mqtt_client_t *self_p,
                         struct mqtt_application_message_t *message_p);
 
+/**
+ * Publish given message without waiting for the server to
+ * acknowledge it. Up to `CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW` QoS 1
+ * and QoS 2 messages may be unacknowledged at the same time. The
+ * calling thread is suspended until there is room in the window.
+ *
+ * The on-publish-complete callback is called once the message has
+ * been delivered, or stored in the outbox. The message, topic and
+ * payload must not be modified or freed before then.
+ *
+ * @param[in] self_p MQTT client.
+ * @param[in] message_p Message to publish.
+ *
+ * @return zero(0) if the message was written to the server or
+ *         stored in the outbox, otherwise negative error code.
+ */
+int mqtt_client_publish_async(struct mqtt_client_t *self_p,
+                              struct mqtt_application_message_t *message_p);
+
 /**
  * Subscribe to given message.
  *
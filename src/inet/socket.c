@@ -1400,58 +1400,782 @@ ssize_t socket_size(struct socket_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    return (self_p->input.u.common.left != 0);
+    /* Number of bytes left in the current input buffer, or one if
+       the connection is closed. */
+    if (self_p->input.u.common.left < 0) {
+        return (1);
+    }
+
+    return (self_p->input.u.common.left);
 }
 
 #else
 
+/*
+ * Linux implementation. Each socket is a non-blocking kernel socket
+ * registered in an edge-triggered epoll instance. A single reactor
+ * (host) thread waits for events and resumes the Simba threads that
+ * are blocked on, or polling, the sockets. All socket system calls are
+ * made with the system lock taken so no event is lost between a
+ * failed call and the thread being suspended.
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netdb.h>
+
+#define EVENTS_MAX                                         16
+
+struct module_t {
+    int8_t initialized;
+    int epoll_fd;
+    pthread_t reactor;
+    /* Closed sockets wait for the reactor to finish any batch of
+       events that may refer to them. */
+    struct {
+        int fd;
+        int pending;
+        struct sem_t sem;
+    } drain;
+    struct fs_counter_t udp_rx_bytes;
+    struct fs_counter_t udp_tx_bytes;
+    struct fs_counter_t tcp_accepts;
+    struct fs_counter_t tcp_rx_bytes;
+    struct fs_counter_t tcp_tx_bytes;
+#if CONFIG_SOCKET_RAW == 1
+    struct fs_counter_t raw_rx_bytes;
+    struct fs_counter_t raw_tx_bytes;
+#endif
+};
+
+static struct module_t module;
+
+static void inet_addr_to_sockaddr(struct sockaddr_in *dst_p,
+                                  const struct inet_addr_t *src_p)
+{
+    memset(dst_p, 0, sizeof(*dst_p));
+    dst_p->sin_family = AF_INET;
+    dst_p->sin_addr.s_addr = src_p->ip.number;
+    dst_p->sin_port = htons(src_p->port);
+}
+
+static void sockaddr_to_inet_addr(struct inet_addr_t *dst_p,
+                                  const struct sockaddr_in *src_p)
+{
+    dst_p->ip.number = src_p->sin_addr.s_addr;
+    dst_p->port = ntohs(src_p->sin_port);
+}
+
+/**
+ * Resume the thread waiting in given state, if any. Called by the
+ * reactor with the system lock taken.
+ */
+static int resume_waiting_isr(int *state_p, struct thrd_t *thrd_p)
+{
+    if (*state_p == STATE_IDLE) {
+        return (0);
+    }
+
+    *state_p = STATE_IDLE;
+    thrd_resume_isr(thrd_p, 0);
+
+    return (1);
+}
+
+static int resume_if_polled_isr(struct socket_t *socket_p)
+{
+    if (chan_is_polled_isr(&socket_p->base) == 0) {
+        return (0);
+    }
+
+    thrd_resume_isr(socket_p->base.reader_p, 0);
+    socket_p->base.reader_p = NULL;
+
+    return (1);
+}
+
+/**
+ * The reactor thread.
+ */
+static void *reactor_main(void *arg_p)
+{
+    struct epoll_event events[EVENTS_MAX];
+    struct socket_t *socket_p;
+    eventfd_t value;
+    int i;
+    int number_of_events;
+    int resumed;
+
+    while (1) {
+        number_of_events = epoll_wait(module.epoll_fd,
+                                      &events[0],
+                                      membersof(events),
+                                      -1);
+
+        if (number_of_events <= 0) {
+            continue;
+        }
+
+        resumed = 0;
+
+        sys_lock();
+
+        for (i = 0; i < number_of_events; i++) {
+            socket_p = events[i].data.ptr;
+
+            /* A socket is being closed. */
+            if (socket_p == NULL) {
+                eventfd_read(module.drain.fd, &value);
+                continue;
+            }
+
+            /* Closed after the event was reported. */
+            if (socket_p->fd == -1) {
+                continue;
+            }
+
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                if (resume_waiting_isr(&socket_p->input.cb.state,
+                                       socket_p->input.cb.thrd_p) == 1) {
+                    resumed = 1;
+                } else if (resume_if_polled_isr(socket_p) == 1) {
+                    resumed = 1;
+                }
+            }
+
+            if (events[i].events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+                if (resume_waiting_isr(&socket_p->output.cb.state,
+                                       socket_p->output.cb.thrd_p) == 1) {
+                    resumed = 1;
+                }
+            }
+        }
+
+        /* No events of closed sockets remain, so they can be
+           freed. */
+        if (module.drain.pending > 0) {
+            sem_give_isr(&module.drain.sem, module.drain.pending);
+            module.drain.pending = 0;
+            resumed = 1;
+        }
+
+        sys_unlock();
+
+        /* Let the idle thread schedule the resumed threads. */
+        if (resumed == 1) {
+            thrd_port_idle_signal();
+        }
+    }
+
+    return (NULL);
+}
+
+/**
+ * Wait for the reactor to report an input event on given
+ * socket. Must be called with the system lock taken. Returns
+ * -EBADF if the socket was closed while waiting.
+ */
+static int wait_input_isr(struct socket_t *self_p, int state)
+{
+    self_p->input.cb.state = state;
+    self_p->input.cb.thrd_p = thrd_self();
+
+    return (thrd_suspend_isr(NULL));
+}
+
+/**
+ * Wait for the reactor to report an output event on given
+ * socket. Must be called with the system lock taken. Returns
+ * -EBADF if the socket was closed while waiting.
+ */
+static int wait_output_isr(struct socket_t *self_p, int state)
+{
+    self_p->output.cb.state = state;
+    self_p->output.cb.thrd_p = thrd_self();
+
+    return (thrd_suspend_isr(NULL));
+}
+
+static int is_writable(struct socket_t *self_p)
+{
+    struct pollfd fds;
+
+    fds.fd = self_p->fd;
+    fds.events = POLLOUT;
+
+    return (poll(&fds, 1, 0) == 1);
+}
+
+static int init(struct socket_t *self_p, int type, int fd)
+{
+    struct epoll_event event;
+
+    chan_init(&self_p->base,
+              (chan_read_fn_t)socket_read,
+              (chan_write_fn_t)socket_write,
+              (chan_size_fn_t)socket_size);
+
+    self_p->type = type;
+    self_p->pcb_p = NULL;
+    self_p->fd = fd;
+    self_p->input.cb.state = STATE_IDLE;
+    self_p->input.u.common.left = 0;
+    self_p->output.cb.state = STATE_IDLE;
+
+    event.events = (EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET);
+    event.data.ptr = self_p;
+
+    if (epoll_ctl(module.epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        close(fd);
+        self_p->fd = -1;
+
+        return (-errno);
+    }
+
+    return (0);
+}
+
+static int open_fd(struct socket_t *self_p,
+                   int type,
+                   int linux_type,
+                   int protocol)
+{
+    int fd;
+
+    fd = socket(AF_INET, linux_type | SOCK_NONBLOCK | SOCK_CLOEXEC, protocol);
+
+    if (fd < 0) {
+        return (-errno);
+    }
+
+    return (init(self_p, type, fd));
+}
+
+static ssize_t send_to(struct socket_t *self_p,
+                       const void *buf_p,
+                       size_t size,
+                       const struct inet_addr_t *remote_addr_p)
+{
+    struct sockaddr_in addr;
+    ssize_t res;
+
+    if (remote_addr_p != NULL) {
+        inet_addr_to_sockaddr(&addr, remote_addr_p);
+    }
+
+    sys_lock();
+
+    while (1) {
+        if (remote_addr_p != NULL) {
+            res = sendto(self_p->fd,
+                         buf_p,
+                         size,
+                         MSG_NOSIGNAL,
+                         (struct sockaddr *)&addr,
+                         sizeof(addr));
+        } else {
+            res = send(self_p->fd, buf_p, size, MSG_NOSIGNAL);
+        }
+
+        if (res >= 0) {
+            break;
+        } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            res = wait_output_isr(self_p, STATE_SENDTO);
+
+            if (res != 0) {
+                break;
+            }
+        } else if (errno != EINTR) {
+            res = -errno;
+            break;
+        }
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+static ssize_t recv_from(struct socket_t *self_p,
+                         void *buf_p,
+                         size_t size,
+                         struct inet_addr_t *remote_addr_p)
+{
+    struct sockaddr_in addr;
+    socklen_t addr_size;
+    ssize_t res;
+
+    sys_lock();
+
+    while (1) {
+        addr_size = sizeof(addr);
+        res = recvfrom(self_p->fd,
+                       buf_p,
+                       size,
+                       0,
+                       (struct sockaddr *)&addr,
+                       &addr_size);
+
+        if (res >= 0) {
+            break;
+        } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            res = wait_input_isr(self_p, STATE_RECVFROM);
+
+            if (res != 0) {
+                break;
+            }
+        } else if (errno != EINTR) {
+            res = -errno;
+            break;
+        }
+    }
+
+    sys_unlock();
+
+    if ((res >= 0) && (remote_addr_p != NULL)) {
+        sockaddr_to_inet_addr(remote_addr_p, &addr);
+    }
+
+    return (res);
+}
+
+/**
+ * Write all data. Returns when all data has been written or the
+ * connection is broken.
+ */
+static ssize_t tcp_send_to(struct socket_t *self_p,
+                           const void *buf_p,
+                           size_t size)
+{
+    const char *b_p;
+    size_t left;
+    ssize_t res;
+
+    b_p = buf_p;
+    left = size;
+
+    sys_lock();
+
+    while (left > 0) {
+        res = send(self_p->fd, b_p, left, MSG_NOSIGNAL);
+
+        if (res >= 0) {
+            b_p += res;
+            left -= res;
+        } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            if (wait_output_isr(self_p, STATE_SENDTO) != 0) {
+                break;
+            }
+        } else if (errno != EINTR) {
+            break;
+        }
+    }
+
+    sys_unlock();
+
+    fs_counter_increment(&module.tcp_tx_bytes, size - left);
+
+    return (size - left);
+}
+
+/**
+ * Read given number of bytes. Less bytes are returned only if the
+ * connection is closed by the remote peer.
+ */
+static ssize_t tcp_recv_from(struct socket_t *self_p,
+                             void *buf_p,
+                             size_t size)
+{
+    char *b_p;
+    size_t left;
+    ssize_t res;
+
+    b_p = buf_p;
+    left = size;
+
+    sys_lock();
+
+    while (left > 0) {
+        res = recv(self_p->fd, b_p, left, 0);
+
+        if (res > 0) {
+            b_p += res;
+            left -= res;
+        } else if (res == 0) {
+            /* Connection closed. */
+            break;
+        } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            if (wait_input_isr(self_p, STATE_RECVFROM) != 0) {
+                break;
+            }
+        } else if (errno != EINTR) {
+            break;
+        }
+    }
+
+    sys_unlock();
+
+    fs_counter_increment(&module.tcp_rx_bytes, size - left);
+
+    return (size - left);
+}
+
 int socket_module_init(void)
 {
+    struct epoll_event event;
+
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+
+    /* UDP counters. */
+    fs_counter_init(&module.udp_rx_bytes,
+                    FSTR("/inet/socket/udp/rx_bytes"),
+                    0);
+    fs_counter_register(&module.udp_rx_bytes);
+
+    fs_counter_init(&module.udp_tx_bytes,
+                    FSTR("/inet/socket/udp/tx_bytes"),
+                    0);
+    fs_counter_register(&module.udp_tx_bytes);
+
+    /* TCP counters. */
+    fs_counter_init(&module.tcp_accepts,
+                    FSTR("/inet/socket/tcp/accepts"),
+                    0);
+    fs_counter_register(&module.tcp_accepts);
+
+    fs_counter_init(&module.tcp_rx_bytes,
+                    FSTR("/inet/socket/tcp/rx_bytes"),
+                    0);
+    fs_counter_register(&module.tcp_rx_bytes);
+
+    fs_counter_init(&module.tcp_tx_bytes,
+                    FSTR("/inet/socket/tcp/tx_bytes"),
+                    0);
+    fs_counter_register(&module.tcp_tx_bytes);
+
+#if CONFIG_SOCKET_RAW == 1
+
+    fs_counter_init(&module.raw_rx_bytes,
+                    FSTR("/inet/socket/raw/rx_bytes"),
+                    0);
+    fs_counter_register(&module.raw_rx_bytes);
+
+    fs_counter_init(&module.raw_tx_bytes,
+                    FSTR("/inet/socket/raw/tx_bytes"),
+                    0);
+    fs_counter_register(&module.raw_tx_bytes);
+
+#endif
+
+    module.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (module.epoll_fd < 0) {
+        return (-errno);
+    }
+
+    /* Closing sockets wake the reactor with the drain event file
+       descriptor, which has a NULL socket pointer. */
+    module.drain.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (module.drain.fd < 0) {
+        return (-errno);
+    }
+
+    /* All resources taken, so that every give wakes a closing
+       thread or lets the next one pass. */
+    module.drain.pending = 0;
+    sem_init(&module.drain.sem, INT_MAX, INT_MAX);
+    event.events = (EPOLLIN | EPOLLET);
+    event.data.ptr = NULL;
+
+    if (epoll_ctl(module.epoll_fd,
+                  EPOLL_CTL_ADD,
+                  module.drain.fd,
+                  &event) != 0) {
+        return (-errno);
+    }
+
+    /* Start the reactor thread. */
+    if (pthread_create(&module.reactor, NULL, reactor_main, NULL) != 0) {
+        return (-ENOMEM);
+    }
+
     return (0);
 }
 
 int socket_open_tcp(struct socket_t *self_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (open_fd(self_p, SOCKET_TYPE_STREAM, SOCK_STREAM, 0));
 }
 
 int socket_open_udp(struct socket_t *self_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (open_fd(self_p, SOCKET_TYPE_DGRAM, SOCK_DGRAM, 0));
 }
 
 int socket_open_raw(struct socket_t *self_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+
+#if CONFIG_SOCKET_RAW == 1
+    return (open_fd(self_p, SOCKET_TYPE_RAW, SOCK_RAW, IPPROTO_ICMP));
+#else
+    return (-1);
+#endif
+}
+
+int socket_open(struct socket_t *self_p,
+                int domain,
+                int type,
+                int protocol)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    int res = -1;
+
+    switch (type) {
+
+    case SOCKET_TYPE_STREAM:
+        res = socket_open_tcp(self_p);
+        break;
+
+    case SOCKET_TYPE_DGRAM:
+        res = socket_open_udp(self_p);
+        break;
+
+    case SOCKET_TYPE_RAW:
+        res = socket_open_raw(self_p);
+        break;
+
+    default:
+        break;
+    }
+
+    return (res);
 }
 
 int socket_close(struct socket_t *self_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+
+    int fd;
+
+    sys_lock();
+
+    fd = self_p->fd;
+
+    if (fd == -1) {
+        sys_unlock();
+
+        return (-1);
+    }
+
+    self_p->fd = -1;
+    epoll_ctl(module.epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    close(fd);
+
+    /* Wake threads blocked on, or polling, the socket. */
+    if (self_p->input.cb.state != STATE_IDLE) {
+        self_p->input.cb.state = STATE_IDLE;
+        thrd_resume_isr(self_p->input.cb.thrd_p, -EBADF);
+    }
+
+    if (self_p->output.cb.state != STATE_IDLE) {
+        self_p->output.cb.state = STATE_IDLE;
+        thrd_resume_isr(self_p->output.cb.thrd_p, -EBADF);
+    }
+
+    resume_if_polled_isr(self_p);
+    module.drain.pending++;
+
+    sys_unlock();
+
+    /* Wait for the reactor to finish the batch of events it is
+       processing, as it may refer to this socket. */
+    eventfd_write(module.drain.fd, 1);
+    sem_take(&module.drain.sem, NULL);
+
+    return (0);
 }
 
 int socket_bind(struct socket_t *self_p,
                 const struct inet_addr_t *local_addr_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(local_addr_p != NULL, EINVAL);
+
+    struct sockaddr_in addr;
+    int value;
+
+    inet_addr_to_sockaddr(&addr, local_addr_p);
+
+    /* Allow immediate rebind of a listener in tests and servers. */
+    value = 1;
+    setsockopt(self_p->fd, SOL_SOCKET, SO_REUSEADDR, &value, sizeof(value));
+
+    if (bind(self_p->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        return (-errno);
+    }
+
+    return (0);
 }
 
 int socket_listen(struct socket_t *self_p, int backlog)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(backlog >= 0, EINVAL);
+
+    if (self_p->type != SOCKET_TYPE_STREAM) {
+        return (-1);
+    }
+
+    if (listen(self_p->fd, backlog) != 0) {
+        return (-errno);
+    }
+
+    return (0);
 }
 
 int socket_connect(struct socket_t *self_p,
-                   const struct inet_addr_t *addr_p)
+                   const struct inet_addr_t *remote_addr_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(remote_addr_p != NULL, EINVAL);
+
+    struct sockaddr_in addr;
+    socklen_t size;
+    int res;
+    int err;
+
+    inet_addr_to_sockaddr(&addr, remote_addr_p);
+
+    sys_lock();
+
+    res = connect(self_p->fd, (struct sockaddr *)&addr, sizeof(addr));
+
+    if ((res != 0) && (errno == EINPROGRESS)) {
+        /* The socket becomes writable when the three-way handshake
+           is complete, or has failed. */
+        res = 0;
+
+        while ((res == 0) && (is_writable(self_p) == 0)) {
+            res = wait_output_isr(self_p, STATE_CONNECT);
+        }
+
+        if (res == 0) {
+            size = sizeof(err);
+
+            if (getsockopt(self_p->fd,
+                           SOL_SOCKET,
+                           SO_ERROR,
+                           &err,
+                           &size) != 0) {
+                err = errno;
+            }
+
+            res = -err;
+        }
+    } else if (res != 0) {
+        res = -errno;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int socket_connect_by_hostname(struct socket_t *self_p,
+                               const char *hostname_p,
+                               uint16_t port)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(hostname_p != NULL, EINVAL);
+    ASSERTN(self_p->type == SOCKET_TYPE_STREAM, EINVAL);
+
+    struct addrinfo hints;
+    struct addrinfo *info_p;
+    struct inet_addr_t remote_addr;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    /* Blocks the whole system, but name lookups are rare. */
+    if (getaddrinfo(hostname_p, NULL, &hints, &info_p) != 0) {
+        return (-1);
+    }
+
+    sockaddr_to_inet_addr(&remote_addr,
+                          (struct sockaddr_in *)info_p->ai_addr);
+    remote_addr.port = port;
+    freeaddrinfo(info_p);
+
+    return (socket_connect(self_p, &remote_addr));
 }
 
 int socket_accept(struct socket_t *self_p,
                   struct socket_t *accepted_p,
-                  struct inet_addr_t *addr_p)
+                  struct inet_addr_t *remote_addr_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(accepted_p != NULL, EINVAL);
+
+    struct sockaddr_in addr;
+    socklen_t size;
+    int fd;
+    int value;
+
+    sys_lock();
+
+    while (1) {
+        size = sizeof(addr);
+        fd = accept(self_p->fd, (struct sockaddr *)&addr, &size);
+
+        if (fd >= 0) {
+            /* The accepted socket does not inherit the non-blocking
+               flag on Linux. */
+            value = 1;
+            ioctl(fd, FIONBIO, &value);
+            break;
+        } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            if (wait_input_isr(self_p, STATE_ACCEPT) != 0) {
+                sys_unlock();
+
+                return (-EBADF);
+            }
+        } else if (errno != EINTR) {
+            sys_unlock();
+
+            return (-errno);
+        }
+    }
+
+    sys_unlock();
+
+    fs_counter_increment(&module.tcp_accepts, 1);
+
+    if (remote_addr_p != NULL) {
+        sockaddr_to_inet_addr(remote_addr_p, &addr);
+    }
+
+    return (init(accepted_p, SOCKET_TYPE_STREAM, fd));
 }
 
 ssize_t socket_sendto(struct socket_t *self_p,
@@ -1460,7 +2184,42 @@ ssize_t socket_sendto(struct socket_t *self_p,
                       int flags,
                       const struct inet_addr_t *remote_addr_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+
+    ssize_t res;
+
+    switch (self_p->type) {
+
+    case SOCKET_TYPE_STREAM:
+        return (tcp_send_to(self_p, buf_p, size));
+
+    case SOCKET_TYPE_DGRAM:
+        res = send_to(self_p, buf_p, size, remote_addr_p);
+
+        if (res > 0) {
+            fs_counter_increment(&module.udp_tx_bytes, res);
+        }
+
+        return (res);
+
+#if CONFIG_SOCKET_RAW == 1
+
+    case SOCKET_TYPE_RAW:
+        res = send_to(self_p, buf_p, size, remote_addr_p);
+
+        if (res > 0) {
+            fs_counter_increment(&module.raw_tx_bytes, res);
+        }
+
+        return (res);
+
+#endif
+
+    default:
+        return (-1);
+    }
 }
 
 ssize_t socket_recvfrom(struct socket_t *self_p,
@@ -1469,7 +2228,42 @@ ssize_t socket_recvfrom(struct socket_t *self_p,
                         int flags,
                         struct inet_addr_t *remote_addr_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+
+    ssize_t res;
+
+    switch (self_p->type) {
+
+    case SOCKET_TYPE_STREAM:
+        return (tcp_recv_from(self_p, buf_p, size));
+
+    case SOCKET_TYPE_DGRAM:
+        res = recv_from(self_p, buf_p, size, remote_addr_p);
+
+        if (res > 0) {
+            fs_counter_increment(&module.udp_rx_bytes, res);
+        }
+
+        return (res);
+
+#if CONFIG_SOCKET_RAW == 1
+
+    case SOCKET_TYPE_RAW:
+        res = recv_from(self_p, buf_p, size, remote_addr_p);
+
+        if (res > 0) {
+            fs_counter_increment(&module.raw_rx_bytes, res);
+        }
+
+        return (res);
+
+#endif
+
+    default:
+        return (-1);
+    }
 }
 
 ssize_t socket_write(struct socket_t *self_p,
@@ -1498,7 +2292,24 @@ ssize_t socket_size(struct socket_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    return (-ENOSYS);
+    struct pollfd fds;
+    int size;
+
+    /* Readable, a pending connection or closed by the remote peer. */
+    fds.fd = self_p->fd;
+    fds.events = POLLIN;
+
+    if (poll(&fds, 1, 0) != 1) {
+        return (0);
+    }
+
+    /* Number of received bytes, if known, so the reader can read
+       them all at once. */
+    if ((ioctl(self_p->fd, FIONREAD, &size) == 0) && (size > 0)) {
+        return (size);
+    }
+
+    return (1);
 }
 
 #endif
@@ -80,12 +80,15 @@ struct socket_t {
         } cb;
     } output;
     void *pcb_p;
+#if defined(ARCH_LINUX)
+    int fd;
+#endif
 };
 
 /**
  * Initialize the socket module. This function will start the lwIP
- * TCP/IP stack. This function must be called before calling any other
- * function in this module.
+ * TCP/IP stack, or the epoll reactor thread on Linux. This function
+ * must be called before calling any other function in this module.
  *
  * The module will only be initialized once even if this function is
  * called multiple times.
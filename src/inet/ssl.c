@@ -41,6 +41,26 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/timing.h"
+#include "mbedtls/ssl_cache.h"
+#include "mbedtls/ssl_ticket.h"
+#include "mbedtls/version.h"
+/* Private mbedTLS definitions, only used by is_handshake_over(). */
+#include "mbedtls/ssl_internal.h"
+#include "mbedtls/platform.h"
+
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+
+/**
+ * A client side session stored for resumption. The entry is unused
+ * if the hostname is empty.
+ */
+struct client_session_t {
+    char hostname[CONFIG_SSL_SESSION_CACHE_HOSTNAME_MAX];
+    mbedtls_ssl_session session;
+    uint32_t last_used;
+};
+
+#endif
 
 struct module_t {
     int8_t initialized;
@@ -54,6 +74,28 @@ struct module_t {
     mbedtls_pk_context key;
     mbedtls_x509_crt ca_certs;
     mbedtls_timing_delay_context timer;
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+    struct {
+        struct client_session_t entries[CONFIG_SSL_SESSION_CACHE_CLIENT_MAX];
+        uint32_t counter;
+    } client_sessions;
+#endif
+#if CONFIG_SSL_SESSION_CACHE_SERVER_MAX > 0
+    mbedtls_ssl_cache_context cache;
+#endif
+#if CONFIG_SSL_SESSION_TICKETS == 1
+    mbedtls_ssl_ticket_context ticket;
+#endif
+    struct fs_counter_t full_handshakes;
+    struct fs_counter_t resumed_handshakes;
+#if CONFIG_SSL_SOCKET_HEAP_SIZE > 0
+    struct {
+        struct heap_t heap;
+        int active;
+        size_t sizes[HEAP_FIXED_SIZES_MAX];
+        uint8_t buf[CONFIG_SSL_SOCKET_HEAP_SIZE];
+    } socket_heap;
+#endif
 };
 
 static struct module_t module;
@@ -90,6 +132,136 @@ static void free_conf(void *conf_p)
     module.conf_allocated = 0;
 }
 
+#if CONFIG_SSL_SOCKET_HEAP_SIZE > 0
+
+static int is_socket_heap_buffer(void *buf_p)
+{
+    return (((uint8_t *)buf_p >= &module.socket_heap.buf[0])
+            && ((uint8_t *)buf_p < &module.socket_heap.buf[CONFIG_SSL_SOCKET_HEAP_SIZE]));
+}
+
+/**
+ * The mbedTLS calloc function. Allocates from the socket heap while
+ * a socket is open, and from the system heap otherwise.
+ */
+static void *socket_heap_calloc(size_t nmemb, size_t size)
+{
+    void *buf_p;
+    size_t total;
+
+    if (module.socket_heap.active == 0) {
+        return (calloc(nmemb, size));
+    }
+
+    total = (nmemb * size);
+
+    if ((total == 0) || (total / nmemb != size)) {
+        return (NULL);
+    }
+
+    buf_p = heap_alloc(&module.socket_heap.heap, total);
+
+    if (buf_p != NULL) {
+        memset(buf_p, 0, total);
+    }
+
+    return (buf_p);
+}
+
+/**
+ * The mbedTLS free function. Buffers in the socket heap are not
+ * freed after the heap has been released.
+ */
+static void socket_heap_free(void *buf_p)
+{
+    if (buf_p == NULL) {
+        return;
+    }
+
+    if (is_socket_heap_buffer(buf_p)) {
+        if (module.socket_heap.active == 1) {
+            heap_free(&module.socket_heap.heap, buf_p);
+        }
+    } else {
+        free(buf_p);
+    }
+}
+
+/**
+ * Start allocating from an empty socket heap.
+ */
+static void socket_heap_acquire(void)
+{
+    heap_init(&module.socket_heap.heap,
+              &module.socket_heap.buf[0],
+              sizeof(module.socket_heap.buf),
+              &module.socket_heap.sizes[0]);
+    module.socket_heap.active = 1;
+}
+
+/**
+ * Release all buffers in the socket heap at once, and allocate from
+ * the system heap.
+ */
+static void socket_heap_release(void)
+{
+    module.socket_heap.active = 0;
+}
+
+/**
+ * Suspend allocations from the socket heap. Used when allocating
+ * data that outlives the socket.
+ */
+static inline int socket_heap_suspend(void)
+{
+    int active;
+
+    active = module.socket_heap.active;
+    module.socket_heap.active = 0;
+
+    return (active);
+}
+
+static inline void socket_heap_resume(int active)
+{
+    module.socket_heap.active = active;
+}
+
+static size_t socket_heap_get_used_max(void)
+{
+    struct heap_stats_t stats;
+
+    heap_get_stats(&module.socket_heap.heap, &stats);
+
+    return (stats.used_max);
+}
+
+#else
+
+static void socket_heap_acquire(void)
+{
+}
+
+static void socket_heap_release(void)
+{
+}
+
+static inline int socket_heap_suspend(void)
+{
+    return (0);
+}
+
+static inline void socket_heap_resume(int active)
+{
+}
+
+static size_t socket_heap_get_used_max(void)
+{
+    return (0);
+}
+
+#endif
+
 static int ssl_send(void *ctx_p,
                     const unsigned char *buf_p,
                     size_t len)
@@ -104,6 +276,215 @@ static int ssl_recv(void *ctx_p,
     return (socket_read(ctx_p, buf_p, len));
 }
 
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+
+/**
+ * Find the stored session of given server hostname.
+ */
+static struct client_session_t *client_session_find(const char *hostname_p)
+{
+    int i;
+    struct client_session_t *entry_p;
+
+    for (i = 0; i < membersof(module.client_sessions.entries); i++) {
+        entry_p = &module.client_sessions.entries[i];
+
+        if ((entry_p->hostname[0] != '\0')
+            && (strcmp(entry_p->hostname, hostname_p) == 0)) {
+            return (entry_p);
+        }
+    }
+
+    return (NULL);
+}
+
+static void client_session_remove(struct client_session_t *entry_p)
+{
+    mbedtls_ssl_session_free(&entry_p->session);
+    entry_p->hostname[0] = '\0';
+}
+
+/**
+ * Store the session of given connected SSL context, replacing the
+ * previous session of the same server, an unused entry or the least
+ * recently used entry.
+ */
+static void client_session_save(mbedtls_ssl_context *ssl_p,
+                                const char *hostname_p)
+{
+    int i;
+    int res;
+    int active;
+    struct client_session_t *entry_p;
+    struct client_session_t *candidate_p;
+
+    if (strlen(hostname_p) >= CONFIG_SSL_SESSION_CACHE_HOSTNAME_MAX) {
+        return;
+    }
+
+    entry_p = client_session_find(hostname_p);
+
+    if (entry_p == NULL) {
+        entry_p = &module.client_sessions.entries[0];
+
+        for (i = 1; i < membersof(module.client_sessions.entries); i++) {
+            candidate_p = &module.client_sessions.entries[i];
+
+            if (entry_p->hostname[0] == '\0') {
+                break;
+            }
+
+            if ((candidate_p->hostname[0] == '\0')
+                || (candidate_p->last_used < entry_p->last_used)) {
+                entry_p = candidate_p;
+            }
+        }
+    }
+
+    if (entry_p->hostname[0] != '\0') {
+        client_session_remove(entry_p);
+    }
+
+    mbedtls_ssl_session_init(&entry_p->session);
+
+    /* The stored session outlives the socket. */
+    active = socket_heap_suspend();
+    res = mbedtls_ssl_get_session(ssl_p, &entry_p->session);
+
+    if (res != 0) {
+        mbedtls_ssl_session_free(&entry_p->session);
+    }
+
+    socket_heap_resume(active);
+
+    if (res != 0) {
+        return;
+    }
+
+    strcpy(&entry_p->hostname[0], hostname_p);
+    entry_p->last_used = module.client_sessions.counter++;
+}
+
+static void client_sessions_clear(void)
+{
+    int i;
+
+    for (i = 0; i < membersof(module.client_sessions.entries); i++) {
+        if (module.client_sessions.entries[i].hostname[0] != '\0') {
+            client_session_remove(&module.client_sessions.entries[i]);
+        }
+    }
+}
+
+#endif
+
+#if CONFIG_SSL_SESSION_CACHE_SERVER_MAX > 0
+
+/**
+ * Store given session in the server side session cache. The cache
+ * entry outlives the socket.
+ */
+static int cache_set(void *data_p, const mbedtls_ssl_session *session_p)
+{
+    int res;
+    int active;
+
+    active = socket_heap_suspend();
+    res = mbedtls_ssl_cache_set(data_p, session_p);
+    socket_heap_resume(active);
+
+    return (res);
+}
+
+#endif
+
+/**
+ * Configure the server side session cache and session tickets of
+ * given context.
+ */
+static int configure_server_sessions(struct ssl_context_t *self_p)
+{
+#if CONFIG_SSL_SESSION_CACHE_SERVER_MAX > 0
+    mbedtls_ssl_cache_init(&module.cache);
+    mbedtls_ssl_cache_set_max_entries(&module.cache,
+                                      CONFIG_SSL_SESSION_CACHE_SERVER_MAX);
+    mbedtls_ssl_conf_session_cache(self_p->conf_p,
+                                   &module.cache,
+                                   mbedtls_ssl_cache_get,
+                                   cache_set);
+    self_p->cache_p = &module.cache;
+#endif
+
+#if CONFIG_SSL_SESSION_TICKETS == 1
+    mbedtls_ssl_ticket_init(&module.ticket);
+
+    if (mbedtls_ssl_ticket_setup(&module.ticket,
+                                 mbedtls_ctr_drbg_random,
+                                 &module.ctr_drbg,
+                                 MBEDTLS_CIPHER_AES_256_GCM,
+                                 CONFIG_SSL_SESSION_TICKET_LIFETIME) != 0) {
+        mbedtls_ssl_ticket_free(&module.ticket);
+
+#    if CONFIG_SSL_SESSION_CACHE_SERVER_MAX > 0
+        mbedtls_ssl_conf_session_cache(self_p->conf_p, NULL, NULL, NULL);
+        mbedtls_ssl_cache_free(&module.cache);
+        self_p->cache_p = NULL;
+#    endif
+
+        return (-1);
+    }
+
+    mbedtls_ssl_conf_session_tickets_cb(self_p->conf_p,
+                                        mbedtls_ssl_ticket_write,
+                                        mbedtls_ssl_ticket_parse,
+                                        &module.ticket);
+    self_p->ticket_p = &module.ticket;
+#endif
+
+    return (0);
+}
+
+/* The handshake state and parameters are private in mbedTLS 3. */
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+#    error "The handshake state is not accessible in mbedTLS 3."
+#endif
+
+/**
+ * Returns true(1) if the handshake of given context is over. Sets
+ * the resumed flag before the last step, as the handshake parameters
+ * are freed in it. This is the only function accessing private
+ * mbedTLS context members, checked against mbedTLS 2.4.
+ */
+static int is_handshake_over(mbedtls_ssl_context *ssl_p, int *resumed_p)
+{
+    if (ssl_p->state == MBEDTLS_SSL_HANDSHAKE_WRAPUP) {
+        *resumed_p = (ssl_p->handshake->resume == 1);
+    }
+
+    return (ssl_p->state == MBEDTLS_SSL_HANDSHAKE_OVER);
+}
+
+/**
+ * Perform the handshake with the remote peer. It is performed one
+ * step at a time to find out if the session was resumed.
+ */
+static int handshake(mbedtls_ssl_context *ssl_p, int *resumed_p)
+{
+    int res;
+
+    *resumed_p = 0;
+
+    while (!is_handshake_over(ssl_p, resumed_p)) {
+        res = mbedtls_ssl_handshake_step(ssl_p);
+
+        if (res != 0) {
+            return (res);
+        }
+    }
+
+    return (0);
+}
+
 int ssl_module_init()
 {
     /* Return immediately if the module is already initialized. */
@@ -113,6 +494,17 @@ int ssl_module_init()
 
     module.initialized = 1;
 
+#if CONFIG_SSL_SOCKET_HEAP_SIZE > 0
+    module.socket_heap.active = 0;
+    memset(&module.socket_heap.sizes[0], 0, sizeof(module.socket_heap.sizes));
+    heap_init(&module.socket_heap.heap,
+              &module.socket_heap.buf[0],
+              sizeof(module.socket_heap.buf),
+              &module.socket_heap.sizes[0]);
+    heap_register(&module.socket_heap.heap, "ssl_socket");
+    mbedtls_platform_set_calloc_free(socket_heap_calloc, socket_heap_free);
+#endif
+
     mbedtls_entropy_init(&module.entropy);
     mbedtls_ctr_drbg_init(&module.ctr_drbg);
 
@@ -125,6 +517,16 @@ int ssl_module_init()
         return (-1);
     }
 
+    fs_counter_init(&module.full_handshakes,
+                    FSTR("/inet/ssl/handshakes/full"),
+                    0);
+    fs_counter_register(&module.full_handshakes);
+
+    fs_counter_init(&module.resumed_handshakes,
+                    FSTR("/inet/ssl/handshakes/resumed"),
+                    0);
+    fs_counter_register(&module.resumed_handshakes);
+
     return (0);
 }
 
@@ -150,6 +552,8 @@ int ssl_context_init(struct ssl_context_t *self_p,
 
     self_p->server_side = -1;
     self_p->verify_mode = -1;
+    self_p->cache_p = NULL;
+    self_p->ticket_p = NULL;
 
     return (0);
 }
@@ -159,6 +563,26 @@ int ssl_context_destroy(struct ssl_context_t *self_p)
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(self_p->conf_p != NULL, EINVAL);
 
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+    /* The sessions were established with the settings of this
+       context. */
+    if (self_p->server_side == 0) {
+        client_sessions_clear();
+    }
+#endif
+
+#if CONFIG_SSL_SESSION_CACHE_SERVER_MAX > 0
+    if (self_p->cache_p != NULL) {
+        mbedtls_ssl_cache_free(self_p->cache_p);
+    }
+#endif
+
+#if CONFIG_SSL_SESSION_TICKETS == 1
+    if (self_p->ticket_p != NULL) {
+        mbedtls_ssl_ticket_free(self_p->ticket_p);
+    }
+#endif
+
     free_conf(self_p->conf_p);
 
     return (0);
@@ -246,6 +670,12 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
     int res;
     int authmode;
     int server_side;
+    int resumed;
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+    struct client_session_t *client_session_p;
+
+    client_session_p = NULL;
+#endif
 
     server_side = (flags & SSL_SOCKET_SERVER_SIDE);
     
@@ -267,6 +697,12 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
             mbedtls_ssl_conf_authmode(context_p->conf_p, context_p->verify_mode);
         }
 
+        if (server_side == SSL_SOCKET_SERVER_SIDE) {
+            if (configure_server_sessions(context_p) != 0) {
+                return (-1);
+            }
+        }
+
         context_p->server_side = server_side;
     } else if (context_p->server_side != server_side) {
         return (-1);
@@ -281,6 +717,10 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
         return (-1);
     }
 
+    /* All mbedTLS allocations of the socket are from the socket
+       heap. */
+    socket_heap_acquire();
+
     chan_init(&self_p->base,
               (chan_read_fn_t)ssl_socket_read,
               (chan_write_fn_t)ssl_socket_write,
@@ -308,16 +748,43 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
                                          server_hostname_p) != 0) {
                 goto err2;
             }
+
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+            /* Try to resume the previous session with the server. */
+            client_session_p = client_session_find(server_hostname_p);
+
+            if (client_session_p != NULL) {
+                if (mbedtls_ssl_set_session(self_p->ssl_p,
+                                            &client_session_p->session) != 0) {
+                    client_session_p = NULL;
+                }
+            }
+#endif
         }
     }
-    
+
     /* Perform the handshake with the remote peer. */
-    res = mbedtls_ssl_handshake(self_p->ssl_p);
+    res = handshake(self_p->ssl_p, &resumed);
 
     if (res != 0) {
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+        /* Do not try to resume the session again. */
+        if (client_session_p != NULL) {
+            client_session_remove(client_session_p);
+        }
+#endif
+
         goto err2;
     }
 
+    if (resumed == 1) {
+        fs_counter_increment(&module.resumed_handshakes, 1);
+    } else {
+        fs_counter_increment(&module.full_handshakes, 1);
+    }
+
+    self_p->handshake_heap_used_max = socket_heap_get_used_max();
+
     /* Verify the peer certificate if optional and present. */
     authmode = ((mbedtls_ssl_config *)context_p->conf_p)->authmode;
 
@@ -329,11 +796,20 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
         }
     }
 
+#if CONFIG_SSL_SESSION_CACHE_CLIENT_MAX > 0
+    /* Store the session, and possibly a new session ticket, for the
+       next connection to the server. */
+    if ((server_side == 0) && (server_hostname_p != NULL)) {
+        client_session_save(self_p->ssl_p, server_hostname_p);
+    }
+#endif
+
     return (0);
 
  err2:
     mbedtls_ssl_free(self_p->ssl_p);
  err1:
+    socket_heap_release();
     free_ssl(self_p->ssl_p);
 
     return (res);
@@ -346,6 +822,7 @@ int ssl_socket_close(struct ssl_socket_t *self_p)
 
     mbedtls_ssl_close_notify(self_p->ssl_p);
     mbedtls_ssl_free(self_p->ssl_p);
+    socket_heap_release();
     free_ssl(self_p->ssl_p);
 
     return (0);
@@ -378,8 +855,18 @@ ssize_t ssl_socket_size(struct ssl_socket_t *self_p)
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(self_p->ssl_p != NULL, EINVAL);
 
-    return (mbedtls_ssl_get_bytes_avail(self_p->ssl_p)
-            + chan_size(self_p->socket_p));
+    size_t size;
+
+    size = mbedtls_ssl_get_bytes_avail(self_p->ssl_p);
+
+    /* The number of decrypted bytes in received records is unknown
+       until they are read, so received data only means that at least
+       one byte can be read. */
+    if ((size == 0) && (chan_size(self_p->socket_p) > 0)) {
+        size = 1;
+    }
+
+    return (size);
 }
 
 const char *ssl_socket_get_server_hostname(struct ssl_socket_t *self_p)
@@ -398,3 +885,8 @@ int ssl_socket_get_cipher(struct ssl_socket_t *self_p,
     
     return (0);
 }
+
+size_t ssl_socket_get_handshake_heap_used_max(struct ssl_socket_t *self_p)
+{
+    return (self_p->handshake_heap_used_max);
+}
@@ -52,12 +52,15 @@ struct ssl_context_t {
     void *conf_p;
     int server_side;
     int verify_mode;
+    void *cache_p;
+    void *ticket_p;
 };
 
 struct ssl_socket_t {
     struct chan_t base;
     void *ssl_p;
     void *socket_p; /* Often a TCP socket. */
+    size_t handshake_heap_used_max;
 };
 
 /**
@@ -136,6 +139,17 @@ int ssl_context_set_verify_mode(struct ssl_context_t *self_p,
  * Initialize given SSL socket with given socket and SSL
  * context. Performs the SSL handshake.
  *
+ * Client side sockets store the session per server hostname and try
+ * to resume it with an abbreviated handshake the next time a socket
+ * to the same server is opened. Server side contexts keep a session
+ * cache and issue session tickets for the same purpose. The number
+ * of full and resumed handshakes are available in the counters
+ * ``/inet/ssl/handshakes/full`` and ``/inet/ssl/handshakes/resumed``.
+ *
+ * mbedTLS allocates from a heap of ``CONFIG_SSL_SOCKET_HEAP_SIZE``
+ * bytes while the socket is open. The heap is released as a whole
+ * when the socket is closed.
+ *
  * @param[out] self_p SSL socket to initialize.
  * @param[in] context_p SSL context to execute in.
  * @param[in] socket_p Socket to wrap in the SSL socket.
@@ -224,4 +238,15 @@ int ssl_socket_get_cipher(struct ssl_socket_t *self_p,
                           const char **protocol_pp,
                           int *number_of_secret_bits_p);
 
+/**
+ * Get the maximum number of bytes allocated from the socket heap
+ * during the handshake. Use it to tune ``CONFIG_SSL_SOCKET_HEAP_SIZE``.
+ *
+ * @param[in] self_p SSL socket.
+ *
+ * @return Maximum number of allocated bytes, or zero(0) if the socket
+ *         heap is disabled.
+ */
+size_t ssl_socket_get_handshake_heap_used_max(struct ssl_socket_t *self_p);
+
 #endif
@@ -36,6 +36,7 @@
 #define OPCODE_DATA                                        3
 #define OPCODE_ACKNOWLEDGMENT                              4
 #define OPCODE_ERROR                                       5
+#define OPCODE_OPTION_ACKNOWLEDGMENT                       6
 
 /* Error codes. */
 #define ERROR_NOT_DEFINED                                  0
@@ -53,9 +54,16 @@
 #define BLOCK_NUMBER(buf_p)     ((buf_p[2] << 8) | buf_p[3])
 #define ERROR_CODE(buf_p)       ((buf_p[2] << 8) | buf_p[3])
 
+
 /* Sizes. */
 #define DATA_SIZE                                        512
-#define BUFFER_SIZE                          (DATA_SIZE + 4)
+
+/* Negotiated options. */
+#define OPTION_BLKSIZE                                   0x1
+#define OPTION_WINDOWSIZE                                0x2
+
+/* No block in the data buffer. */
+#define BLOCK_INDEX_NONE                          0xffffffff
 
 struct client_t {
     struct tftp_server_t *server_p;
@@ -64,11 +72,27 @@ struct client_t {
     struct fs_file_t file;
     const char *filename_p;
     uint32_t number_of_bytes_transferred;
+    struct {
+        int negotiated;
+        size_t blksize;
+        uint32_t windowsize;
+    } options;
     struct {
         uint16_t block_number;
         ssize_t size;
         int retransmit_counter;
     } data;
+    /* Read request window. Blocks are indexed from zero(0), that is,
+       the block number is the block index plus one, modulo 2^16. */
+    struct {
+        uint32_t acked;
+        uint32_t next;
+        uint32_t last;
+        int last_known;
+        ssize_t last_size;
+        uint32_t buffered;
+        uint32_t file_index;
+    } window;
 };
 
 static const char *error_code_str[ERROR_CODE_MAX + 1] = {
@@ -108,22 +132,80 @@ static int find_string(const char **buf_pp,
     return (0);
 }
 
-static int parse_request(const char *buf_p,
-                         size_t size,
+static int parse_request(const char **buf_pp,
+                         size_t *size_p,
                          const char **filename_pp,
                          const char **mode_pp)
 {
-    if (find_string(&buf_p, &size, filename_pp) != 0) {
+    if (find_string(buf_pp, size_p, filename_pp) != 0) {
         return (-1);
     }
 
-    if (find_string(&buf_p, &size, mode_pp) != 0) {
+    if (find_string(buf_pp, size_p, mode_pp) != 0) {
         return (-1);
     }
 
     return (0);
 }
 
+/**
+ * Option names are case insensitive.
+ */
+static int is_option(const char *name_p, const char *option_p)
+{
+    while (*option_p != '\0') {
+        if (tolower((int)*name_p) != *option_p) {
+            return (0);
+        }
+
+        name_p++;
+        option_p++;
+    }
+
+    return (*name_p == '\0');
+}
+
+/**
+ * Parse the options following the mode in a request. Unknown options
+ * and options with bad values are ignored (RFC 2347).
+ */
+static void parse_options(struct client_t *self_p,
+                          const char *buf_p,
+                          size_t size)
+{
+    const char *name_p;
+    const char *value_p;
+    long value;
+
+    self_p->options.negotiated = 0;
+    self_p->options.blksize = DATA_SIZE;
+    self_p->options.windowsize = 1;
+
+    while (find_string(&buf_p, &size, &name_p) == 0) {
+        if (find_string(&buf_p, &size, &value_p) != 0) {
+            break;
+        }
+
+        if (std_strtolb(value_p, &value, 10) == NULL) {
+            continue;
+        }
+
+        if (is_option(name_p, "blksize")) {
+            if ((value >= 8) && (value <= 65464)) {
+                self_p->options.blksize =
+                    MIN(value, CONFIG_TFTP_SERVER_BLKSIZE_MAX);
+                self_p->options.negotiated |= OPTION_BLKSIZE;
+            }
+        } else if (is_option(name_p, "windowsize")) {
+            if ((value >= 1) && (value <= 65535)) {
+                self_p->options.windowsize =
+                    MIN(value, CONFIG_TFTP_SERVER_WINDOWSIZE_MAX);
+                self_p->options.negotiated |= OPTION_WINDOWSIZE;
+            }
+        }
+    }
+}
+
 static int error_transmit(struct tftp_server_t *server_p,
                           struct inet_addr_t *remote_addr_p,
                           uint8_t *buf_p,
@@ -156,25 +238,103 @@ static int error_transmit(struct tftp_server_t *server_p,
     return (0);
 }
 
-static int client_data_write(struct client_t *self_p)
+static size_t client_oack_append(struct client_t *self_p,
+                                 size_t size,
+                                 const char *name_p,
+                                 unsigned long value)
+{
+    strcpy((char *)&self_p->buf_p[size], name_p);
+    size += (strlen(name_p) + 1);
+    size += (std_sprintf((char *)&self_p->buf_p[size],
+                         FSTR("%lu"),
+                         value) + 1);
+
+    return (size);
+}
+
+static int client_oack_write(struct client_t *self_p)
 {
     size_t size;
 
     self_p->buf_p[0] = 0;
-    self_p->buf_p[1] = OPCODE_DATA;
-    self_p->buf_p[2] = (self_p->data.block_number >> 8);
-    self_p->buf_p[3] = self_p->data.block_number;
-    size = 4;
+    self_p->buf_p[1] = OPCODE_OPTION_ACKNOWLEDGMENT;
+    size = 2;
+
+    if (self_p->options.negotiated & OPTION_BLKSIZE) {
+        size = client_oack_append(self_p,
+                                  size,
+                                  "blksize",
+                                  self_p->options.blksize);
+    }
+
+    if (self_p->options.negotiated & OPTION_WINDOWSIZE) {
+        size = client_oack_append(self_p,
+                                  size,
+                                  "windowsize",
+                                  self_p->options.windowsize);
+    }
+
+    if (socket_write(&self_p->socket, self_p->buf_p, size) != size) {
+        return (-1);
+    }
+
+    return (0);
+}
+
+/**
+ * Read given block from the file into the data buffer, unless it is
+ * already there.
+ */
+static int client_block_read(struct client_t *self_p, uint32_t index)
+{
+    if (self_p->window.buffered == index) {
+        return (0);
+    }
+
+    /* Seek back when retransmitting. */
+    if (self_p->window.file_index != index) {
+        if (fs_seek(&self_p->file,
+                    index * self_p->options.blksize,
+                    FS_SEEK_SET) != 0) {
+            return (-1);
+        }
+    }
 
     self_p->data.size = fs_read(&self_p->file,
                                 &self_p->buf_p[4],
-                                DATA_SIZE);
+                                self_p->options.blksize);
 
     if (self_p->data.size < 0) {
         self_p->data.size = 0;
     }
 
-    size += self_p->data.size;
+    self_p->window.buffered = index;
+    self_p->window.file_index = (index + 1);
+
+    /* The last block is not full. */
+    if (self_p->data.size < self_p->options.blksize) {
+        self_p->window.last = index;
+        self_p->window.last_known = 1;
+        self_p->window.last_size = self_p->data.size;
+    }
+
+    return (0);
+}
+
+static int client_data_write(struct client_t *self_p, uint32_t index)
+{
+    size_t size;
+
+    if (client_block_read(self_p, index) != 0) {
+        return (-1);
+    }
+
+    self_p->data.block_number = (index + 1);
+    self_p->buf_p[0] = 0;
+    self_p->buf_p[1] = OPCODE_DATA;
+    self_p->buf_p[2] = (self_p->data.block_number >> 8);
+    self_p->buf_p[3] = self_p->data.block_number;
+    size = (4 + self_p->data.size);
 
     if (socket_write(&self_p->socket, self_p->buf_p, size) != size) {
         return (-1);
@@ -183,28 +343,67 @@ static int client_data_write(struct client_t *self_p)
     return (0);
 }
 
-static int client_data_transmit(struct client_t *self_p)
+static int is_last_block_written(struct client_t *self_p)
 {
-    self_p->data.retransmit_counter = 0;
-
-    return (client_data_write(self_p));
+    return ((self_p->window.last_known == 1)
+            && (self_p->window.next > self_p->window.last));
 }
 
-static int client_data_retransmit(struct client_t *self_p)
+/**
+ * Write the blocks in the window not yet written, then read the first
+ * block of the next window from the file while the window is in
+ * flight.
+ */
+static int client_window_write(struct client_t *self_p)
 {
-    if (fs_seek(&self_p->file, -self_p->data.size, FS_SEEK_CUR) != 0) {
-        return (-1);
+    while ((self_p->window.next
+            < (self_p->window.acked + self_p->options.windowsize))
+           && !is_last_block_written(self_p)) {
+        if (client_data_write(self_p, self_p->window.next) != 0) {
+            return (-1);
+        }
+
+        self_p->window.next++;
+    }
+
+    if (!is_last_block_written(self_p)) {
+        if (client_block_read(self_p, self_p->window.next) != 0) {
+            return (-1);
+        }
     }
 
+    return (0);
+}
+
+static int client_window_transmit(struct client_t *self_p)
+{
+    self_p->data.retransmit_counter = 0;
+
+    return (client_window_write(self_p));
+}
+
+/**
+ * Write the window again, starting at the first block that has not
+ * been acknowledged.
+ */
+static int client_window_retransmit(struct client_t *self_p)
+{
+    self_p->window.next = self_p->window.acked;
     self_p->data.retransmit_counter++;
 
-    return (client_data_write(self_p));
+    return (client_window_write(self_p));
 }
 
 static int client_ack_write(struct client_t *self_p)
 {
     uint16_t block_number;
 
+    /* Negotiated options are acknowledged instead of block zero(0). */
+    if ((self_p->data.block_number == 1)
+        && (self_p->options.negotiated != 0)) {
+        return (client_oack_write(self_p));
+    }
+
     /* Block number holds the value of the next expected block to
        receive. */
     block_number = (self_p->data.block_number - 1);
@@ -256,66 +455,182 @@ static int client_error_transmit(struct client_t *self_p,
     return (0);
 }
 
+static void client_error_print(uint8_t *buf_p)
+{
+    uint16_t error_code;
+
+    error_code = ERROR_CODE(buf_p);
+
+    if (error_code > ERROR_CODE_MAX) {
+        error_code = ERROR_CODE_MAX;
+    }
+
+    log_object_print(NULL,
+                     LOG_ERROR,
+                     OSTR("error code %u: %s\r\n"),
+                     error_code,
+                     error_code_str[error_code]);
+}
+
+/**
+ * Transmit the option acknowledgement of a read request and wait for
+ * the client to acknowledge it with block number zero(0).
+ */
+static int client_read_request_negotiate(struct client_t *self_p,
+                                         struct time_t *timeout_p)
+{
+    int opcode;
+    uint8_t buf[4];
+    ssize_t size;
+
+    self_p->data.retransmit_counter = 0;
+
+    if (client_oack_write(self_p) != 0) {
+        return (-1);
+    }
+
+    while (1) {
+        if (chan_poll(&self_p->socket, timeout_p) == NULL) {
+            if (self_p->data.retransmit_counter == 2) {
+                return (-1);
+            }
+
+            self_p->data.retransmit_counter++;
+
+            if (client_oack_write(self_p) != 0) {
+                return (-1);
+            }
+
+            continue;
+        }
+
+        size = socket_read(&self_p->socket, &buf[0], sizeof(buf));
+
+        if (size < 4) {
+            return (-1);
+        }
+
+        opcode = OPCODE(buf);
+
+        switch (opcode) {
+
+        case OPCODE_ACKNOWLEDGMENT:
+            if (BLOCK_NUMBER(buf) == 0) {
+                return (0);
+            }
+            break;
+
+        case OPCODE_ERROR:
+            client_error_print(&buf[0]);
+            return (-1);
+
+        default:
+            log_object_print(NULL,
+                             LOG_ERROR,
+                             OSTR("bad opcode %u\r\n"),
+                             opcode);
+            return (-1);
+        }
+    }
+
+    return (0);
+}
+
 static int client_read_request_transfer_data(struct client_t *self_p)
 {
     int opcode;
     uint16_t block_number;
-    uint16_t error_code;
+    uint16_t count;
     struct time_t timeout;
     ssize_t size;
+    uint8_t buf[4];
 
     timeout.seconds = (self_p->server_p->timeout_ms / 1000);
     timeout.nanoseconds = 1000000L * (self_p->server_p->timeout_ms % 1000);
 
-    if (client_data_transmit(self_p) != 0) {
+    self_p->window.acked = 0;
+    self_p->window.next = 0;
+    self_p->window.last_known = 0;
+    self_p->window.buffered = BLOCK_INDEX_NONE;
+    self_p->window.file_index = 0;
+
+    if (self_p->options.negotiated != 0) {
+        if (client_read_request_negotiate(self_p, &timeout) != 0) {
+            return (-1);
+        }
+    }
+
+    if (client_window_transmit(self_p) != 0) {
         return (-1);
     }
 
     while (1) {
         /* Waiting for acknowlegement or error. Retransmit outstanding
-           data packet on timeout, or bail. */
+           data packets on timeout, or bail. */
         if (chan_poll(&self_p->socket, &timeout) == NULL) {
             if (self_p->data.retransmit_counter == 2) {
                 return (-1);
             }
 
-            if (client_data_retransmit(self_p) != 0) {
+            if (client_window_retransmit(self_p) != 0) {
                 return (-1);
             }
 
             continue;
         }
 
-        /* Read the incoming packet. */
-        size = socket_read(&self_p->socket, self_p->buf_p, BUFFER_SIZE);
+        /* Read the incoming packet. The data buffer is left intact
+           as it contains the read ahead block. */
+        size = socket_read(&self_p->socket, &buf[0], sizeof(buf));
 
         /* Acknowlegement and error packets are at least 4 bytes. */
         if (size < 4) {
             return (-1);
         }
 
-        opcode = OPCODE(self_p->buf_p);
+        opcode = OPCODE(buf);
 
         switch (opcode) {
 
         case OPCODE_ACKNOWLEDGMENT:
-            block_number = BLOCK_NUMBER(self_p->buf_p);
+            block_number = BLOCK_NUMBER(buf);
+
+            /* Number of blocks acknowledged by this packet. */
+            count = (block_number - self_p->window.acked);
+
+            /* The first block in the window was lost. Duplicated
+               acknowlegements are ignored in lock-step mode to avoid
+               the Sorcerer's Apprentice Syndrome. */
+            if ((count == 0)
+                && (self_p->options.windowsize > 1)
+                && (self_p->window.next > self_p->window.acked)) {
+                if (client_window_retransmit(self_p) != 0) {
+                    return (-1);
+                }
+
+                continue;
+            }
 
             /* Ignore bad acknowlegement packets. */
-            if (block_number != self_p->data.block_number) {
+            if ((count == 0)
+                || (count > (self_p->window.next - self_p->window.acked))) {
                 log_object_print(NULL,
                                  LOG_DEBUG,
                                  OSTR("ignoring block number %u when"
                                       " expecting %u\r\n"),
                                  block_number,
-                                 self_p->data.block_number);
+                                 (uint16_t)self_p->window.next);
                 continue;
             }
 
-            self_p->number_of_bytes_transferred += self_p->data.size;
+            self_p->window.acked += count;
 
-            /* The last packet is not full. */
-            if (self_p->data.size < DATA_SIZE) {
+            /* The last block has been acknowleged. */
+            if ((self_p->window.last_known == 1)
+                && (self_p->window.acked > self_p->window.last)) {
+                self_p->number_of_bytes_transferred =
+                    (self_p->window.last * self_p->options.blksize
+                     + self_p->window.last_size);
                 log_object_print(NULL,
                                  LOG_INFO,
                                  OSTR("sent %u bytes\r\n"),
@@ -323,28 +638,20 @@ static int client_read_request_transfer_data(struct client_t *self_p)
                 return (0);
             }
 
-            /* The block has been acknowleged. Increment the block
-               number for the next block. */
-            self_p->data.block_number++;
+            /* Blocks following the acknowledged block were lost if
+               not all written blocks were acknowledged. Only those
+               are written again, along with the new blocks in the
+               window. */
+            self_p->window.next = self_p->window.acked;
 
-            /* Transmit next data packet. */
-            if (client_data_transmit(self_p) != 0) {
+            /* Transmit the next window. */
+            if (client_window_transmit(self_p) != 0) {
                 return (-1);
             }
             break;
 
         case OPCODE_ERROR:
-            error_code = ERROR_CODE(self_p->buf_p);
-
-            if (error_code > ERROR_CODE_MAX) {
-                error_code = ERROR_CODE_MAX;
-            }
-
-            log_object_print(NULL,
-                             LOG_ERROR,
-                             OSTR("error code %u: %s\r\n"),
-                             error_code,
-                             error_code_str[error_code]);
+            client_error_print(&buf[0]);
             return (-1);
 
         default:
@@ -363,12 +670,15 @@ static int client_write_request_transfer_data(struct client_t *self_p)
 {
     int opcode;
     uint16_t block_number;
-    int error_code;
     struct time_t timeout;
     ssize_t size;
+    uint32_t window_count;
+    int gap_acked;
 
     timeout.seconds = (self_p->server_p->timeout_ms / 1000);
     timeout.nanoseconds = 1000000L * (self_p->server_p->timeout_ms % 1000);
+    window_count = 0;
+    gap_acked = 0;
 
     if (client_ack_transmit(self_p) != 0) {
         return (-1);
@@ -386,11 +696,14 @@ static int client_write_request_transfer_data(struct client_t *self_p)
                 return (-1);
             }
 
+            window_count = 0;
             continue;
         }
 
         /* Read the incoming packet. */
-        size = socket_read(&self_p->socket, self_p->buf_p, BUFFER_SIZE);
+        size = socket_read(&self_p->socket,
+                           self_p->buf_p,
+                           4 + self_p->options.blksize);
 
         /* Data and error packets are at least 4 bytes. */
         if (size < 4) {
@@ -406,8 +719,21 @@ static int client_write_request_transfer_data(struct client_t *self_p)
         case OPCODE_DATA:
             block_number = BLOCK_NUMBER(self_p->buf_p);
 
-            /* Ignore bad data packets. */
             if (block_number != self_p->data.block_number) {
+                /* A block in the window was lost. Acknowledge the
+                   last received block once, so the client
+                   retransmits the blocks following it. */
+                if ((self_p->options.windowsize > 1) && !gap_acked) {
+                    if (client_ack_transmit(self_p) != 0) {
+                        return (-1);
+                    }
+
+                    window_count = 0;
+                    gap_acked = 1;
+                    continue;
+                }
+
+                /* Ignore bad data packets. */
                 log_object_print(NULL,
                                  LOG_INFO,
                                  OSTR("ignoring block number %u when"
@@ -422,36 +748,35 @@ static int client_write_request_transfer_data(struct client_t *self_p)
             }
 
             self_p->data.block_number++;
-
-            /* Transmit ack packet. */
-            if (client_ack_transmit(self_p) != 0) {
-                return (-1);
-            }
-
             self_p->number_of_bytes_transferred += size;
+            window_count++;
+            gap_acked = 0;
 
             /* The last packet is not full. */
-            if (size < DATA_SIZE) {
+            if (size < self_p->options.blksize) {
+                if (client_ack_transmit(self_p) != 0) {
+                    return (-1);
+                }
+
                 log_object_print(NULL,
                                  LOG_INFO,
                                  OSTR("received %u bytes\r\n"),
                                  self_p->number_of_bytes_transferred);
                 return (0);
             }
-            break;
 
-        case OPCODE_ERROR:
-            error_code = ERROR_CODE(self_p->buf_p);
+            /* Transmit ack packet when the window is complete. */
+            if (window_count == self_p->options.windowsize) {
+                if (client_ack_transmit(self_p) != 0) {
+                    return (-1);
+                }
 
-            if (error_code > ERROR_CODE_MAX) {
-                error_code = ERROR_CODE_MAX;
+                window_count = 0;
             }
+            break;
 
-            log_object_print(NULL,
-                             LOG_ERROR,
-                             OSTR("error code %u: %s\r\n"),
-                             error_code,
-                             error_code_str[error_code]);
+        case OPCODE_ERROR:
+            client_error_print(self_p->buf_p);
             return (-1);
 
         default:
@@ -472,13 +797,16 @@ static int client_open(struct client_t *self_p,
                        size_t size,
                        struct inet_addr_t *remote_addr_p)
 {
+    const char *request_p;
     const char *mode_p;
     const char *error_message_p;
 
     error_message_p = NULL;
+    request_p = (const char *)&buf_p[2];
+    size -= 2;
 
-    if (parse_request((const char *)&buf_p[2],
-                      size - 2,
+    if (parse_request(&request_p,
+                      &size,
                       &self_p->filename_p,
                       &mode_p) != 0) {
         error_message_p = "malformed request";
@@ -490,6 +818,8 @@ static int client_open(struct client_t *self_p,
         goto err;
     }
 
+    parse_options(self_p, request_p, size);
+
     if (socket_open_udp(&self_p->socket) != 0) {
         goto err;
     }
@@ -617,7 +947,6 @@ static int handle_request(struct tftp_server_t *self_p,
 static void *tftp_server_main(void *arg_p)
 {
     struct tftp_server_t *self_p;
-    uint8_t buf[BUFFER_SIZE];
     struct inet_addr_t addr;
     ssize_t size;
     char addrbuf[16];
@@ -650,8 +979,8 @@ static void *tftp_server_main(void *arg_p)
     /* Wait for a client. */
     while (1) {
         size = socket_recvfrom(&self_p->listener,
-                               &buf[0],
-                               sizeof(buf) - 1,
+                               &self_p->buf[0],
+                               sizeof(self_p->buf) - 1,
                                0,
                                &addr);
 
@@ -664,8 +993,8 @@ static void *tftp_server_main(void *arg_p)
                          OSTR("connection from %s:%u\r\n"),
                          inet_ntoa(&addr.ip, &addrbuf[0]),
                          addr.port);
-        buf[size] = '\0';
-        handle_request(self_p, &buf[0], size + 1, &addr);
+        self_p->buf[size] = '\0';
+        handle_request(self_p, &self_p->buf[0], size + 1, &addr);
     }
 
     return (NULL);
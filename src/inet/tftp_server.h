@@ -42,6 +42,7 @@ struct tftp_server_t {
     void *stack_p;
     size_t stack_size;
     struct thrd_t *thrd_p;
+    uint8_t buf[CONFIG_TFTP_SERVER_BLKSIZE_MAX + 4];
 };
 
 /**
@@ -29,42 +29,152 @@
  */
 
 #include <pthread.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
 
 static pthread_mutex_t mutex;
 
+#define TICK_PERIOD_NS (1000000000L / CONFIG_SYSTEM_TICK_FREQUENCY)
+
 struct sys_port_t {
     pthread_t thrd;
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
+    int timer_fd;
+    long long start;
+#if CONFIG_SYSTEM_TICKLESS == 1
+    long long deadline;
+#endif
 };
 
 static struct sys_port_t sys_port;
 
-static void *sys_port_ticker(void *arg)
+static void ns_to_timespec(long long ns, struct timespec *time_p)
+{
+    time_p->tv_sec = (ns / 1000000000LL);
+    time_p->tv_nsec = (ns % 1000000000LL);
+}
+
+static long long sys_port_now_ns(void)
 {
-    struct timespec abstimeout;
     struct timespec now;
 
-    pthread_mutex_init(&sys_port.mutex, NULL);
-    pthread_cond_init (&sys_port.cond, NULL);
-    pthread_mutex_lock(&sys_port.mutex);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (1000000000LL * now.tv_sec + now.tv_nsec);
+}
+
+#if CONFIG_SYSTEM_TICKLESS == 1
+
+/**
+ * Total number of processed system ticks.
+ */
+static long long sys_port_ticks(void)
+{
+    return ((long long)module.tick.msb * TICKS_PER_MSB + module.tick.lsb);
+}
+
+/**
+ * Arm the timer to expire at given absolute monotonic time.
+ */
+static void sys_port_arm(long long deadline)
+{
+    struct itimerspec value;
+
+    memset(&value, 0, sizeof(value));
+    ns_to_timespec(deadline, &value.it_value);
+    sys_port.deadline = deadline;
+    timerfd_settime(sys_port.timer_fd, TFD_TIMER_ABSTIME, &value, NULL);
+}
+
+static void *sys_port_ticker(void *arg)
+{
+    uint64_t expirations;
+    sys_tick_t ticks;
+    long long passed;
 
     while (1) {
-        clock_gettime(CLOCK_REALTIME, &now);
-        abstimeout.tv_sec = now.tv_sec;
+        /* Sleep until the next timer expires, but at most half a
+           second to keep the time into the current tick below one
+           second. */
+        pthread_mutex_lock(&mutex);
+        ticks = timer_next_expiry_isr();
+
+        if (ticks > CONFIG_SYSTEM_TICK_FREQUENCY / 2) {
+            ticks = (CONFIG_SYSTEM_TICK_FREQUENCY / 2);
+        }
+
+        sys_port_arm(sys_port.start
+                     + (sys_port_ticks() + ticks) * TICK_PERIOD_NS);
+        pthread_mutex_unlock(&mutex);
+
+        if (read(sys_port.timer_fd,
+                 &expirations,
+                 sizeof(expirations)) != sizeof(expirations)) {
+            continue;
+        }
+
+        /* Catch up on all passed ticks. */
+        while (1) {
+            passed = ((sys_port_now_ns() - sys_port.start) / TICK_PERIOD_NS
+                      - sys_port_ticks());
+
+            if (passed <= 0) {
+                break;
+            }
 
-        if (now.tv_nsec > 990000000L) {
-            abstimeout.tv_sec++;
+            sys_ticks_isr(passed);
         }
 
-        abstimeout.tv_nsec = ((now.tv_nsec + 10000000L) % 1000000000L);
-        pthread_cond_timedwait(&sys_port.cond, &sys_port.mutex, &abstimeout);
-        sys_tick_isr();
+        /* Let the idle thread reschedule once instead of once per
+           tick. */
+        thrd_port_idle_signal();
     }
 
     return (NULL);
 }
 
+static sys_tick_t sys_port_tickless_timer_start_isr(sys_tick_t ticks)
+{
+    long long tick;
+    long long deadline;
+
+    tick = ((sys_port_now_ns() - sys_port.start) / TICK_PERIOD_NS);
+
+    /* Wake the ticker earlier if the timer expires before the current
+       deadline. */
+    deadline = (sys_port.start + (tick + ticks) * TICK_PERIOD_NS);
+
+    if (deadline < sys_port.deadline) {
+        sys_port_arm(deadline);
+    }
+
+    return (tick);
+}
+
+#else
+
+static void *sys_port_ticker(void *arg)
+{
+    uint64_t expirations;
+
+    while (1) {
+        if (read(sys_port.timer_fd,
+                 &expirations,
+                 sizeof(expirations)) != sizeof(expirations)) {
+            continue;
+        }
+
+        /* Process missed ticks as well if the thread was delayed. */
+        while (expirations > 0) {
+            sys_tick_isr();
+            expirations--;
+        }
+    }
+
+    return (NULL);
+}
+
+#endif
+
 __attribute__ ((noreturn))
 static void sys_port_stop(int error)
 {
@@ -87,9 +197,16 @@ static int sys_port_backtrace(void **buf_pp, size_t size)
     return (0);
 }
 
-static int sys_port_get_time_into_tick()
+static long sys_port_get_time_into_tick()
 {
+#if CONFIG_SYSTEM_TICKLESS == 1
+    /* Ticks are only processed when timers expire, so this may be
+       more than one tick. */
+    return (sys_port_now_ns() - sys_port.start
+            - sys_port_ticks() * TICK_PERIOD_NS);
+#else
     return (0);
+#endif
 }
 
 static void sys_port_lock(void)
@@ -114,8 +231,30 @@ static void sys_port_unlock_isr(void)
 
 int sys_port_module_init(void)
 {
+#if CONFIG_SYSTEM_TICKLESS == 0
+    struct itimerspec value;
+#endif
+
     pthread_mutex_init(&mutex, NULL);
 
+    sys_port.timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+
+    if (sys_port.timer_fd == -1) {
+        fprintf(stderr, "Error creating ticker timer\n");
+        exit(4);
+    }
+
+    sys_port.start = sys_port_now_ns();
+
+#if CONFIG_SYSTEM_TICKLESS == 1
+    sys_port.deadline = LLONG_MAX;
+#else
+    /* A periodic timer does not drift. */
+    ns_to_timespec(TICK_PERIOD_NS, &value.it_value);
+    ns_to_timespec(TICK_PERIOD_NS, &value.it_interval);
+    timerfd_settime(sys_port.timer_fd, 0, &value, NULL);
+#endif
+
     /* Start sys tick thrd.*/
     if (pthread_create(&sys_port.thrd, NULL, sys_port_ticker, NULL)) {
         fprintf(stderr, "Error creating ticker thrd\n");
@@ -37,6 +37,48 @@
 #    error "This port does not support a preemptive scheduler."
 #endif
 
+#if CONFIG_LINUX_THRD_COROUTINES == 1
+
+#    if !defined(__x86_64__)
+#        include <ucontext.h>
+#    endif
+
+/* Host library functions, for example in the C library, are called
+   on the thread stack, so all stacks are given some extra space. */
+#define THRD_PORT_STACK_HOST_SIZE 16384
+
+#define THRD_PORT_STACK(name, size)                                     \
+    char name[sizeof(struct thrd_t) + THRD_PORT_STACK_HOST_SIZE + (size)] \
+    __attribute((aligned (16)))
+
+#    if defined(__x86_64__)
+
+/* Registers stored by a context swap. */
+struct thrd_port_context_t {
+    uint64_t r15;
+    uint64_t r14;
+    uint64_t r13;
+    uint64_t r12;
+    uint64_t rbx;
+    uint64_t rbp;
+    uint64_t rip;
+    uint64_t padding;
+};
+
+#    endif
+
+struct thrd_port_t {
+    void *(*main)(void *arg);
+    void *arg;
+#if defined(__x86_64__)
+    struct thrd_port_context_t *context_p;
+#else
+    ucontext_t context;
+#endif
+};
+
+#else
+
 #define THRD_PORT_STACK(name, size) char name[sizeof(struct thrd_t) + (size)]
 
 struct thrd_port_t {
@@ -49,3 +91,11 @@ struct thrd_port_t {
 };
 
 #endif
+
+/**
+ * Wake up the idle thread to let it reschedule. Used by host threads
+ * that resume Simba threads.
+ */
+void thrd_port_idle_signal(void);
+
+#endif
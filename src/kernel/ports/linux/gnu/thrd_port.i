@@ -31,6 +31,7 @@
 struct thrd_port_idle_t {
     pthread_mutex_t mutex;
     pthread_cond_t cond;
+    int pending;
 };
 
 static struct thrd_t main_thrd;
@@ -48,9 +49,144 @@ static char *thrd_port_get_main_thrd_stack_top(void)
 
 static struct thrd_port_idle_t idle = {
     .mutex = PTHREAD_MUTEX_INITIALIZER,
-    .cond = PTHREAD_COND_INITIALIZER
+    .cond = PTHREAD_COND_INITIALIZER,
+    .pending = 0
 };
 
+/**
+ * Wake up the idle thread to let it reschedule. Called by host
+ * threads that resume Simba threads, for example the socket
+ * reactor. A wakeup is remembered if the idle thread is not yet
+ * waiting.
+ */
+void thrd_port_idle_signal(void)
+{
+    pthread_mutex_lock(&idle.mutex);
+    idle.pending = 1;
+    pthread_cond_signal(&idle.cond);
+    pthread_mutex_unlock(&idle.mutex);
+}
+
+#if CONFIG_LINUX_THRD_COROUTINES == 1
+
+static void thrd_port_main(void)
+{
+    struct thrd_t *thrd_p;
+
+    thrd_p = thrd_self();
+    sys_unlock();
+    thrd_p->port.main(thrd_p->port.arg);
+
+    /* Thread termination. */
+    terminate();
+}
+
+#    if defined(__x86_64__)
+
+/**
+ * Store callee saved registers on the current stack and save the
+ * stack pointer in given out context, then switch to the stack of
+ * given in context and restore its registers.
+ */
+__attribute__((naked))
+static void thrd_port_context_swap(struct thrd_port_context_t *in_p,
+                                   struct thrd_port_context_t **out_pp)
+{
+    asm volatile ("pushq %rbp\n\t"
+                  "pushq %rbx\n\t"
+                  "pushq %r12\n\t"
+                  "pushq %r13\n\t"
+                  "pushq %r14\n\t"
+                  "pushq %r15\n\t"
+                  "movq %rsp, (%rsi)\n\t"
+                  "movq %rdi, %rsp\n\t"
+                  "popq %r15\n\t"
+                  "popq %r14\n\t"
+                  "popq %r13\n\t"
+                  "popq %r12\n\t"
+                  "popq %rbx\n\t"
+                  "popq %rbp\n\t"
+                  "ret");
+}
+
+static void thrd_port_swap(struct thrd_t *in_p,
+                           struct thrd_t *out_p)
+{
+    thrd_port_context_swap(in_p->port.context_p, &out_p->port.context_p);
+}
+
+static void thrd_port_init_main(struct thrd_port_t *port_p)
+{
+    port_p->main = NULL;
+    port_p->arg = NULL;
+    port_p->context_p = NULL;
+}
+
+static int thrd_port_spawn(struct thrd_t *thrd_p,
+                           void *(*main)(void *),
+                           void *arg_p,
+                           void *stack_p,
+                           size_t stack_size)
+{
+    struct thrd_port_context_t *context_p;
+    uintptr_t top;
+
+    thrd_p->port.main = main;
+    thrd_p->port.arg = arg_p;
+
+    /* The stack pointer shall be 16 bytes aligned before a call, and
+       the return address is pushed by the call. */
+    top = (((uintptr_t)stack_p + stack_size) & ~(uintptr_t)15);
+    context_p = (struct thrd_port_context_t *)(top - sizeof(*context_p));
+    memset(context_p, 0, sizeof(*context_p));
+    context_p->rip = (uint64_t)(uintptr_t)thrd_port_main;
+    thrd_p->port.context_p = context_p;
+
+    return (0);
+}
+
+#    else
+
+static void thrd_port_swap(struct thrd_t *in_p,
+                           struct thrd_t *out_p)
+{
+    swapcontext(&out_p->port.context, &in_p->port.context);
+}
+
+static void thrd_port_init_main(struct thrd_port_t *port_p)
+{
+    port_p->main = NULL;
+    port_p->arg = NULL;
+}
+
+static int thrd_port_spawn(struct thrd_t *thrd_p,
+                           void *(*main)(void *),
+                           void *arg_p,
+                           void *stack_p,
+                           size_t stack_size)
+{
+    struct thrd_port_t *port_p;
+
+    port_p = &thrd_p->port;
+    port_p->main = main;
+    port_p->arg = arg_p;
+
+    if (getcontext(&port_p->context) != 0) {
+        return (-1);
+    }
+
+    port_p->context.uc_stack.ss_sp = &thrd_p[1];
+    port_p->context.uc_stack.ss_size = thrd_p->stack_size;
+    port_p->context.uc_link = NULL;
+    makecontext(&port_p->context, thrd_port_main, 0);
+
+    return (0);
+}
+
+#    endif
+
+#else
+
 static void *thrd_port_main(void *arg_p)
 {
     struct thrd_port_t *port_p;
@@ -111,10 +247,17 @@ static int thrd_port_spawn(struct thrd_t *thrd_p,
     return (0);
 }
 
+#endif
+
 static void thrd_port_idle_wait(struct thrd_t *thrd_p)
 {
     pthread_mutex_lock(&idle.mutex);
-    pthread_cond_wait(&idle.cond, &idle.mutex);
+
+    while (idle.pending == 0) {
+        pthread_cond_wait(&idle.cond, &idle.mutex);
+    }
+
+    idle.pending = 0;
     pthread_mutex_unlock(&idle.mutex);
 
     /* Add this thread to the ready list and reschedule. */
@@ -127,18 +270,14 @@ static void thrd_port_idle_wait(struct thrd_t *thrd_p)
 
 static void thrd_port_on_suspend_timer_expired(struct thrd_t *thrd_p)
 {
-    /* Signal idle thrd.*/
-    pthread_mutex_lock(&idle.mutex);
-    pthread_cond_signal(&idle.cond);
-    pthread_mutex_unlock(&idle.mutex);
+    thrd_port_idle_signal();
 }
 
 static void thrd_port_tick(void)
 {
-    /* Signal idle thrd.*/
-    pthread_mutex_lock(&idle.mutex);
-    pthread_cond_signal(&idle.cond);
-    pthread_mutex_unlock(&idle.mutex);
+#if CONFIG_SYSTEM_TICKLESS == 0
+    thrd_port_idle_signal();
+#endif
 }
 
 static void thrd_port_cpu_usage_start(struct thrd_t *thrd_p)
@@ -173,10 +312,22 @@ static const void *thrd_port_get_bottom_of_stack(struct thrd_t *thrd_p)
         return (bottom_p);
     }
 
+#if CONFIG_LINUX_THRD_COROUTINES == 1 && defined(__x86_64__)
+    if (thrd_p != &main_thrd) {
+        return (thrd_p->port.context_p);
+    }
+#endif
+
     return (NULL);
 }
 
 static const void *thrd_port_get_top_of_stack(struct thrd_t *thrd_p)
 {
+#if CONFIG_LINUX_THRD_COROUTINES == 1
+    if (thrd_p != &main_thrd) {
+        return ((char *)&thrd_p[1] + thrd_p->stack_size);
+    }
+#endif
+
     return (NULL);
 }
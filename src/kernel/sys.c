@@ -118,6 +118,11 @@ extern void time_tick_isr(void);
 extern void timer_tick_isr(void);
 extern void thrd_tick_isr(void);
 
+#if CONFIG_SYSTEM_TICKLESS == 1
+extern sys_tick_t timer_next_expiry_isr(void);
+extern sys_tick_t timer_skip_isr(sys_tick_t ticks);
+#endif
+
 static void RAM_CODE sys_tick_isr(void)
 {
     module.tick.lsb++;
@@ -131,8 +136,60 @@ static void RAM_CODE sys_tick_isr(void)
     thrd_tick_isr();
 }
 
+#if CONFIG_SYSTEM_TICKLESS == 1
+
+/**
+ * Process given number of passed system ticks. Ticks in which no
+ * timer expires are skipped in bulk, as thousands of ticks may have
+ * passed since the last timer expired.
+ */
+static void RAM_CODE sys_ticks_isr(sys_tick_t ticks)
+{
+    sys_tick_t skipped;
+    uint32_t lsb;
+
+    while (ticks > 0) {
+        sys_lock_isr();
+        skipped = timer_skip_isr(ticks);
+        lsb = (module.tick.lsb + skipped);
+
+        while (lsb >= TICKS_PER_MSB) {
+            module.tick.msb++;
+            lsb -= TICKS_PER_MSB;
+        }
+
+        module.tick.lsb = lsb;
+        sys_unlock_isr();
+        ticks -= skipped;
+
+        if (ticks > 0) {
+            sys_tick_isr();
+            ticks--;
+        }
+    }
+}
+
+#endif
+
 #include "sys_port.i"
 
+#if CONFIG_SYSTEM_TICKLESS == 1
+
+/**
+ * Called by the timer module when a timer expiring in given number of
+ * ticks is started, as it may expire before the system tick currently
+ * waited for.
+ *
+ * @return Current system tick by real time, which may not yet have
+ *         been processed.
+ */
+sys_tick_t RAM_CODE sys_tickless_timer_start_isr(sys_tick_t ticks)
+{
+    return (sys_port_tickless_timer_start_isr(ticks));
+}
+
+#endif
+
 static void tick_to_time(struct time_t *time_p,
                          struct tick_t *tick_p)
 {
@@ -143,8 +200,13 @@ static void tick_to_time(struct time_t *time_p,
     lsb_ticks = (tick_p->lsb - (CONFIG_SYSTEM_TICK_FREQUENCY * lsb_seconds));
 
     time_p->seconds = (tick_p->msb * SECONDS_PER_MSB + lsb_seconds);
+#if CONFIG_SYSTEM_TICK_FREQUENCY > 1000
+    time_p->nanoseconds = (1000 * lsb_ticks
+                           * (1000000UL / CONFIG_SYSTEM_TICK_FREQUENCY));
+#else
     time_p->nanoseconds = (1000 * ((1000000UL * lsb_ticks)
                                    / CONFIG_SYSTEM_TICK_FREQUENCY));
+#endif
 }
 
 static void init_drivers(void)
@@ -279,6 +341,10 @@ static void init_inet(void)
 #    include "sys/console.i"
 #endif
 
+#if CONFIG_LOG_DEFERRED == 1
+#    include "sys/log.i"
+#endif
+
 #if CONFIG_START_SHELL == 1
 #    include "sys/shell.i"
 #endif
@@ -478,6 +544,9 @@ int sys_start(void)
 #if CONFIG_MODULE_INIT_FS == 1
     fs_module_init();
 #endif
+#if CONFIG_MODULE_INIT_HEAP == 1
+    heap_module_init();
+#endif
 #if CONFIG_MODULE_INIT_STD == 1
     std_module_init();
 #endif
@@ -511,6 +580,10 @@ int sys_start(void)
     start_console();
 #endif
 
+#if CONFIG_LOG_DEFERRED == 1
+    start_log();
+#endif
+
 #if CONFIG_START_SHELL == 1
     start_shell();
 #endif
@@ -623,6 +696,32 @@ enum sys_reset_cause_t sys_reset_cause()
 #endif
 }
 
+/**
+ * Get the current tick and the time into it.
+ */
+static struct tick_t get_tick_isr(int32_t *time_into_tick_p)
+{
+    struct tick_t tick;
+
+#if CONFIG_SYSTEM_TICKLESS == 1
+    volatile struct tick_t *tick_p;
+
+    /* Ticks are processed without the system lock taken, so read
+       until the tick is unchanged. */
+    tick_p = &module.tick;
+
+    do {
+        tick = *tick_p;
+        *time_into_tick_p = sys_port_get_time_into_tick();
+    } while (tick.lsb != tick_p->lsb);
+#else
+    tick = module.tick;
+    *time_into_tick_p = sys_port_get_time_into_tick();
+#endif
+
+    return (tick);
+}
+
 int sys_uptime(struct time_t *uptime_p)
 {
     ASSERTN(uptime_p != NULL, EINVAL);
@@ -633,8 +732,7 @@ int sys_uptime(struct time_t *uptime_p)
     offset.seconds = 0;
 
     sys_lock();
-    tick = module.tick;
-    offset.nanoseconds = sys_port_get_time_into_tick();
+    tick = get_tick_isr(&offset.nanoseconds);
     sys_unlock();
 
     tick_to_time(uptime_p, &tick);
@@ -651,8 +749,7 @@ int sys_uptime_isr(struct time_t *uptime_p)
 
     offset.seconds = 0;
 
-    tick = module.tick;
-    offset.nanoseconds = sys_port_get_time_into_tick();
+    tick = get_tick_isr(&offset.nanoseconds);
 
     tick_to_time(uptime_p, &tick);
 
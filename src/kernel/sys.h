@@ -69,9 +69,17 @@ enum sys_reset_cause_t {
  */
 static inline sys_tick_t t2st(const struct time_t *time_p)
 {
+#if CONFIG_SYSTEM_TICK_FREQUENCY > 1000
+    /* Avoid overflow for high tick frequencies. The frequency must
+       be a divisor of 1000000. */
+    return (((sys_tick_t)(time_p)->seconds * CONFIG_SYSTEM_TICK_FREQUENCY) +
+            DIV_CEIL(DIV_CEIL((time_p)->nanoseconds, 1000),
+                     (1000000 / CONFIG_SYSTEM_TICK_FREQUENCY)));
+#else
     return (((sys_tick_t)(time_p)->seconds * CONFIG_SYSTEM_TICK_FREQUENCY) +
             DIV_CEIL((DIV_CEIL((time_p)->nanoseconds, 1000)
                       * CONFIG_SYSTEM_TICK_FREQUENCY), 1000000));
+#endif
 }
 
 /**
@@ -80,8 +88,14 @@ static inline sys_tick_t t2st(const struct time_t *time_p)
 static inline void st2t(sys_tick_t tick, struct time_t *time_p)
 {
     time_p->seconds = (tick / CONFIG_SYSTEM_TICK_FREQUENCY);
+#if CONFIG_SYSTEM_TICK_FREQUENCY > 1000
+    time_p->nanoseconds = ((tick % CONFIG_SYSTEM_TICK_FREQUENCY)
+                           * (1000000 / CONFIG_SYSTEM_TICK_FREQUENCY)
+                           * 1000);
+#else
     time_p->nanoseconds = (((1000000 * (tick % CONFIG_SYSTEM_TICK_FREQUENCY))
                             / CONFIG_SYSTEM_TICK_FREQUENCY) * 1000);
+#endif
 }
 
 struct sys_t {
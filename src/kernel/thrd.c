@@ -43,11 +43,38 @@ enum thrd_state_t {
 #define THRD_STACK_LOW_MAGIC      0x1337
 #define THRD_FILL_PATTERN           0x19
 
+#if CONFIG_THRD_READY_BITMAP == 1
+
+/* One FIFO per priority level. Priority -128 is level 0 and priority
+   127 is level 255. */
+#define READY_LEVELS                 256
+#define READY_LEVELS_PER_WORD         32
+#define READY_WORDS (READY_LEVELS / READY_LEVELS_PER_WORD)
+
+struct ready_fifo_t {
+    struct thrd_prio_list_elem_t *head_p;
+    struct thrd_prio_list_elem_t *tail_p;
+};
+
+/* A two level bitmap of non-empty FIFOs. Bit N in 'summary' is set
+   if any bit is set in 'bitmap[N]'. */
+struct ready_queue_t {
+    uint8_t summary;
+    uint32_t bitmap[READY_WORDS];
+    struct ready_fifo_t fifos[READY_LEVELS];
+};
+
+#endif
+
 struct module_t {
     int8_t initialized;
     struct {
         struct thrd_t *current_p;
+#if CONFIG_THRD_READY_BITMAP == 1
+        struct ready_queue_t ready;
+#else
         struct thrd_prio_list_t ready;
+#endif
     } scheduler;
     struct thrd_t *threads_p;
 #if CONFIG_THRD_ENV == 1
@@ -213,6 +240,119 @@ static void on_suspend_timer_expired(void *arg_p)
     thrd_port_on_suspend_timer_expired(thrd_p);
 }
 
+#if CONFIG_THRD_READY_BITMAP == 1
+
+static void ready_queue_init(struct ready_queue_t *self_p)
+{
+    memset(self_p, 0, sizeof(*self_p));
+}
+
+/**
+ * Append given element to the FIFO of its thread's priority. O(1).
+ */
+static RAM_CODE void ready_queue_push_isr(struct ready_queue_t *self_p,
+                                          struct thrd_prio_list_elem_t *elem_p)
+{
+    struct ready_fifo_t *fifo_p;
+    int level;
+
+    level = (elem_p->thrd_p->prio + 128);
+    fifo_p = &self_p->fifos[level];
+    elem_p->next_p = NULL;
+
+    if (fifo_p->head_p == NULL) {
+        fifo_p->head_p = elem_p;
+        self_p->bitmap[level / READY_LEVELS_PER_WORD] |=
+            (1UL << (level % READY_LEVELS_PER_WORD));
+        self_p->summary |= (1 << (level / READY_LEVELS_PER_WORD));
+    } else {
+        fifo_p->tail_p->next_p = elem_p;
+    }
+
+    fifo_p->tail_p = elem_p;
+}
+
+/**
+ * Remove given element from the FIFO of its thread's priority.
+ */
+static void ready_queue_remove_isr(struct ready_queue_t *self_p,
+                                   struct thrd_prio_list_elem_t *elem_p)
+{
+    struct ready_fifo_t *fifo_p;
+    struct thrd_prio_list_elem_t *curr_p;
+    struct thrd_prio_list_elem_t *prev_p;
+    int level;
+
+    level = (elem_p->thrd_p->prio + 128);
+    fifo_p = &self_p->fifos[level];
+    curr_p = fifo_p->head_p;
+    prev_p = NULL;
+
+    while (curr_p != NULL) {
+        if (curr_p == elem_p) {
+            if (prev_p != NULL) {
+                prev_p->next_p = elem_p->next_p;
+            } else {
+                fifo_p->head_p = elem_p->next_p;
+            }
+
+            if (fifo_p->tail_p == elem_p) {
+                fifo_p->tail_p = prev_p;
+            }
+
+            break;
+        }
+
+        prev_p = curr_p;
+        curr_p = curr_p->next_p;
+    }
+
+    if (fifo_p->head_p == NULL) {
+        self_p->bitmap[level / READY_LEVELS_PER_WORD] &=
+            ~(1UL << (level % READY_LEVELS_PER_WORD));
+
+        if (self_p->bitmap[level / READY_LEVELS_PER_WORD] == 0) {
+            self_p->summary &= ~(1 << (level / READY_LEVELS_PER_WORD));
+        }
+    }
+}
+
+/**
+ * Pop the first element in the highest priority non-empty FIFO using
+ * find-first-set on the bitmap. O(1).
+ */
+static RAM_CODE struct thrd_prio_list_elem_t *ready_queue_pop_isr(
+    struct ready_queue_t *self_p)
+{
+    struct ready_fifo_t *fifo_p;
+    struct thrd_prio_list_elem_t *elem_p;
+    int word;
+    int level;
+
+    if (self_p->summary == 0) {
+        return (NULL);
+    }
+
+    word = __builtin_ctz(self_p->summary);
+    level = (word * READY_LEVELS_PER_WORD
+             + __builtin_ctzl(self_p->bitmap[word]));
+    fifo_p = &self_p->fifos[level];
+    elem_p = fifo_p->head_p;
+    fifo_p->head_p = elem_p->next_p;
+
+    if (fifo_p->head_p == NULL) {
+        self_p->bitmap[word] &= ~(1UL << (level % READY_LEVELS_PER_WORD));
+
+        if (self_p->bitmap[word] == 0) {
+            self_p->summary &= ~(1 << word);
+        }
+    }
+
+    return (elem_p);
+}
+
+#endif
+
 /**
  * Push a thread on the list of threads that are ready to be
  * scheduled.
@@ -223,7 +363,29 @@ static void on_suspend_timer_expired(void *arg_p)
  */
 static void scheduler_ready_push(struct thrd_t *thrd_p)
 {
+#if CONFIG_THRD_READY_BITMAP == 1
+    ready_queue_push_isr(&module.scheduler.ready, &thrd_p->scheduler.elem);
+#else
     thrd_prio_list_push_isr(&module.scheduler.ready, &thrd_p->scheduler.elem);
+#endif
+}
+
+/**
+ * Remove a thread from the list of threads that are ready to be
+ * scheduled.
+ *
+ * @param[in] thrd_p Thread to remove from the the ready list.
+ *
+ * @return void.
+ */
+static void scheduler_ready_remove(struct thrd_t *thrd_p)
+{
+#if CONFIG_THRD_READY_BITMAP == 1
+    ready_queue_remove_isr(&module.scheduler.ready, &thrd_p->scheduler.elem);
+#else
+    thrd_prio_list_remove_isr(&module.scheduler.ready,
+                              &thrd_p->scheduler.elem);
+#endif
 }
 
 /**
@@ -233,7 +395,11 @@ static void scheduler_ready_push(struct thrd_t *thrd_p)
  */
 static struct thrd_t *scheduler_ready_pop(void)
 {
+#if CONFIG_THRD_READY_BITMAP == 1
+    return (ready_queue_pop_isr(&module.scheduler.ready)->thrd_p);
+#else
     return (thrd_prio_list_pop_isr(&module.scheduler.ready)->thrd_p);
+#endif
 }
 
 /**
@@ -432,13 +598,18 @@ int thrd_module_init(void)
 
     module.initialized = 1;
 
+#if CONFIG_THRD_READY_BITMAP == 1
+    ready_queue_init(&module.scheduler.ready);
+#else
     thrd_prio_list_init(&module.scheduler.ready);
+#endif
 
 #if CONFIG_THRD_STACK_HEAP == 1
     heap_init(&stack_heap,
               &stack_heap_buffer[0],
               sizeof(stack_heap_buffer),
               &stack_heap_fixed_buffer_sizes[0]);
+    heap_register(&stack_heap, "thrd_stack");
 #endif
 
 #if CONFIG_THRD_ENV == 1
@@ -458,6 +629,12 @@ int thrd_module_init(void)
     thrd_p->scheduler.elem.thrd_p = thrd_p;
     thrd_p->prio = 0;
     thrd_p->state = THRD_STATE_CURRENT;
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    thrd_p->mutex.base_prio = 0;
+    thrd_p->mutex.waiting_p = NULL;
+    thrd_p->mutex.elem_p = NULL;
+    thrd_p->mutex.held_p = NULL;
+#endif
     thrd_p->err = 0;
     thrd_p->log_mask = CONFIG_THRD_DEFAULT_LOG_MASK;
     thrd_p->timer_p = NULL;
@@ -554,6 +731,12 @@ struct thrd_t *thrd_spawn(void *(*main)(void *),
     thrd_p->scheduler.elem.thrd_p = thrd_p;
     thrd_p->prio = prio;
     thrd_p->state = THRD_STATE_READY;
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    thrd_p->mutex.base_prio = prio;
+    thrd_p->mutex.waiting_p = NULL;
+    thrd_p->mutex.elem_p = NULL;
+    thrd_p->mutex.held_p = NULL;
+#endif
     thrd_p->err = 0;
     thrd_p->log_mask = CONFIG_THRD_DEFAULT_LOG_MASK;
     thrd_p->timer_p = NULL;
@@ -730,7 +913,29 @@ int thrd_set_prio(struct thrd_t *thrd_p, int prio)
 {
     ASSERTN(thrd_p != NULL, EINVAL);
 
-    thrd_p->prio = prio;
+    int res;
+
+    sys_lock();
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    thrd_p->mutex.base_prio = prio;
+#endif
+    res = thrd_set_prio_isr(thrd_p, prio);
+    sys_unlock();
+
+    return (res);
+}
+
+int thrd_set_prio_isr(struct thrd_t *thrd_p, int prio)
+{
+    ASSERTN(thrd_p != NULL, EINVAL);
+
+    if (thrd_p->state == THRD_STATE_READY) {
+        scheduler_ready_remove(thrd_p);
+        thrd_p->prio = prio;
+        scheduler_ready_push(thrd_p);
+    } else {
+        thrd_p->prio = prio;
+    }
 
     return (0);
 }
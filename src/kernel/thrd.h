@@ -91,6 +91,18 @@ struct thrd_t {
     struct thrd_port_t port;
     int8_t prio;
     int8_t state;
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    struct {
+        /* Priority without inherited priorities. */
+        int8_t base_prio;
+        /* Mutex the thread is waiting for, and its wait list
+           element. */
+        struct mutex_t *waiting_p;
+        struct thrd_prio_list_elem_t *elem_p;
+        /* Priority inheritance mutexes held by the thread. */
+        struct mutex_t *held_p;
+    } mutex;
+#endif
     int err;
     uint8_t log_mask;
     struct timer_t *timer_p;
@@ -286,6 +298,18 @@ int thrd_get_log_mask(void);
  */
 int thrd_set_prio(struct thrd_t *thrd_p, int prio);
 
+/**
+ * Set the priority of given thread with the system lock taken. A
+ * thread ready to be scheduled is moved to its new position in the
+ * ready queue.
+ *
+ * @param[in] thrd_p Thread to set the priority for.
+ * @param[in] prio Priority.
+ *
+ * @return zero(0) or negative error code.
+ */
+int thrd_set_prio_isr(struct thrd_t *thrd_p, int prio);
+
 /**
  * Get the priority of the current thread.
  *
@@ -30,6 +30,249 @@
 
 #include "simba.h"
 
+#if CONFIG_SYSTEM_TICKLESS == 1
+#    if CONFIG_TIMER_WHEEL == 0
+#        error "The tickless system tick requires the timer wheel."
+#    endif
+
+extern sys_tick_t sys_tickless_timer_start_isr(sys_tick_t ticks);
+#endif
+
+#if CONFIG_TIMER_WHEEL == 1
+
+/* Each level of the wheel has 2^WHEEL_SLOT_BITS slots. A slot on
+   level N covers 2^(N * WHEEL_SLOT_BITS) ticks. */
+#define WHEEL_LEVELS                                        4
+#define WHEEL_SLOT_BITS                                     6
+#define WHEEL_SLOTS                        (1 << WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK                         (WHEEL_SLOTS - 1)
+#define WHEEL_TICKS_MAX                                         \
+    ((1UL << (WHEEL_LEVELS * WHEEL_SLOT_BITS)) - 1)
+
+struct module_t {
+    sys_tick_t tick;               /* Next tick to process. */
+    struct timer_t *expired_p;     /* Timers expired in the tick
+                                      currently being processed. */
+    struct timer_t *slots[WHEEL_LEVELS][WHEEL_SLOTS];
+};
+
+static struct module_t module;
+
+/**
+ * Add given timer first in given list.
+ */
+static void list_add(struct timer_t **head_pp, struct timer_t *timer_p)
+{
+    timer_p->next_p = *head_pp;
+
+    if (timer_p->next_p != NULL) {
+        timer_p->next_p->pprev_p = &timer_p->next_p;
+    }
+
+    timer_p->pprev_p = head_pp;
+    *head_pp = timer_p;
+}
+
+/**
+ * Insert given timer in the wheel. The timer delta is the absolute
+ * expiry tick.
+ */
+static void RAM_CODE timer_insert_isr(struct timer_t *timer_p)
+{
+    sys_tick_t expiry;
+    sys_tick_t ticks;
+    int level;
+    int index;
+
+    expiry = timer_p->delta;
+    ticks = (expiry - module.tick);
+
+    /* Timers far into the future are put in the last slot of the
+       outermost level and re-inserted when cascaded. */
+    if (ticks > WHEEL_TICKS_MAX) {
+        ticks = WHEEL_TICKS_MAX;
+        expiry = (module.tick + WHEEL_TICKS_MAX);
+    }
+
+    level = 0;
+
+    while ((ticks >> ((level + 1) * WHEEL_SLOT_BITS)) != 0) {
+        level++;
+    }
+
+    index = ((expiry >> (level * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK);
+    list_add(&module.slots[level][index], timer_p);
+}
+
+/**
+ * Remove given timer from the wheel.
+ */
+static int timer_remove_isr(struct timer_t *timer_p)
+{
+    if (timer_p->pprev_p == NULL) {
+        return (0);
+    }
+
+    *timer_p->pprev_p = timer_p->next_p;
+
+    if (timer_p->next_p != NULL) {
+        timer_p->next_p->pprev_p = timer_p->pprev_p;
+    }
+
+    timer_p->pprev_p = NULL;
+
+    return (1);
+}
+
+/**
+ * Move all timers in the current slot of given level to lower
+ * levels.
+ *
+ * @return Index of the cascaded slot.
+ */
+static int cascade(int level)
+{
+    struct timer_t *timer_p;
+    int index;
+
+    index = ((module.tick >> (level * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK);
+
+    while ((timer_p = module.slots[level][index]) != NULL) {
+        timer_remove_isr(timer_p);
+        timer_insert_isr(timer_p);
+    }
+
+    return (index);
+}
+
+int timer_module_init(void)
+{
+    return (0);
+}
+
+void RAM_CODE timer_tick_isr(void)
+{
+    struct timer_t *timer_p;
+    int index;
+    int level;
+
+    sys_lock_isr();
+
+    index = (module.tick & WHEEL_SLOT_MASK);
+
+    /* Cascade timers from outer levels when a level wraps. */
+    level = 1;
+
+    while ((index == 0) && (level < WHEEL_LEVELS)) {
+        index = cascade(level);
+        level++;
+    }
+
+    index = (module.tick & WHEEL_SLOT_MASK);
+
+    /* Detach all timers expiring in this tick before calling any
+       callback, as the callbacks may start and stop timers. */
+    module.expired_p = module.slots[0][index];
+    module.slots[0][index] = NULL;
+
+    if (module.expired_p != NULL) {
+        module.expired_p->pprev_p = &module.expired_p;
+    }
+
+    module.tick++;
+
+    while ((timer_p = module.expired_p) != NULL) {
+        timer_remove_isr(timer_p);
+
+        /* Re-set periodic timers before the callback so they may be
+           stopped from it. */
+        if (timer_p->flags & TIMER_PERIODIC) {
+            timer_p->delta = (module.tick - 1 + timer_p->timeout);
+            timer_insert_isr(timer_p);
+        }
+
+        timer_p->callback(timer_p->arg_p);
+    }
+
+    sys_unlock_isr();
+}
+
+/**
+ * Skip up to given number of ticks in which no timer expires or is
+ * cascaded, without calling timer_tick_isr() for each of them. Used
+ * to catch up on ticks passed when tickless.
+ *
+ * @return Number of skipped ticks.
+ */
+sys_tick_t RAM_CODE timer_skip_isr(sys_tick_t ticks)
+{
+    sys_tick_t skipped;
+    int index;
+
+    skipped = 0;
+
+    while (skipped < ticks) {
+        index = (module.tick & WHEEL_SLOT_MASK);
+
+        if ((index == 0) || (module.slots[0][index] != NULL)) {
+            break;
+        }
+
+        module.tick++;
+        skipped++;
+    }
+
+    return (skipped);
+}
+
+/**
+ * Get the number of ticks until the next timer expires.
+ */
+sys_tick_t RAM_CODE timer_next_expiry_isr(void)
+{
+    struct timer_t *timer_p;
+    sys_tick_t ticks;
+    sys_tick_t next;
+    int level;
+    int index;
+    int offset;
+    int i;
+
+    next = SYS_TICK_MAX;
+
+    for (level = 0; level < WHEEL_LEVELS; level++) {
+        index = ((module.tick >> (level * WHEEL_SLOT_BITS))
+                 & WHEEL_SLOT_MASK);
+
+        /* The first non-empty slot on each level has the earliest
+           timers of that level. The current slot on outer levels has
+           already been cascaded and is the last one to expire. */
+        for (i = 0; i < WHEEL_SLOTS; i++) {
+            offset = (level == 0 ? i : i + 1);
+            timer_p = module.slots[level][(index + offset) & WHEEL_SLOT_MASK];
+
+            if (timer_p != NULL) {
+                break;
+            }
+        }
+
+        while (timer_p != NULL) {
+            /* Number of ticks including the expiry tick. */
+            ticks = (timer_p->delta - module.tick + 1);
+
+            if (ticks < next) {
+                next = ticks;
+            }
+
+            timer_p = timer_p->next_p;
+        }
+    }
+
+    return (next);
+}
+
+#else
+
 struct module_t {
     struct timer_t *head_p;    /* List of timers sorted by expiry
                                   tick. */
@@ -148,6 +391,16 @@ void RAM_CODE timer_tick_isr(void)
     sys_unlock_isr();
 }
 
+/**
+ * Get the number of ticks until the next timer expires.
+ */
+sys_tick_t RAM_CODE timer_next_expiry_isr(void)
+{
+    return (module.head_p->delta);
+}
+
+#endif
+
 int timer_init(struct timer_t *self_p,
                const struct time_t *timeout_p,
                timer_callback_t callback,
@@ -168,6 +421,9 @@ int timer_init(struct timer_t *self_p,
        expire early since it may be started close to the next tick
        occurs. */
     self_p->delta = (self_p->timeout + 1);
+#if CONFIG_TIMER_WHEEL == 1
+    self_p->pprev_p = NULL;
+#endif
     self_p->flags = flags;
     self_p->callback = callback;
     self_p->arg_p = arg_p;
@@ -188,6 +444,18 @@ int timer_start(struct timer_t *self_p)
 
 int RAM_CODE timer_start_isr(struct timer_t *self_p)
 {
+#if CONFIG_TIMER_WHEEL == 1
+#    if CONFIG_SYSTEM_TICKLESS == 1
+    /* Ticks are processed later than they occur when tickless, so
+       use the current tick by real time. */
+    self_p->delta = (sys_tickless_timer_start_isr(self_p->timeout + 1)
+                     + self_p->timeout);
+#    else
+    /* Expires in the same tick as with the delta list. */
+    self_p->delta = (module.tick + self_p->timeout);
+#    endif
+#endif
+
     timer_insert_isr(self_p);
 
     return (0);
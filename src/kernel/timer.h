@@ -48,6 +48,11 @@ typedef void (*timer_callback_t)(void *arg_p);
 /* Timer. */
 struct timer_t {
     struct timer_t *next_p;
+#if CONFIG_TIMER_WHEEL == 1
+    struct timer_t **pprev_p;
+#endif
+    /* Ticks after the previous timer in the list, or the absolute
+       expiry tick if the timer wheel is used. */
     sys_tick_t delta;
     sys_tick_t timeout;
     int flags;
@@ -43,6 +43,7 @@
 #define SOAM_TYPE_DATABASE_ID_RESPONSE               (9 << 4)
 #define SOAM_TYPE_DATABASE_REQUEST                  (10 << 4)
 #define SOAM_TYPE_DATABASE_RESPONSE                 (11 << 4)
+#define SOAM_TYPE_LOG_POINT_BINARY                  (12 << 4)
 #define SOAM_TYPE_INVALID_TYPE                      (15 << 4)
 
 #define SOAM_PACKET_FLAGS_CONSECUTIVE                (1 << 1)
@@ -163,6 +164,9 @@ static int log_control(void *chan_p,
     case CHAN_CONTROL_LOG_BEGIN:
         return (soam_write_begin(self_p, SOAM_TYPE_LOG_POINT));
 
+    case CHAN_CONTROL_LOG_BINARY_BEGIN:
+        return (soam_write_begin(self_p, SOAM_TYPE_LOG_POINT_BINARY));
+
     case CHAN_CONTROL_LOG_END:
         return (soam_write_end(self_p));
 
@@ -100,13 +100,11 @@ extern "C" {
 #include "sync/mutex.h"
 #include "sync/cond.h"
 #include "sync/queue.h"
+#include "sync/mailbox.h"
 #include "sync/event.h"
 #include "sync/rwlock.h"
 #include "sync/bus.h"
 
-#include "alloc/heap.h"
-#include "alloc/circular_heap.h"
-
 #if CONFIG_FAT16 == 1
 #    include "filesystems/fat16.h"
 #endif
@@ -114,6 +112,10 @@ extern "C" {
 
 #include "oam/console.h"
 #include "filesystems/fs.h"
+
+#include "alloc/heap.h"
+#include "alloc/circular_heap.h"
+
 #include "oam/shell.h"
 #include "oam/service.h"
 #include "oam/nvm.h"
@@ -384,6 +384,7 @@ SYNC_SRC ?= bus.c \
 	    chan.c \
 	    cond.c \
 	    event.c \
+	    mailbox.c \
 	    mutex.c \
 	    queue.c \
 	    rwlock.c \
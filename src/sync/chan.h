@@ -64,6 +64,11 @@
  */
 #define CHAN_CONTROL_BLOCKING_READ                          6
 
+/**
+ * Beginning of a binary log entry. Ended by `CHAN_CONTROL_LOG_END`.
+ */
+#define CHAN_CONTROL_LOG_BINARY_BEGIN                       7
+
 /**
  * Channel read function callback type.
  *
@@ -0,0 +1,286 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#define MAILBOX_FLAGS_NON_BLOCKING_READ                   0x1
+
+static int control(struct mailbox_t *self_p, int operation)
+{
+    int res;
+
+    res = 0;
+
+    switch (operation) {
+
+    case CHAN_CONTROL_NON_BLOCKING_READ:
+        self_p->flags |= MAILBOX_FLAGS_NON_BLOCKING_READ;
+        break;
+
+    case CHAN_CONTROL_BLOCKING_READ:
+        self_p->flags &= ~MAILBOX_FLAGS_NON_BLOCKING_READ;
+        break;
+
+    default:
+        res = -EINVAL;
+        break;
+    }
+
+    return (res);
+}
+
+/**
+ * Remove the oldest message and resume the highest priority writer
+ * waiting for a free slot, if any.
+ */
+static void *pop_isr(struct mailbox_t *self_p)
+{
+    void *buf_p;
+    struct thrd_prio_list_elem_t *elem_p;
+
+    buf_p = self_p->messages.buf_pp[self_p->messages.head];
+    self_p->messages.head++;
+
+    if (self_p->messages.head == self_p->messages.length) {
+        self_p->messages.head = 0;
+    }
+
+    self_p->messages.count--;
+    elem_p = thrd_prio_list_pop_isr(&self_p->writers);
+
+    if (elem_p != NULL) {
+        thrd_resume_isr(elem_p->thrd_p, 0);
+    }
+
+    return (buf_p);
+}
+
+int mailbox_init(struct mailbox_t *self_p,
+                 struct heap_t *heap_p,
+                 size_t block_size,
+                 void **buf_pp,
+                 size_t length)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(heap_p != NULL, EINVAL);
+    ASSERTN(buf_pp != NULL, EINVAL);
+    ASSERTN(length > 0, EINVAL);
+
+    chan_init(&self_p->base,
+              (chan_read_fn_t)mailbox_read,
+              (chan_write_fn_t)mailbox_write,
+              (chan_size_fn_t)mailbox_size);
+    chan_set_write_isr_cb(&self_p->base, (chan_write_fn_t)mailbox_write_isr);
+    chan_set_control_cb(&self_p->base, (chan_control_fn_t)control);
+
+    self_p->heap_p = heap_p;
+    self_p->block_size = block_size;
+    self_p->messages.buf_pp = buf_pp;
+    self_p->messages.length = length;
+    self_p->messages.head = 0;
+    self_p->messages.count = 0;
+    thrd_prio_list_init(&self_p->writers);
+    self_p->flags = 0;
+
+    return (0);
+}
+
+void *mailbox_alloc(struct mailbox_t *self_p)
+{
+    ASSERTNRN(self_p != NULL, EINVAL);
+
+    return (heap_alloc(self_p->heap_p, self_p->block_size));
+}
+
+int mailbox_free(struct mailbox_t *self_p, void *buf_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    return (heap_free(self_p->heap_p, buf_p));
+}
+
+int mailbox_share(struct mailbox_t *self_p, void *buf_p, int count)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    return (heap_share(self_p->heap_p, buf_p, count));
+}
+
+int mailbox_put(struct mailbox_t *self_p, void *buf_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    int res;
+    struct thrd_prio_list_elem_t elem;
+
+    sys_lock();
+
+    /* Wait for a free message slot. */
+    while (self_p->messages.count == self_p->messages.length) {
+        elem.thrd_p = thrd_self();
+        thrd_prio_list_push_isr(&self_p->writers, &elem);
+        thrd_suspend_isr(NULL);
+    }
+
+    res = mailbox_put_isr(self_p, buf_p);
+
+    sys_unlock();
+
+    return (res);
+}
+
+RAM_CODE int mailbox_put_isr(struct mailbox_t *self_p, void *buf_p)
+{
+    size_t tail;
+
+    if (self_p->messages.count == self_p->messages.length) {
+        return (-ENOMEM);
+    }
+
+    tail = (self_p->messages.head + self_p->messages.count);
+
+    if (tail >= self_p->messages.length) {
+        tail -= self_p->messages.length;
+    }
+
+    self_p->messages.buf_pp[tail] = buf_p;
+    self_p->messages.count++;
+
+    /* Resume any polling thread. */
+    if (chan_is_polled_isr(&self_p->base)) {
+        thrd_resume_isr(self_p->base.reader_p, 0);
+        self_p->base.reader_p = NULL;
+    }
+
+    /* Resume the reader waiting for a message. */
+    if (self_p->base.reader_p != NULL) {
+        thrd_resume_isr(self_p->base.reader_p, 0);
+        self_p->base.reader_p = NULL;
+    }
+
+    return (0);
+}
+
+void *mailbox_get(struct mailbox_t *self_p)
+{
+    ASSERTNRN(self_p != NULL, EINVAL);
+
+    void *buf_p;
+
+    buf_p = NULL;
+
+    sys_lock();
+
+    while (self_p->messages.count == 0) {
+        if (self_p->flags & MAILBOX_FLAGS_NON_BLOCKING_READ) {
+            break;
+        }
+
+        self_p->base.reader_p = thrd_self();
+        thrd_suspend_isr(NULL);
+    }
+
+    if (self_p->messages.count > 0) {
+        buf_p = pop_isr(self_p);
+    }
+
+    sys_unlock();
+
+    return (buf_p);
+}
+
+ssize_t mailbox_read(struct mailbox_t *self_p,
+                     void *buf_p,
+                     size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size == sizeof(void *), EINVAL);
+
+    void *message_p;
+
+    message_p = mailbox_get(self_p);
+
+    if (message_p == NULL) {
+        return (-EAGAIN);
+    }
+
+    memcpy(buf_p, &message_p, sizeof(message_p));
+
+    return (size);
+}
+
+ssize_t mailbox_write(struct mailbox_t *self_p,
+                      const void *buf_p,
+                      size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size == sizeof(void *), EINVAL);
+
+    void *message_p;
+    int res;
+
+    memcpy(&message_p, buf_p, sizeof(message_p));
+    res = mailbox_put(self_p, message_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (size);
+}
+
+RAM_CODE ssize_t mailbox_write_isr(struct mailbox_t *self_p,
+                                   const void *buf_p,
+                                   size_t size)
+{
+    void *message_p;
+    int res;
+
+    memcpy(&message_p, buf_p, sizeof(message_p));
+    res = mailbox_put_isr(self_p, message_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (size);
+}
+
+RAM_CODE ssize_t mailbox_size(struct mailbox_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (self_p->messages.count * sizeof(void *));
+}
@@ -0,0 +1,197 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#ifndef __SYNC_MAILBOX_H__
+#define __SYNC_MAILBOX_H__
+
+#include "simba.h"
+
+/**
+ * A mailbox passes pointers to fixed size buffers between threads,
+ * without copying the buffer contents. Buffers are allocated from a
+ * heap, preferably one with a fixed size pool of the mailbox block
+ * size, which bounds the memory used by messages in flight.
+ */
+struct mailbox_t {
+    struct chan_t base;
+    struct heap_t *heap_p;
+    size_t block_size;
+    struct {
+        void **buf_pp;
+        size_t length;
+        size_t head;
+        size_t count;
+    } messages;
+    /* Writers waiting for a free message slot. */
+    struct thrd_prio_list_t writers;
+    int flags;
+};
+
+/**
+ * Initialize given mailbox.
+ *
+ * @param[in] self_p Mailbox to initialize.
+ * @param[in] heap_p Heap to allocate message buffers from.
+ * @param[in] block_size Size of the message buffers. Preferably one
+ *                       of the fixed sizes of given heap.
+ * @param[in] buf_pp Array of message slots.
+ * @param[in] length Number of message slots in given array, that is,
+ *                   the maximum number of messages in the mailbox.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mailbox_init(struct mailbox_t *self_p,
+                 struct heap_t *heap_p,
+                 size_t block_size,
+                 void **buf_pp,
+                 size_t length);
+
+/**
+ * Allocate a message buffer of the mailbox block size.
+ *
+ * @param[in] self_p Mailbox.
+ *
+ * @return Message buffer, or NULL if no memory could be allocated.
+ */
+void *mailbox_alloc(struct mailbox_t *self_p);
+
+/**
+ * Free given message buffer. A shared buffer is freed when all its
+ * references are freed.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[in] buf_p Message buffer to free.
+ *
+ * @return Share count after the free, or negative error code.
+ */
+int mailbox_free(struct mailbox_t *self_p, void *buf_p);
+
+/**
+ * Add ``count`` references to given message buffer, for example
+ * before putting it in ``count`` more mailboxes. Each receiver frees
+ * its reference with `mailbox_free()`.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[in] buf_p Message buffer to share.
+ * @param[in] count Number of references to add.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mailbox_share(struct mailbox_t *self_p, void *buf_p, int count);
+
+/**
+ * Put given message buffer in given mailbox. The ownership of the
+ * buffer is transferred to the receiver. Blocks while the mailbox is
+ * full.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[in] buf_p Message buffer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mailbox_put(struct mailbox_t *self_p, void *buf_p);
+
+/**
+ * Put given message buffer in given mailbox from isr or with the
+ * system lock taken. Never blocks.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[in] buf_p Message buffer.
+ *
+ * @return zero(0), or -ENOMEM if the mailbox is full.
+ */
+int mailbox_put_isr(struct mailbox_t *self_p, void *buf_p);
+
+/**
+ * Get the oldest message buffer from given mailbox. Blocks while the
+ * mailbox is empty, unless non-blocking read is enabled with
+ * `chan_control()`. Free the buffer with `mailbox_free()` when done
+ * with it.
+ *
+ * @param[in] self_p Mailbox.
+ *
+ * @return Message buffer, or NULL if the mailbox is empty and
+ *         non-blocking read is enabled.
+ */
+void *mailbox_get(struct mailbox_t *self_p);
+
+/**
+ * Channel read function. Reads one message buffer pointer into given
+ * buffer, see `mailbox_get()`.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[out] buf_p Message buffer pointer is written here.
+ * @param[in] size Must be ``sizeof(void *)``.
+ *
+ * @return Number of read bytes or negative error code.
+ */
+ssize_t mailbox_read(struct mailbox_t *self_p,
+                     void *buf_p,
+                     size_t size);
+
+/**
+ * Channel write function. Writes one message buffer pointer from
+ * given buffer, see `mailbox_put()`.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[in] buf_p Message buffer pointer to write.
+ * @param[in] size Must be ``sizeof(void *)``.
+ *
+ * @return Number of written bytes or negative error code.
+ */
+ssize_t mailbox_write(struct mailbox_t *self_p,
+                      const void *buf_p,
+                      size_t size);
+
+/**
+ * Channel write function from isr or with the system lock taken,
+ * see `mailbox_put_isr()`.
+ *
+ * @param[in] self_p Mailbox.
+ * @param[in] buf_p Message buffer pointer to write.
+ * @param[in] size Must be ``sizeof(void *)``.
+ *
+ * @return Number of written bytes or negative error code.
+ */
+ssize_t mailbox_write_isr(struct mailbox_t *self_p,
+                          const void *buf_p,
+                          size_t size);
+
+/**
+ * Get the number of bytes of message buffer pointers in given
+ * mailbox, that is, the number of messages times ``sizeof(void *)``.
+ *
+ * @param[in] self_p Mailbox.
+ *
+ * @return Number of bytes.
+ */
+ssize_t mailbox_size(struct mailbox_t *self_p);
+
+#endif
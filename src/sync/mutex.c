@@ -35,12 +35,123 @@ int mutex_module_init(void)
     return (0);
 }
 
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+
+/**
+ * Raise the priority of the owner of given mutex to given priority,
+ * following the chain of mutexes the owners are waiting for.
+ */
+static void inherit_prio(struct mutex_t *self_p, int prio)
+{
+    struct thrd_t *owner_p;
+
+    while ((self_p != NULL) && (self_p->prio_inherit == 1)) {
+        owner_p = self_p->owner_p;
+
+        if ((owner_p == NULL) || (prio >= owner_p->prio)) {
+            break;
+        }
+
+        thrd_set_prio_isr(owner_p, prio);
+        self_p = owner_p->mutex.waiting_p;
+
+        /* Move the owner to its new position in the wait list of
+           the mutex it is waiting for. */
+        if (self_p != NULL) {
+            thrd_prio_list_remove_isr(&self_p->waiters,
+                                      owner_p->mutex.elem_p);
+            thrd_prio_list_push_isr(&self_p->waiters,
+                                    owner_p->mutex.elem_p);
+        }
+    }
+}
+
+/**
+ * Add given mutex to the list of mutexes held by given thread.
+ */
+static void held_push(struct mutex_t *self_p, struct thrd_t *thrd_p)
+{
+    self_p->owner_p = thrd_p;
+
+    if (self_p->prio_inherit == 1) {
+        self_p->next_p = thrd_p->mutex.held_p;
+        thrd_p->mutex.held_p = self_p;
+    }
+}
+
+/**
+ * Remove given mutex from the list of mutexes held by its owner and
+ * restore the owner's priority to the highest of its base priority
+ * and the priorities of the threads waiting for the mutexes it still
+ * holds.
+ */
+static void held_remove(struct mutex_t *self_p)
+{
+    struct thrd_t *owner_p;
+    struct mutex_t *curr_p;
+    struct mutex_t **prev_pp;
+    int prio;
+
+    owner_p = self_p->owner_p;
+    self_p->owner_p = NULL;
+
+    if ((owner_p == NULL) || (self_p->prio_inherit == 0)) {
+        return;
+    }
+
+    prev_pp = &owner_p->mutex.held_p;
+    prio = owner_p->mutex.base_prio;
+
+    for (curr_p = owner_p->mutex.held_p;
+         curr_p != NULL;
+         curr_p = curr_p->next_p) {
+        if (curr_p == self_p) {
+            *prev_pp = curr_p->next_p;
+        } else {
+            prev_pp = &curr_p->next_p;
+
+            if ((curr_p->waiters.head_p != NULL)
+                && (curr_p->waiters.head_p->thrd_p->prio < prio)) {
+                prio = curr_p->waiters.head_p->thrd_p->prio;
+            }
+        }
+    }
+
+    if (prio != owner_p->prio) {
+        thrd_set_prio_isr(owner_p, prio);
+    }
+}
+
+#endif
+
 int mutex_init(struct mutex_t *self_p)
 {
     self_p->is_locked = 0;
     thrd_prio_list_init(&self_p->waiters);
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    self_p->prio_inherit = 0;
+    self_p->owner_p = NULL;
+    self_p->next_p = NULL;
+#endif
+
+    return (0);
+}
+
+int mutex_set_prio_inherit(struct mutex_t *self_p, int enable)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    if (self_p->is_locked == 1) {
+        return (-EBUSY);
+    }
+
+    self_p->prio_inherit = (enable != 0);
 
     return (0);
+#else
+    return (-ENOSYS);
+#endif
 }
 
 int mutex_lock(struct mutex_t *self_p)
@@ -72,9 +183,17 @@ int mutex_lock_isr(struct mutex_t *self_p)
     if (self_p->is_locked == 1) {
         elem.thrd_p = thrd_self();
         thrd_prio_list_push_isr(&self_p->waiters, &elem);
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+        elem.thrd_p->mutex.waiting_p = self_p;
+        elem.thrd_p->mutex.elem_p = &elem;
+        inherit_prio(self_p, elem.thrd_p->prio);
+#endif
         thrd_suspend_isr(NULL);
     } else {
         self_p->is_locked = 1;
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+        held_push(self_p, thrd_self());
+#endif
     }
 
     return (0);
@@ -84,9 +203,19 @@ int mutex_unlock_isr(struct mutex_t *self_p)
 {
     struct thrd_prio_list_elem_t *elem_p;
 
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    held_remove(self_p);
+#endif
+
     elem_p = thrd_prio_list_pop_isr(&self_p->waiters);
 
     if (elem_p != NULL) {
+        /* Hand the mutex over to the highest priority waiter. */
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+        elem_p->thrd_p->mutex.waiting_p = NULL;
+        elem_p->thrd_p->mutex.elem_p = NULL;
+        held_push(self_p, elem_p->thrd_p);
+#endif
         thrd_resume_isr(elem_p->thrd_p, 0);
     } else {
         self_p->is_locked = 0;
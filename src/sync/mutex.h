@@ -38,6 +38,14 @@ struct mutex_t {
     int8_t is_locked;
     /** Wait list. */
     struct thrd_prio_list_t waiters;
+#if CONFIG_MUTEX_PRIO_INHERIT == 1
+    /** Priority inheritance enabled. */
+    int8_t prio_inherit;
+    /** Thread holding the mutex. */
+    struct thrd_t *owner_p;
+    /** Next mutex held by the owner. */
+    struct mutex_t *next_p;
+#endif
 };
 
 /**
@@ -60,6 +68,28 @@ int mutex_module_init(void);
  */
 int mutex_init(struct mutex_t *self_p);
 
+/**
+ * Enable or disable priority inheritance for given unlocked mutex. A
+ * thread holding a mutex with priority inheritance enabled runs at
+ * the priority of the highest priority thread waiting for it, until
+ * the mutex is unlocked. Inheritance is transitive, that is, if the
+ * holder in turn waits for another priority inheritance mutex, the
+ * holder of that mutex is boosted as well.
+ *
+ * This bounds the time a high priority thread waits for a mutex held
+ * by a low priority thread, which otherwise can be delayed
+ * indefinitely by medium priority threads.
+ *
+ * Requires `CONFIG_MUTEX_PRIO_INHERIT`.
+ *
+ * @param[in] self_p Mutex.
+ * @param[in] enable True(1) to enable priority inheritance, false(0)
+ *                   to disable it.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mutex_set_prio_inherit(struct mutex_t *self_p, int enable);
+
 /**
  * Lock given mutex.
  *
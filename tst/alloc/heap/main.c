@@ -30,7 +30,12 @@
 
 #include "simba.h"
 
+#define BENCHMARK_SLOTS                                    32
+#define BENCHMARK_ROUNDS                               200000
+
 static char buffer[2048];
+static char benchmark_buffer[131072];
+static struct heap_t registered_heap;
 
 static int test_alloc_free(struct harness_t *harness)
 {
@@ -159,6 +164,287 @@ static int test_out_of_memory(struct harness_t *harness)
     return (0);
 }
 
+static int test_split(struct harness_t *harness)
+{
+    struct heap_t heap;
+    char *buffers[4];
+    size_t sizes[8] = { 16, 32, 64, 128, 256, 512, 512, 512 };
+
+    BTASSERT(heap_init(&heap, buffer, sizeof(buffer), sizes) == 0);
+
+    buffers[0] = heap_alloc(&heap, 1400);
+    BTASSERT(buffers[0] != NULL);
+    buffers[1] = heap_alloc(&heap, 600);
+    BTASSERT(buffers[1] != NULL);
+    BTASSERT(heap_free(&heap, buffers[0]) == 0);
+
+    /* Both buffers are allocated from the freed 1400 bytes buffer. */
+    buffers[2] = heap_alloc(&heap, 520);
+    BTASSERT(buffers[2] == buffers[0]);
+    memset(buffers[2], -1, 520);
+    buffers[3] = heap_alloc(&heap, 600);
+    BTASSERT(buffers[3] > buffers[2]);
+    BTASSERT(buffers[3] + 600 <= buffers[0] + 1400);
+    memset(buffers[3], -1, 600);
+
+    BTASSERT(heap_free(&heap, buffers[1]) == 0);
+    BTASSERT(heap_free(&heap, buffers[2]) == 0);
+    BTASSERT(heap_free(&heap, buffers[3]) == 0);
+
+    return (0);
+}
+
+static int test_coalesce(struct harness_t *harness)
+{
+    int i;
+    struct heap_t heap;
+    char *buffers[3];
+    char *buf_p;
+    size_t sizes[8] = { 16, 32, 64, 128, 256, 512, 512, 512 };
+
+    BTASSERT(heap_init(&heap, buffer, sizeof(buffer), sizes) == 0);
+
+    for (i = 0; i < 3; i++) {
+        buffers[i] = heap_alloc(&heap, 600);
+        BTASSERT(buffers[i] != NULL);
+    }
+
+    /* No room for another buffer. */
+    BTASSERT(heap_alloc(&heap, 600) == NULL);
+
+    /* Free the two upper buffers, which are merged into one. */
+    BTASSERT(heap_free(&heap, buffers[1]) == 0);
+    BTASSERT(heap_free(&heap, buffers[0]) == 0);
+    buf_p = heap_alloc(&heap, 1200);
+    BTASSERT(buf_p == buffers[1]);
+    memset(buf_p, -1, 1200);
+    BTASSERT(heap_free(&heap, buf_p) == 0);
+
+    /* Freeing the lowest buffer gives all memory back. */
+    BTASSERT(heap_free(&heap, buffers[2]) == 0);
+    buf_p = heap_alloc(&heap, 1900);
+    BTASSERT(buf_p != NULL);
+    memset(buf_p, -1, 1900);
+    BTASSERT(heap_free(&heap, buf_p) == 0);
+
+    /* Memory given back can be used by fixed size buffers as well. */
+    for (i = 0; i < 3; i++) {
+        buffers[i] = heap_alloc(&heap, 512);
+        BTASSERT(buffers[i] != NULL);
+    }
+
+    return (0);
+}
+
+static int test_share_dynamic(struct harness_t *harness)
+{
+    struct heap_t heap;
+    void *buf_p;
+    void *buf2_p;
+    size_t sizes[8] = { 16, 32, 64, 128, 256, 512, 512, 512 };
+
+    BTASSERT(heap_init(&heap, buffer, sizeof(buffer), sizes) == 0);
+
+    buf_p = heap_alloc(&heap, 1000);
+    BTASSERT(buf_p != NULL);
+    BTASSERT(heap_share(&heap, buf_p, 2) == 0);
+    BTASSERT(heap_free(&heap, buf_p) == 2);
+    BTASSERT(heap_free(&heap, buf_p) == 1);
+
+    /* The shared buffer is still allocated. */
+    buf2_p = heap_alloc(&heap, 1000);
+    BTASSERT(buf2_p != NULL);
+    BTASSERT(buf2_p != buf_p);
+    BTASSERT(heap_alloc(&heap, 1000) == NULL);
+
+    BTASSERT(heap_free(&heap, buf_p) == 0);
+    BTASSERT(heap_free(&heap, buf_p) == -1);
+    BTASSERT(heap_alloc(&heap, 1000) == buf_p);
+
+    return (0);
+}
+
+static int test_fragmentation(struct harness_t *harness)
+{
+    int i;
+    int slot;
+    int failures;
+    struct heap_t heap;
+    void *buffers[BENCHMARK_SLOTS];
+    size_t sizes[8] = { 16, 32, 64, 128, 256, 512, 512, 512 };
+    size_t size;
+    uint32_t seed;
+    struct time_t start;
+    struct time_t stop;
+    struct time_t diff;
+    long elapsed_us;
+
+    BTASSERT(heap_init(&heap,
+                       benchmark_buffer,
+                       sizeof(benchmark_buffer),
+                       sizes) == 0);
+
+    memset(&buffers[0], 0, sizeof(buffers));
+    failures = 0;
+    seed = 1;
+
+    time_get(&start);
+
+    /* Replace a random buffer with a new one of random size. */
+    for (i = 0; i < BENCHMARK_ROUNDS; i++) {
+        seed = (1103515245 * seed + 12345);
+        slot = ((seed >> 16) % BENCHMARK_SLOTS);
+        size = (513 + ((seed >> 8) % 3584));
+
+        if (buffers[slot] != NULL) {
+            heap_free(&heap, buffers[slot]);
+        }
+
+        buffers[slot] = heap_alloc(&heap, size);
+
+        if (buffers[slot] == NULL) {
+            failures++;
+        }
+    }
+
+    time_get(&stop);
+    time_subtract(&diff, &stop, &start);
+    elapsed_us = (diff.seconds * 1000000L + diff.nanoseconds / 1000L);
+
+    std_printf(FSTR("%d rounds with %d live buffers\r\n"
+                    "elapsed time: %ld us\r\n"
+                    "alloc and free pairs per second: %ld\r\n"
+                    "failed allocations: %d\r\n"),
+               BENCHMARK_ROUNDS,
+               BENCHMARK_SLOTS,
+               elapsed_us,
+               (long)((1000000LL * BENCHMARK_ROUNDS) / (elapsed_us + 1)),
+               failures);
+
+    BTASSERT(failures == 0);
+
+    for (slot = 0; slot < BENCHMARK_SLOTS; slot++) {
+        if (buffers[slot] != NULL) {
+            BTASSERT(heap_free(&heap, buffers[slot]) == 0);
+        }
+    }
+
+    /* All memory is merged into a single block again. */
+    size = (sizeof(benchmark_buffer) - 64);
+    buffers[0] = heap_alloc(&heap, size);
+    BTASSERT(buffers[0] != NULL);
+    BTASSERT(heap_free(&heap, buffers[0]) == 0);
+
+    return (0);
+}
+
+static int test_stats(struct harness_t *harness)
+{
+    struct heap_stats_t stats;
+    void *buffers[2];
+    size_t sizes[8] = { 16, 32, 64, 128, 256, 512, 512, 512 };
+    char command[48];
+
+    BTASSERT(heap_init(&registered_heap,
+                       buffer,
+                       sizeof(buffer),
+                       sizes) == 0);
+
+    BTASSERT(heap_get_stats(&registered_heap, &stats) == 0);
+    BTASSERT(stats.used == 0);
+    BTASSERT(stats.used_max == 0);
+    BTASSERT(stats.allocs == 0);
+    BTASSERT(stats.frees == 0);
+    BTASSERT(stats.failed_allocs == 0);
+
+    /* One fixed size buffer and one dynamic buffer. */
+    buffers[0] = heap_alloc(&registered_heap, 10);
+    BTASSERT(buffers[0] != NULL);
+    buffers[1] = heap_alloc(&registered_heap, 1000);
+    BTASSERT(buffers[1] != NULL);
+    BTASSERT(heap_alloc(&registered_heap, 3000) == NULL);
+
+    BTASSERT(heap_get_stats(&registered_heap, &stats) == 0);
+    BTASSERT(stats.used > 1016);
+    BTASSERT(stats.used_max == stats.used);
+    BTASSERT(stats.allocs == 2);
+    BTASSERT(stats.frees == 0);
+    BTASSERT(stats.failed_allocs == 1);
+
+    strcpy(command, "/alloc/heap/stats");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+
+    /* A shared buffer is not freed until its count reaches zero. */
+    BTASSERT(heap_share(&registered_heap, buffers[1], 1) == 0);
+    BTASSERT(heap_free(&registered_heap, buffers[1]) == 1);
+    BTASSERT(heap_get_stats(&registered_heap, &stats) == 0);
+    BTASSERT(stats.frees == 0);
+
+    BTASSERT(heap_free(&registered_heap, buffers[1]) == 0);
+    BTASSERT(heap_free(&registered_heap, buffers[0]) == 0);
+
+    BTASSERT(heap_get_stats(&registered_heap, &stats) == 0);
+    BTASSERT(stats.used == 0);
+    BTASSERT(stats.used_max > 1016);
+    BTASSERT(stats.allocs == 2);
+    BTASSERT(stats.frees == 2);
+    BTASSERT(stats.failed_allocs == 1);
+
+    /* The counters are per heap. */
+    BTASSERT(registered_heap.counters.allocs.counter.value == 2);
+    BTASSERT(registered_heap.counters.frees.counter.value == 2);
+    BTASSERT(registered_heap.counters.failed_allocs.counter.value == 1);
+
+    strcpy(command, "/alloc/heap/registered/allocs");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+    strcpy(command, "/alloc/heap/registered/failed_allocs");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+
+    return (0);
+}
+
+static int test_trace(struct harness_t *harness)
+{
+    void *buf_p;
+    size_t sizes[8] = { 16, 32, 64, 128, 256, 512, 512, 512 };
+    char command[32];
+    struct heap_trace_entry_t *entry_p;
+
+    BTASSERT(heap_init(&registered_heap,
+                       buffer,
+                       sizeof(buffer),
+                       sizes) == 0);
+
+    buf_p = heap_alloc(&registered_heap, 700);
+    BTASSERT(buf_p != NULL);
+    BTASSERT(heap_free(&registered_heap, buf_p) == 0);
+    BTASSERT(heap_alloc(&registered_heap, 3000) == NULL);
+
+    BTASSERT(registered_heap.trace.count == 3);
+    entry_p = &registered_heap.trace.entries[0];
+    BTASSERT(entry_p->buf_p == buf_p);
+    BTASSERT(entry_p->size == 700);
+    BTASSERT(entry_p->caller_p != NULL);
+    entry_p = &registered_heap.trace.entries[1];
+    BTASSERT(entry_p->buf_p == buf_p);
+    BTASSERT(entry_p->size == 0);
+    entry_p = &registered_heap.trace.entries[2];
+    BTASSERT(entry_p->buf_p == NULL);
+    BTASSERT(entry_p->size == 3000);
+
+    /* Wrap around the trace ring buffer. */
+    buf_p = heap_alloc(&registered_heap, 1);
+    BTASSERT(buf_p != NULL);
+    BTASSERT(heap_free(&registered_heap, buf_p) == 0);
+    BTASSERT(registered_heap.trace.count == 5);
+    BTASSERT(registered_heap.trace.entries[0].size == 0);
+
+    strcpy(command, "/alloc/heap/trace");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_t harness;
@@ -168,10 +454,18 @@ int main()
         { test_share, "test_share" },
         { test_big_buffer, "test_big_buffer" },
         { test_out_of_memory, "test_out_of_memory" },
+        { test_split, "test_split" },
+        { test_coalesce, "test_coalesce" },
+        { test_share_dynamic, "test_share_dynamic" },
+        { test_fragmentation, "test_fragmentation" },
+        { test_stats, "test_stats" },
+        { test_trace, "test_trace" },
         { NULL, NULL }
     };
 
     sys_start();
+    heap_module_init();
+    heap_register(&registered_heap, "registered");
 
     harness_init(&harness);
     harness_run(&harness, harness_testcases);
@@ -0,0 +1,321 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+/**
+ * This file was generated by simbagen.py 1.2 2026-10-18 03:42 UTC.
+ */
+
+#include "simba.h"
+
+const FAR char sysinfo[] = "app:    log_binary_suite-master built 2026-10-18 03:42 UTC by root.\r\n"
+                           "board:  Linux\r\n"
+                           "mcu:    Linux\r\n";
+
+
+
+
+
+const FAR struct setting_t settings[] = {
+
+    { NULL, 0, 0, 0 }
+};
+
+const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE] = {};
+
+
+
+uint8_t nvm_eeprom_soft_block_0[CONFIG_NVM_EEPROM_SOFT_BLOCK_0_SIZE]
+__attribute__ ((section (".nvm.eeprom_soft.block_0"))) = { 28, 99, 138, 8, 1, 0, 195, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 };
+
+
+
+uint8_t nvm_eeprom_area[CONFIG_NVM_SIZE]
+__attribute__ ((section (".eeprom"))) = {  };
+
+
+const char soam_database_id[] = "67f20e06b3096187c133384edc57e0dc";
+
+const size_t soam_database_compressed_size = 25542;
+
+const uint8_t soam_database_compressed[] = { 1, 35, 32, 84, 104, 105, 115, 32, 102, 105, 108, 101, 32, 119, 97, 115, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 115, 105, 109, 98, 97, 103, 101, 110, 46, 112, 121, 32, 49, 46, 50, 32, 50, 48, 50, 54, 45, 49, 48, 45, 49, 56, 32, 48, 51, 58, 52, 50, 32, 85, 84, 67, 46, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 49, 32, 34, 123, 125, 32, 123, 125, 32, 123, 125, 32, 123, 125, 32, 123, 125, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 49, 32, 34, 100, 117, 120, 99, 115, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 50, 32, 34, 100, 101, 98, 117, 103, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 51, 32, 34, 123, 125, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 51, 32, 34, 115, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 52, 32, 34, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 52, 32, 34, 102, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 53, 32, 34, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 53, 32, 34, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 54, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 54, 56, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 54, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 55, 50, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 55, 50, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 55, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 55, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 116, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 55, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 55, 54, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 56, 48, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 56, 48, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 56, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 56, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 56, 53, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 32, 62, 61, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 51, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 56, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 49, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 50, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 104, 97, 110, 100, 108, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 48, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 104, 97, 110, 100, 108, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 51, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 111, 98, 106, 101, 99, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 52, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 111, 98, 106, 101, 99, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 56, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 57, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 52, 48, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 49, 51, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 98, 32, 34, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 99, 32, 34, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 32, 84, 69, 83, 84, 32, 66, 69, 71, 73, 78, 32, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 100, 32, 34, 101, 110, 116, 101, 114, 58, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 100, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 101, 32, 34, 70, 111, 117, 110, 100, 32, 117, 110, 114, 101, 97, 100, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 46, 32, 70, 97, 105, 108, 105, 110, 103, 32, 116, 101, 115, 116, 46, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 101, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 102, 32, 34, 101, 120, 105, 116, 58, 32, 123, 125, 58, 32, 80, 65, 83, 83, 69, 68, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 102, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 48, 32, 34, 101, 120, 105, 116, 58, 32, 123, 125, 58, 32, 70, 65, 73, 76, 69, 68, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 48, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 49, 32, 34, 101, 120, 105, 116, 58, 32, 123, 125, 58, 32, 83, 75, 73, 80, 80, 69, 68, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 49, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 50, 32, 34, 104, 97, 114, 110, 101, 115, 115, 32, 114, 101, 112, 111, 114, 116, 58, 32, 116, 111, 116, 97, 108, 40, 123, 125, 41, 44, 32, 112, 97, 115, 115, 101, 100, 40, 123, 125, 41, 44, 32, 102, 97, 105, 108, 101, 100, 40, 123, 125, 41, 44, 32, 115, 107, 105, 112, 112, 101, 100, 40, 123, 125, 41, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 50, 32, 34, 100, 100, 100, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 51, 32, 34, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 32, 84, 69, 83, 84, 32, 69, 78, 68, 32, 40, 123, 125, 41, 32, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 51, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 53, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 101, 118, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 55, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 57, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 49, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 54, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 54, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 101, 118, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 55, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 104, 97, 115, 104, 47, 99, 114, 99, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 104, 97, 115, 104, 47, 99, 114, 99, 46, 99, 58, 49, 51, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 115, 121, 115, 46, 99, 58, 55, 50, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 117, 112, 116, 105, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 115, 121, 115, 46, 99, 58, 55, 52, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 117, 112, 116, 105, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 111, 119, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 55, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 101, 119, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 56, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 101, 102, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 105, 103, 104, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 49, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 49, 48, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 101, 102, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 49, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 105, 103, 104, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 47, 117, 110, 105, 120, 95, 116, 105, 109, 101, 95, 116, 111, 95, 100, 97, 116, 101, 46, 105, 58, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 97, 116, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 47, 117, 110, 105, 120, 95, 116, 105, 109, 101, 95, 116, 111, 95, 100, 97, 116, 101, 46, 105, 58, 54, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 105, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 52, 49, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 52, 49, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 105, 109, 101, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 52, 49, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 52, 51, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 52, 54, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 53, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 65, 77, 69, 32, 32, 32, 32, 32, 32, 32, 32, 83, 84, 65, 84, 69, 32, 32, 80, 82, 73, 79, 32, 32, 76, 79, 71, 77, 65, 83, 75, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 54, 32, 34, 123, 125, 32, 123, 125, 32, 123, 125, 32, 32, 32, 32, 32, 48, 120, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 54, 32, 34, 115, 115, 100, 120, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 55, 32, 34, 85, 115, 97, 103, 101, 58, 32, 115, 101, 116, 95, 108, 111, 103, 95, 109, 97, 115, 107, 32, 60, 116, 104, 114, 101, 97, 100, 32, 110, 97, 109, 101, 62, 32, 60, 108, 111, 103, 32, 109, 97, 115, 107, 62, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 97, 105, 110, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 50, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 99, 107, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 50, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 99, 107, 95, 115, 105, 122, 101, 32, 62, 32, 115, 105, 122, 101, 111, 102, 40, 115, 116, 114, 117, 99, 116, 32, 116, 104, 114, 100, 95, 116, 41, 32, 43, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 56, 50, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 56, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 57, 49, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 57, 51, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 57, 54, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 57, 56, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 49, 48, 49, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 49, 48, 50, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 51, 48, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 51, 48, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 51, 48, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 61, 32, 53, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 51, 48, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 48, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 48, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 49, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 49, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 50, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 50, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 52, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 52, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 112, 111, 114, 116, 115, 47, 108, 105, 110, 117, 120, 47, 110, 118, 109, 95, 112, 111, 114, 116, 46, 105, 58, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 111, 100, 117, 108, 101, 46, 112, 111, 114, 116, 46, 110, 118, 109, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 111, 100, 117, 108, 101, 46, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 32, 61, 61, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 56, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 56, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 111, 100, 117, 108, 101, 46, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 32, 61, 61, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 57, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 98, 32, 34, 123, 125, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 98, 32, 34, 120, 120, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 54, 54, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 109, 109, 97, 110, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 100, 32, 34, 123, 125, 58, 32, 99, 111, 109, 109, 97, 110, 100, 32, 110, 111, 116, 32, 102, 111, 117, 110, 100, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 100, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 57, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 57, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 57, 55, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 50, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 50, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 124, 124, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 54, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 57, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 124, 124, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 49, 52, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 49, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 50, 49, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 50, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 105, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 50, 53, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 51, 48, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 105, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 51, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 105, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 51, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 52, 50, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 52, 50, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 52, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 54, 54, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 53, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 109, 100, 95, 112, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 55, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 56, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 109, 100, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 111, 112, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 56, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 45, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 109, 109, 97, 110, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 51, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 52, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 54, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 116, 95, 99, 98, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 114, 105, 110, 116, 95, 99, 98, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 97, 108, 117, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 50, 48, 49, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 114, 97, 109, 101, 116, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 50, 48, 50, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 97, 100, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 119, 114, 105, 116, 101, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 48, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 119, 111, 114, 107, 115, 112, 97, 99, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 48, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 49, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 115, 105, 122, 101, 32, 47, 32, 115, 105, 122, 101, 111, 102, 40, 108, 105, 115, 116, 95, 112, 45, 62, 99, 104, 97, 110, 115, 95, 112, 112, 91, 48, 93, 41, 41, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 52, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 40, 115, 116, 114, 117, 99, 116, 32, 99, 104, 97, 110, 95, 116, 32, 42, 41, 115, 101, 108, 102, 95, 112, 41, 45, 62, 114, 101, 97, 100, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 54, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 54, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 95, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 55, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 40, 115, 116, 114, 117, 99, 116, 32, 99, 104, 97, 110, 95, 116, 32, 42, 41, 118, 95, 115, 101, 108, 102, 95, 112, 41, 45, 62, 119, 114, 105, 116, 101, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 52, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 55, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 57, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 55, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 55, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 98, 117, 102, 95, 112, 32, 61, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 124, 124, 32, 40, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 38, 38, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 41, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 50, 50, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 50, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 49, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 50, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 52, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 61, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 57, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 49, 52, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 52, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 52, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 99, 111, 117, 110, 116, 32, 62, 61, 32, 48, 41, 32, 38, 38, 32, 40, 99, 111, 117, 110, 116, 32, 60, 61, 32, 99, 111, 117, 110, 116, 95, 109, 97, 120, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 52, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 95, 109, 97, 120, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 32, 62, 61, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 109, 117, 116, 101, 120, 46, 99, 58, 49, 52, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 52, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 52, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 48, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 48, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 50, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 52, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 52, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 97, 112, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 53, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 54, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 55, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 55, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 53, 56, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 97, 112, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 51, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 51, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 97, 108, 117, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 51, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 98, 97, 115, 101, 32, 61, 61, 32, 49, 54, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 49, 48, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 56, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 50, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 48, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 48, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 51, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 48, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 51, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 49, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 52, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 48, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 55, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 49, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 57, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 48, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 102, 32, 34, 34, 10, 67, 77, 68, 58, 32, 48, 120, 56, 48, 54, 52, 32, 34, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 47, 108, 105, 115, 116, 34, 10, 67, 77, 68, 58, 32, 48, 120, 56, 48, 54, 53, 32, 34, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 47, 115, 101, 116, 95, 108, 111, 103, 95, 109, 97, 115, 107, 34, 10 };
+
+const FAR char __fmt_eiswiibfouqck6baevrsajlteaswyzc4ojog4iq_[] = "\x80\x01""%d\x1f%u\x1f%x\x1f%c\x1f%s\x1f%ld";
+const FAR char __fmt_ejsgkytvm5ohexdoei______[] = "\x80\x02""";
+const FAR char __fmt_eisxgibfmrohexdoei______[] = "\x80\x03""%s\x1f%d";
+const FAR char __fmt_eiswmxdslrxce___[] = "\x80\x04""%f";
+const FAR char __fmt_eiswixdslrxce___[] = "\x80\x05""%d";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorwha2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x06""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorwha3duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x07""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorwha3tuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x08""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorxgiztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x09""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorxgi2duicbknjukusuhiqcq3tbnvsv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x0a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorxguyduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x0b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorxguytuicbknjukusuhiqcq43umf2hgx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x0c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorxgyztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x0d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorxgy2duicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x0e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggoryga4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x0f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggoryga4tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x10""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggoryguztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x11""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorygu2duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x12""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorygu2tuicbknjukusuhiqcqy3povxhiib6huqdalbagizcsic4ojog4iq_[] = "\x80\x13""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiztooraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x14""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiztqoraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x15""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiztsoraifjvgrkskq5cakdtnf5gkib6eaycyibsgiusaxdslrxce___[] = "\x80\x16""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2tgoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x17""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2tioraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x18""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi4dkoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x19""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi4dmoraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x1a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytcnj2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytemr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytgob2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytmmz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrzgi5caqktkncvevb2eaugqylomrwgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzqgy5caqktkncvevb2eaugqylomrwgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x21""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumztgu5caqktkncvevb2eaug6ytkmvrxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x23""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzuhe5caqktkncvevb2eaug6ytkmvrxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x24""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzygy5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x26""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzyg45caqktkncvevb2eaugg2dpov2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x27""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzzhe5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x28""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtunbqga5caqktkncvevb2eaug4ylnmvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x29""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumjtg4ytuicbknjukusuhiqcqztnorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x2a""";
+const FAR char __fmt_ejohexdoei______[] = "\x80\x2b""";
+const FAR char __fmt_ei6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5ebkeku2uebbekr2jjyqd2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hvohexdolrzfy3rc[] = "\x80\x2c""";
+const FAR char __fmt_ejsw45dfoi5cajltlrzfy3rc[] = "\x80\x2d""%s";
+const FAR char __fmt_ejdg65lomqqhk3tsmvqwiidnn5rwwidjmqqcojlte4xcartbnfwgs3theb2gk43ufzohexdoei______[] = "\x80\x2e""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2ebiecu2tivcfy4s4nzohexdoei______[] = "\x80\x2f""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2ebdecskmivcfy4s4nzohexdoei______[] = "\x80\x30""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2ebjuwskqkbcuixdslrxfy4s4nyra____[] = "\x80\x31""%s";
+const FAR char __fmt_ejugc4tomvzxgidsmvyg64tuhiqhi33umfwcqjlefewca4dbonzwkzbievscslbamzqws3dfmquckzbjfqqhg23jobygkzbievscsxdslrxfy4s4nyra____[] = "\x80\x32""%d\x1f%d\x1f%d\x1f%d";
+const FAR char __fmt_ei6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6savcfknkcarkoiqqcqjltfeqd2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6vy4s4nzohexdoei______[] = "\x80\x33""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gu4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x34""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gu4tuicbknjukusuhiqcqzdfozpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x35""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4ytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x36""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4zduicbknjukusuhiqcqzdtorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x37""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4ztuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x38""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x39""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he3duicbknjukusuhiqcq43smnpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he3tuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x3b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2geytqoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x3c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2geytsoraifjvgrkskq5cakdtnf5gkib6eaycyibsgiusaxdslrxce___[] = "\x80\x3d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorwga5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorwge5caqktkncvevb2eaugizlwl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x3f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorxha5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x40""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorygu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x41""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5ugc43if5rxeyzomm5dcmjyhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x42""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5ugc43if5rxeyzomm5dcmzuhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x43""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc643zomxggorxgi3tuicbknjukusuhiqcq5lqoruw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x44""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc643zomxggorxgq2tuicbknjukusuhiqcq5lqoruw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x45""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2gyztuicbknjukusuhiqcq3tpo5pxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x46""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2g42duicbknjukusuhiqcq3tfo5pxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x47""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2ha4tuicbknjukusuhiqcq4tfonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x48""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2heyduicbknjukusuhiqcq3dfmz2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x49""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2heytuicbknjukusuhiqcq4tjm5uhix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x4a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydkoraifjvgrkskq5cakdsmvzv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x4b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydmoraifjvgrkskq5cakdmmvthix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x4c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydooraifjvgrkskq5cakdsnftwq5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x4d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss65lonf4f65djnvsv65dpl5sgc5dffzutunryhiqecu2tivjfiorafbsgc5dfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x4e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss65lonf4f65djnvsv65dpl5sgc5dffzutunrzhiqecu2tivjfiorafb2gs3lfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x4f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhi2dcmb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x50""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhi2dcmj2ebavgu2fkjkduibioruw2zlpov2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x51""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhi2dcmr2ebavgu2fkjkduibimnqwy3dcmfrwwibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x52""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhi2dgnr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x53""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhi2dmnr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x54""";
+const FAR char __fmt_eiqcaibaeaqcaibaeaqcaibaeaqe4qkniuqcaibaeaqcaictkravirjaebifeskpeaqeyt2hjvavgs24ojog4iq_[] = "\x80\x55""";
+const FAR char __fmt_eistemdteastcmtteastkzbaeaqcaibqpastamtylrzfy3rc[] = "\x80\x56""%20s\x1f%12s\x1f%5d\x1f%02x";
+const FAR char __fmt_ejkxgylhmu5ca43forpwy33hl5wwc43lea6hi2dsmvqwiidomfwwkprahrwg6zzanvqxg2z6lrzfy3rc[] = "\x80\x57""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4zdeoraifjvgrkskq5cakdnmfuw4ibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x58""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4zdgoraifjvgrkskq5cakdtorqwg227oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x59""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4zdioraifjvgrkskq5cakdtorqwg227onuxuzjahyqhg2l2mvxwmkdtorzhky3ueb2gq4tel52csibleaysyibsgiusaxdslrxce___[] = "\x80\x5a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g44tooraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x5b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2hazdcoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x5c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2ha4tooraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x5d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2heytioraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x5e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2heztaoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x5f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2he3dmoraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x60""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2he4dgoraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x61""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2geydcnb2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x62""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2geydenj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x63""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dgmbrhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x66""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dgmbshiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x67""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dgmbthiqecu2tivjfiorafbzws6tfea7d2ibvfqqdemrjebohexdoei______[] = "\x80\x68""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dgmbuhiqecu2tivjfiorafbrwq33vorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x69""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2damz2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x6a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2danb2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x6b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dcmj2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x6c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dcmr2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x6d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2demj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x6e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2demr2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x6f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2demz2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x70""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dioj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x71""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dkmb2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x72""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dkmj2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x73""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpobxxe5dtf5wgs3tvpaxw45tnl5yg64tufzutunjxhiqecu2tivjfiorafbww6zdvnrss44dpoj2c43twnvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x74""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqnz2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\x75""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqob2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x76""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqoj2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x77""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnr2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\x78""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnz2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x79""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsob2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x7a""";
+const FAR char __fmt_eistaodmpastaodmpbohexdoei______[] = "\x80\x7b""%08lx\x1f%08lx";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtunrwgi5caqktkncvevb2eaugg33nnvqw4zc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x7c""";
+const FAR char __fmt_eisxgoramnxw23lbnzsca3tpoqqgm33vnzsfy4s4nyra____[] = "\x80\x7d""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojrha5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x7e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojrhe5caqktkncvevb2eauhaylunbpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x7f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojxgu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x80""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgiyduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x81""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgiytuicbknjukusuhiqcqkdeon2f64baee6sakbiozxwszbafiutakjjeb6hyibionuxuzjahu6sambjfqqdemrjebohexdoei______[] = "\x80\x82""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgy3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x83""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgy4duicbknjukusuhiqcqzdtorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x84""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqhe3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x85""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqhe4duicbknjukusuhiqcqkdtojrv64baee6sakbiozxwszbafiutakjjeb6hyibionuxuzjahu6sambjfqqdemrjebohexdoei______[] = "\x80\x86""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrgq2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x87""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrha2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x88""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgeytuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x89""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgu2duicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x8a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgu2tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x8b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtgazduicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x8c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtgi4duicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x8d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtha3tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x8e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjugi3duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x8f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjugi3tuicbknjukusuhiqcq43umf2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x90""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjuha2duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x91""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvguztuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x92""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvgu2duicbknjukusuhiqcqy3in52xix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x93""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvhe3duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x94""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvhe3tuicbknjukusuhiqcqy3in52xix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x95""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjwgy2tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x96""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxguytuicbknjukusuhiqcqytvmzpxaibbhuqe4vkmjqwcarkjjzlectbjebohexdoei______[] = "\x80\x97""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxguzduicbknjukusuhiqcq4dboruf64dqeaqt2icokvgeylbaiveu4vsbjqusaxdslrxce___[] = "\x80\x98""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxguztuicbknjukusuhiqcqy3nmrpxa4baee6satsvjrgcyicfjfhfmqkmfeqfy4s4nyra____[] = "\x80\x99""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg44tuicbknjukusuhiqcq4dboruf64baee6satsvjrgcyicfjfhfmqkmfeqfy4s4nyra____[] = "\x80\x9a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxhayduicbknjukusuhiqcqy3nmrpxaibbhuqe4vkmjqwcarkjjzlectbjebohexdoei______[] = "\x80\x9b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxheytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x9c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxhezduicbknjukusuhiqcq3tbnvsv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x9d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxheztuicbknjukusuhiqcq33qonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x9e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg4ytuicbknjukusuhiqcqztjnrsxg6ltorsw2x3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x9f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyhaytuicbknjukusuhiqcqmbmeawtgobjebohexdoei______[] = "\x80\xa0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyheytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xa1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyhezduicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xa2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyheztuicbknjukusuhiqcqy3bnrwgeyldnmqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xa3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzga2tuicbknjukusuhiqcqy3pnvwwc3tel5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xa4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgm3duicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xa5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgq2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xa6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgq3duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xa7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgyzduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xa8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzg4ytuicbknjukusuhiqcqy3povxhizlsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xa9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzha2duicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xaa""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhe2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xab""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhe3duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xac""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhe3tuicbknjukusuhiqcq43forpwgyraee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xad""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhe4duicbknjukusuhiqcq4dsnfxhix3dmiqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xae""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhe4tuicbknjukusuhiqcq5tbnr2wkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xaf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqge3duicbknjukusuhiqcq4dbojqw2zlumvzf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqgi4tuicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xb1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjthiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xb2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjuhiqecu2tivjfiorafbzgkyleeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xb3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjvhiqecu2tivjfiorafb3xe2lumuqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xb4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjwhiqecu2tivjfiorafbzws6tfeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xb5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqg45caqktkncvevb2eaugy2ltorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqha5caqktkncvevb2eauho33snnzxayldmvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqhe5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xb8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjrga5caqktkncvevb2eaucq43jpjssalzaonuxuzlpmyugy2ltorpxalj6mnugc3ttl5yhawzqluussib6eaycyibsgiusaxdslrxce___[] = "\x80\xb9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjsgi5caqktkncvevb2eaugy2ltorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xba""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjugi5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvg45caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvha5caqktkncvevb2eaucqkdtorzhky3uebrwqylol52cakrjonswyzs7oaus2ptsmvqwiibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvhe5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xbe""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwga5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xbf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwhe5caqktkncvevb2eauhmx3tmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xc0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjxga5caqktkncvevb2eaucqkdtorzhky3uebrwqylol52cakrjozpxgzlmmzpxakjnhz3xe2lumuqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xc1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjxge5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xc2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjxgi5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xc3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrrhe5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrugm5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrvga5caqktkncvevb2eaugy2ltorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrvge5caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrxgi5caqktkncvevb2eaugy2ltorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrxgm5caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrzha5caqktkncvevb2eaugy2ltorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xca""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorxgq5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xcb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorxgu5caqktkncvevb2eaucqytvmzpxaib5huqcqkdwn5uwiibkfeycskjapr6cakbimj2wmx3qeaqt2ibifb3g62leeavcsmbjfeqcmjrafbzws6tfea7cambjfewcamrsfeqfy4s4nyra____[] = "\x80\xcc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrga3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xcd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrge4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xce""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrgu3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xcf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrgu3tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xd0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorsgi3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorsgi4duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xd2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortge3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgi2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgq3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgq3tuicbknjukusuhiqcq43jpjssapr5eaycyibsgiusaxdslrxce___[] = "\x80\xd6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gq3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gu4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2ha2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2he2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xda""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2geytqoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xdb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2ge2dkoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xdc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xdd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimz2ebavgu2fkjkduibifbrw65looqqd4pjagausajrgeaugg33vnz2capb5ebrw65loorpw2ylyfewcamrsfeqfy4s4nyra____[] = "\x80\xde""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dinb2ebavgu2fkjkduibimnxxk3tul5wwc6bahyqdalbagizcsic4ojog4iq_[] = "\x80\xdf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dknz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dqnb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dqnj2ebavgu2fkjkduibimnxxk3tuea7d2ibqfqqdemrjebohexdoei______[] = "\x80\xe2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5wxk5dfpaxggorrgqzduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5diojrhiqecu2tivjfiorafbshg5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5diojshiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dkmbxhiqecu2tivjfiorafbshg5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dkmbyhiqecu2tivjfiorafbzws6tfea7cambmeazdekjalrzfy3rc[] = "\x80\xe7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dkmbzhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dkmrvhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dknbthiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xea""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dknbuhiqecu2tivjfiorafbqxax3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xeb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dknjzhiqecu2tivjfiorafbrwqylol5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xec""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dknrqhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xed""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dknzyhiqecu2tivjfiorafbrwqylol5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xee""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dknzzhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xef""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dkobqhiqecu2tivjfiorafbqxax3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xf0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmmzrhiqecu2tivjfiorafbzxi4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xf1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmmzshiqecu2tivjfiorafb3gc3dvmvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmmzthiqecu2tivjfiorafaugeyltmuqd2pjage3csid4pqqcqytbonssapj5eaytakjapr6cakdcmfzwkib5huqdqkjapr6cakdcmfzwkib5huqdekjapr6cakdcmfzwkib5huqdakjmeazdekjalrzfy3rc[] = "\x80\xf3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsmbrhiqecu2tivjfiorafbshg5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xf4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsmbshiqecu2tivjfiorafbthg4tdl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xf5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsmjyhiqecu2tivjfiorafbzxi4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xf6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsmjzhiqecu2tivjfiorafbthg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xf7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsmzthiqecu2tivjfiorafbthg5dsgbpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsmzuhiqecu2tivjfiorafbthg5dsgfpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsnbzhiqecu2tivjfiorafbthg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xfa""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsnjqhiqecu2tivjfiorafbzxi4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xfb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsnzshiqecu2tivjfiorafbthg5dsgbpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsnzthiqecu2tivjfiorafbthg5dsgfpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dsojthiqecu2tivjfiorafbthg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xfe""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmbqgu5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xff""";
+const FAR char __cmd_eixwwzlsnzswyl3unbzgil3mnfzxiiq_[] = "/\x80\x64";
+const FAR char __cmd_eixwwzlsnzswyl3unbzgil3tmv2f63dpm5pw2yltnmra____[] = "/\x80\x65";
+
@@ -0,0 +1,271 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+static struct log_object_t foo;
+static struct log_handler_t handler;
+static struct queue_t queue;
+static uint8_t queue_buf[512];
+
+/**
+ * Read one binary log record from the queue. Returns the payload
+ * size.
+ */
+static ssize_t read_record(uint8_t *buf_p, size_t size)
+{
+    uint8_t byte;
+    size_t payload_size;
+
+    BTASSERT(queue_read(&queue, &byte, 1) == 1);
+    payload_size = (byte & 0x7f);
+
+    if (byte & 0x80) {
+        BTASSERT(queue_read(&queue, &byte, 1) == 1);
+        payload_size |= (byte << 7);
+    }
+
+    BTASSERT(payload_size <= size);
+    BTASSERT(queue_read(&queue, buf_p, payload_size) == payload_size);
+
+    return (payload_size);
+}
+
+/**
+ * Check the record header and returns the offset of the message.
+ */
+static ssize_t check_header(const uint8_t *buf_p, int level)
+{
+    size_t offset;
+
+    BTASSERT(buf_p[2] == level);
+    offset = 3;
+
+    /* Skip the time in seconds and milliseconds. */
+    while (buf_p[offset++] & 0x80);
+    while (buf_p[offset++] & 0x80);
+
+    BTASSERTM(&buf_p[offset], "main\0foo\0", 9);
+
+    return (offset + 9);
+}
+
+static int test_init(struct harness_t *harness_p)
+{
+    BTASSERT(log_module_init() == 0);
+    BTASSERT(log_set_default_handler_output_channel(NULL) == 0);
+    BTASSERT(log_object_init(&foo, "foo", LOG_UPTO(INFO)) == 0);
+    BTASSERT(queue_init(&queue, &queue_buf[0], sizeof(queue_buf)) == 0);
+    BTASSERT(log_handler_init(&handler, &queue) == 0);
+    BTASSERT(log_add_handler(&handler) == 0);
+
+    return (0);
+}
+
+static int test_print(struct harness_t *harness_p)
+{
+    uint8_t buf[128];
+    ssize_t size;
+    ssize_t offset;
+
+    BTASSERT(log_object_print(&foo,
+                              LOG_INFO,
+                              OSTR("%d %u %x %c %s %ld\r\n"),
+                              -3,
+                              300,
+                              0xbeef,
+                              'z',
+                              "str",
+                              -100000l) == 1);
+
+    size = read_record(&buf[0], sizeof(buf));
+
+    /* The format string identifier. */
+    BTASSERT(buf[0] & 0x80);
+
+    offset = check_header(&buf[0], LOG_INFO);
+    BTASSERTI(size - offset, ==, 14);
+    BTASSERTM(&buf[offset],
+              "\x05"
+              "\xac\x02"
+              "\xef\xfd\x02"
+              "\x7a"
+              "str\0"
+              "\xbf\x9a\x0c",
+              14);
+
+    /* Filtered by the log mask. */
+    BTASSERT(log_object_print(&foo, LOG_DEBUG, OSTR("debug\r\n")) == 0);
+    BTASSERT(queue_size(&queue) == 0);
+
+    return (0);
+}
+
+static int test_print_text(struct harness_t *harness_p)
+{
+    uint8_t buf[128];
+    ssize_t size;
+    ssize_t offset;
+
+    /* Messages without a format string identifier are formatted. */
+    BTASSERT(log_object_print(&foo,
+                              LOG_ERROR,
+                              FSTR("text %d\r\n"),
+                              5) == 1);
+
+    size = read_record(&buf[0], sizeof(buf));
+
+    BTASSERT(buf[0] == 0);
+    BTASSERT(buf[1] == 0);
+
+    offset = check_header(&buf[0], LOG_ERROR);
+    BTASSERTI(size - offset, ==, 9);
+    BTASSERTM(&buf[offset], "text 5\r\n", 9);
+
+    return (0);
+}
+
+static int test_print_truncated(struct harness_t *harness_p)
+{
+    uint8_t buf[128];
+    ssize_t size;
+    ssize_t offset;
+    char string[CONFIG_LOG_BINARY_RECORD_SIZE];
+
+    memset(&string[0], 'a', sizeof(string) - 1);
+    string[sizeof(string) - 1] = '\0';
+
+    /* The string is truncated and the last argument is dropped. */
+    BTASSERT(log_object_print(&foo,
+                              LOG_INFO,
+                              OSTR("%s %d\r\n"),
+                              &string[0],
+                              1) == 1);
+
+    size = read_record(&buf[0], sizeof(buf));
+
+    BTASSERTI(size, ==, CONFIG_LOG_BINARY_RECORD_SIZE - 2);
+    offset = check_header(&buf[0], LOG_INFO);
+    BTASSERT(buf[offset] == 'a');
+    BTASSERT(buf[size - 1] == '\0');
+
+    BTASSERT(log_object_print(&foo,
+                              LOG_INFO,
+                              FSTR("%s\r\n"),
+                              &string[0]) == 1);
+
+    size = read_record(&buf[0], sizeof(buf));
+
+    BTASSERTI(size, ==, CONFIG_LOG_BINARY_RECORD_SIZE - 2);
+    BTASSERT(buf[size - 1] == '\0');
+
+    return (0);
+}
+
+#if CONFIG_FLOAT == 1
+
+static int test_print_float(struct harness_t *harness_p)
+{
+    uint8_t buf[128];
+    ssize_t size;
+    ssize_t offset;
+
+    BTASSERT(log_object_print(&foo,
+                              LOG_INFO,
+                              OSTR("%f\r\n"),
+                              1.5) == 1);
+
+    size = read_record(&buf[0], sizeof(buf));
+
+    offset = check_header(&buf[0], LOG_INFO);
+    BTASSERTI(size - offset, ==, 4);
+    BTASSERTM(&buf[offset], "\x3f\xc0\x00\x00", 4);
+
+    return (0);
+}
+
+#endif
+
+static int test_soam(struct harness_t *harness_p)
+{
+    struct soam_t soam;
+    uint8_t txbuf[48];
+    uint8_t buf[64];
+    size_t size;
+    uint16_t crc;
+
+    BTASSERT(soam_init(&soam, &txbuf[0], sizeof(txbuf), &queue) == 0);
+    BTASSERT(log_remove_handler(&handler) == 0);
+    BTASSERT(log_set_default_handler_output_channel(
+                 soam_get_log_input_channel(&soam)) == 0);
+
+    BTASSERT(log_object_print(&foo, LOG_INFO, OSTR("%d\r\n"), 1) == 1);
+
+    /* A binary log point packet. */
+    BTASSERT(chan_read(&queue, &buf[0], 5) == 5);
+    BTASSERT(buf[0] == 0xc1);
+    size = ((buf[3] << 8) | buf[4]);
+    BTASSERT(size + 5 <= sizeof(buf));
+    BTASSERT(chan_read(&queue, &buf[5], size) == size);
+    crc = ((buf[size + 3] << 8) | buf[size + 4]);
+    BTASSERT(crc_ccitt(0xffff, &buf[0], size + 3) == crc);
+
+    /* The record, with its payload size. */
+    BTASSERT(buf[5] == size - 3);
+    BTASSERT(buf[size + 2] == 0x02);
+
+    BTASSERT(log_set_default_handler_output_channel(NULL) == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_init, "test_init" },
+        { test_print, "test_print" },
+        { test_print_text, "test_print_text" },
+        { test_print_truncated, "test_print_truncated" },
+#if CONFIG_FLOAT == 1
+        { test_print_float, "test_print_float" },
+#endif
+        { test_soam, "test_soam" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
@@ -0,0 +1,331 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+static struct log_object_t foo;
+static struct log_handler_t handler;
+static struct queue_t queue;
+static uint8_t queue_buf[2048];
+
+/**
+ * Read one log entry from the queue, without the time.
+ */
+static int read_entry(char *buf_p, size_t size)
+{
+    size_t pos;
+    char c;
+
+    pos = 0;
+
+    do {
+        BTASSERT(queue_read(&queue, &c, sizeof(c)) == sizeof(c));
+
+        if (pos == 0) {
+            /* Skip the time. */
+            if (c != ':') {
+                continue;
+            }
+
+            pos = 1;
+            continue;
+        }
+
+        BTASSERT(pos < size);
+        buf_p[pos - 1] = c;
+        pos++;
+    } while (c != '\n');
+
+    buf_p[pos - 1] = '\0';
+
+    return (0);
+}
+
+static int test_init(struct harness_t *harness_p)
+{
+    BTASSERT(log_module_init() == 0);
+    BTASSERT(log_object_init(&foo, "foo", LOG_UPTO(INFO)) == 0);
+    BTASSERT(queue_init(&queue, &queue_buf[0], sizeof(queue_buf)) == 0);
+    BTASSERT(log_handler_init(&handler, &queue) == 0);
+    BTASSERT(log_add_handler(&handler) == 0);
+
+    return (0);
+}
+
+static int test_print(struct harness_t *harness_p)
+{
+    char buf[128];
+    char expected[128];
+    size_t size;
+
+    /* The entries are only added to the buffer. */
+    BTASSERT(log_object_print(&foo,
+                              LOG_INFO,
+                              FSTR("%d %5d|%-5d|%05d %lu %x %c %s %S %%\r\n"),
+                              -3,
+                              42,
+                              7,
+                              -12,
+                              4000000000ul,
+                              0xbeef,
+                              'z',
+                              "str",
+                              FSTR("far")) == 1);
+    BTASSERT(log_object_print(&foo,
+                              LOG_WARNING,
+                              FSTR("%s|%-6s|%3c|%ld\r\n"),
+                              "a string longer than the thirty two "
+                              "characters copied",
+                              "ab",
+                              'c',
+                              -100000l) == 1);
+#if CONFIG_FLOAT == 1
+    BTASSERT(log_object_print(&foo,
+                              LOG_ERROR,
+                              FSTR("%f %f\r\n"),
+                              1.5,
+                              -0.25) == 1);
+#endif
+    BTASSERT(log_object_print(&foo, LOG_DEBUG, FSTR("disabled\r\n")) == 0);
+    BTASSERT(queue_size(&queue) == 0);
+
+    /* Format and write the entries. */
+    BTASSERT(log_flush() == 0);
+
+    BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+    size = std_sprintf(&expected[0], FSTR("info:main:foo: "));
+    std_sprintf(&expected[size],
+                FSTR("%d %5d|%-5d|%05d %lu %x %c %s %S %%\r\n"),
+                -3,
+                42,
+                7,
+                -12,
+                4000000000ul,
+                0xbeef,
+                'z',
+                "str",
+                FSTR("far"));
+    BTASSERTM(&buf[0], &expected[0], strlen(expected) + 1);
+
+    BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+    size = std_sprintf(&expected[0], FSTR("warning:main:foo: "));
+    std_sprintf(&expected[size],
+                FSTR("%s|%-6s|%3c|%ld\r\n"),
+                "a string longer than the thirty ",
+                "ab",
+                'c',
+                -100000l);
+    BTASSERTM(&buf[0], &expected[0], strlen(expected) + 1);
+
+#if CONFIG_FLOAT == 1
+    BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+    size = std_sprintf(&expected[0], FSTR("error:main:foo: "));
+    std_sprintf(&expected[size], FSTR("%f %f\r\n"), 1.5, -0.25);
+    BTASSERTM(&buf[0], &expected[0], strlen(expected) + 1);
+#endif
+
+    BTASSERT(queue_size(&queue) == 0);
+
+    return (0);
+}
+
+static int test_print_isr(struct harness_t *harness_p)
+{
+    char buf[64];
+
+    BTASSERT(log_object_print_isr(&foo,
+                                  LOG_INFO,
+                                  FSTR("isr %d\r\n"),
+                                  1) == 1);
+    BTASSERT(log_object_print_isr(&foo,
+                                  LOG_DEBUG,
+                                  FSTR("isr %d\r\n"),
+                                  2) == 0);
+    BTASSERT(log_flush() == 0);
+
+    BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+    BTASSERTM(&buf[0], "info:isr:foo: isr 1\r\n", 22);
+
+    return (0);
+}
+
+static int test_log_thread(struct harness_t *harness_p)
+{
+    char buf[64];
+
+    BTASSERT(log_object_print(&foo, LOG_INFO, FSTR("thread\r\n")) == 1);
+    BTASSERT(queue_size(&queue) == 0);
+
+    /* The low priority log thread writes the entry when this thread
+       sleeps. */
+    thrd_sleep_ms(10);
+
+    BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+    BTASSERTM(&buf[0], "info:main:foo: thread\r\n", 24);
+
+    return (0);
+}
+
+static int test_overflow(struct harness_t *harness_p)
+{
+    char buf[64];
+    char expected[64];
+    int i;
+    int res;
+    int added;
+    int next;
+    uint32_t dropped;
+
+    added = 0;
+    next = 0;
+    dropped = log_get_dropped_count();
+
+    /* Fill the buffer, several times around. */
+    for (i = 0; i < 3; i++) {
+        while ((res = log_object_print(&foo,
+                                       LOG_INFO,
+                                       FSTR("entry %d\r\n"),
+                                       added)) == 1) {
+            added++;
+        }
+
+        BTASSERTI(res, ==, -ENOMEM);
+        BTASSERT(log_get_dropped_count() == dropped + i + 1);
+        BTASSERT(log_flush() == 0);
+
+        while (queue_size(&queue) > 0) {
+            BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+
+            if (strncmp(&buf[0], "warning", 7) == 0) {
+                BTASSERTM(&buf[0],
+                          "warning:main:log: 1 log entries dropped.\r\n",
+                          43);
+            } else {
+                std_sprintf(&expected[0],
+                            FSTR("info:main:foo: entry %d\r\n"),
+                            next++);
+                BTASSERTM(&buf[0], &expected[0], strlen(expected) + 1);
+            }
+        }
+    }
+
+    BTASSERTI(next, ==, added);
+
+    std_printf(OSTR("%d entries fit in a %d bytes buffer.\r\n"),
+               added / 3,
+               CONFIG_LOG_DEFERRED_BUFFER_SIZE);
+
+    return (0);
+}
+
+static int test_benchmark(struct harness_t *harness_p)
+{
+    struct time_t start;
+    struct time_t stop;
+    struct time_t add;
+    struct time_t write;
+    int i;
+    int j;
+    char buf[64];
+
+    BTASSERT(log_set_default_handler_output_channel(NULL) == 0);
+
+    /* Add entries and write them to the queue handler. */
+    time_get(&start);
+
+    for (i = 0; i < 10000; i++) {
+        for (j = 0; j < 4; j++) {
+            log_object_print(&foo,
+                             LOG_INFO,
+                             FSTR("value %d: %s\r\n"),
+                             j,
+                             "benchmark");
+        }
+
+        BTASSERT(log_flush() == 0);
+
+        while (queue_size(&queue) > 0) {
+            BTASSERT(read_entry(&buf[0], sizeof(buf)) == 0);
+        }
+    }
+
+    time_get(&stop);
+    time_subtract(&write, &stop, &start);
+
+    /* Add entries and discard them, as there are no handlers. */
+    BTASSERT(log_remove_handler(&handler) == 0);
+    time_get(&start);
+
+    for (i = 0; i < 10000; i++) {
+        for (j = 0; j < 4; j++) {
+            log_object_print(&foo,
+                             LOG_INFO,
+                             FSTR("value %d: %s\r\n"),
+                             j,
+                             "benchmark");
+        }
+
+        BTASSERT(log_flush() == 0);
+    }
+
+    time_get(&stop);
+    time_subtract(&add, &stop, &start);
+    time_subtract(&write, &write, &add);
+
+    std_printf(OSTR("Adding an entry takes %lu ns, and formatting and "
+                    "writing it %lu ns.\r\n"),
+               (add.seconds * 1000000000ul + add.nanoseconds) / 40000,
+               (write.seconds * 1000000000ul + write.nanoseconds) / 40000);
+
+    BTASSERT(log_set_default_handler_output_channel(sys_get_stdout()) == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_init, "test_init" },
+        { test_print, "test_print" },
+        { test_print_isr, "test_print_isr" },
+        { test_log_thread, "test_log_thread" },
+        { test_overflow, "test_overflow" },
+        { test_benchmark, "test_benchmark" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
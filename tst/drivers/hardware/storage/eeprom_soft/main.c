@@ -37,6 +37,7 @@
 #    define CHUNK_SIZE                       0x100
 
 static uint8_t flash_buf[FLASH_SIZE];
+static size_t flash_write_size;
 
 #elif defined(FAMILY_SPC5)
 #    define DEVICE_INDEX                         1
@@ -223,13 +224,86 @@ static int test_mount_corrupt_data(struct harness_t *harness_p)
 
     BTASSERT(eeprom_soft_format(&eeprom_soft) == 0);
 
+    /* Corrupt the first record. */
     byte = 0x01;
     BTASSERT(flash_write(&flash,
                          FLASH_ADDRESS + 8,
                          &byte,
                          sizeof(byte)) == sizeof(byte));
 
-    BTASSERT(eeprom_soft_mount(&eeprom_soft) == -1);
+    /* The corrupt record is ignored. */
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &byte,
+                              0,
+                              sizeof(byte)) == sizeof(byte));
+    BTASSERTI(byte, ==, 0xff);
+
+    /* The block is compacted before writing. */
+    byte = 2;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               0,
+                               &byte,
+                               sizeof(byte)) == sizeof(byte));
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
+    byte = 0;
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &byte,
+                              0,
+                              sizeof(byte)) == sizeof(byte));
+    BTASSERTI(byte, ==, 2);
+
+    return (0);
+}
+
+static int test_write_compaction(struct harness_t *harness_p)
+{
+    int i;
+    uint8_t buf[4];
+
+    BTASSERT(eeprom_soft_format(&eeprom_soft) == 0);
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
+
+    buf[0] = 0x55;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               CHUNK_SIZE - 9,
+                               &buf[0],
+                               1) == 1);
+
+    /* Fill both blocks a few times. */
+    for (i = 0; i < 4 * FLASH_SIZE / 24; i++) {
+        buf[0] = i;
+        buf[1] = (i >> 8);
+        buf[2] = ~i;
+        buf[3] = ~(i >> 8);
+        BTASSERT(eeprom_soft_write(&eeprom_soft,
+                                   20,
+                                   &buf[0],
+                                   sizeof(buf)) == sizeof(buf));
+        BTASSERT(eeprom_soft_read(&eeprom_soft,
+                                  &buf[0],
+                                  20,
+                                  sizeof(buf)) == sizeof(buf));
+        BTASSERTI(buf[0], ==, (uint8_t)i);
+        BTASSERTI(buf[3], ==, (uint8_t)~(i >> 8));
+    }
+
+    /* The latest data is found after mount. */
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &buf[0],
+                              20,
+                              sizeof(buf)) == sizeof(buf));
+    i--;
+    BTASSERTI(buf[0], ==, (uint8_t)i);
+    BTASSERTI(buf[1], ==, (uint8_t)(i >> 8));
+    BTASSERTI(buf[2], ==, (uint8_t)~i);
+    BTASSERTI(buf[3], ==, (uint8_t)~(i >> 8));
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &buf[0],
+                              CHUNK_SIZE - 9,
+                              1) == 1);
+    BTASSERTI(buf[0], ==, 0x55);
 
     return (0);
 }
@@ -291,7 +365,7 @@ static int test_mount_after_write(struct harness_t *harness_p)
     return (0);
 }
 
-static int test_write_flash_read_fails_blank_chunk(struct harness_t *harness_p)
+static int test_write_flash_read_fails(struct harness_t *harness_p)
 {
     uint8_t byte;
     ssize_t res;
@@ -299,34 +373,101 @@ static int test_write_flash_read_fails_blank_chunk(struct harness_t *harness_p)
     BTASSERT(eeprom_soft_format(&eeprom_soft) == 0);
     BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
 
-    /* Flash read fails checking blank chunk. */
+    byte = 1;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               0,
+                               &byte,
+                               sizeof(byte)) == sizeof(byte));
+
+    /* Flash read fails reading the line. */
     res = -1;
     harness_mock_write("flash_read(): return (res)", &res, sizeof(res));
 
-    byte = 1;
+    byte = 2;
     BTASSERT(eeprom_soft_write(&eeprom_soft,
                                0,
                                &byte,
-                               sizeof(byte)) == sizeof(byte));
+                               sizeof(byte)) == -1);
+
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &byte,
+                              0,
+                              sizeof(byte)) == sizeof(byte));
+    BTASSERTI(byte, ==, 1);
 
     return (0);
 }
 
-static int test_write_blank_chunk_not_blank(struct harness_t *harness_p)
+static int test_write_size(struct harness_t *harness_p)
 {
-    uint8_t byte;
+    uint8_t buf[4];
 
     BTASSERT(eeprom_soft_format(&eeprom_soft) == 0);
     BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
 
-    /* Overwrite a byte in the first blank chunk. */
-    flash_buf[CHUNK_SIZE] = 0;
+    /* Only the modified line and its record header are written. */
+    memset(&buf[0], 0x12, sizeof(buf));
+    flash_write_size = 0;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               36,
+                               &buf[0],
+                               sizeof(buf)) == sizeof(buf));
+    BTASSERTI(flash_write_size, ==, 8 + CONFIG_EEPROM_SOFT_LINE_SIZE);
+
+    /* Unchanged data is not written. */
+    flash_write_size = 0;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               36,
+                               &buf[0],
+                               sizeof(buf)) == sizeof(buf));
+    BTASSERTI(flash_write_size, ==, 0);
+
+    return (0);
+}
+
+static int test_mount_torn_record(struct harness_t *harness_p)
+{
+    uint8_t byte;
+
+    BTASSERT(eeprom_soft_format(&eeprom_soft) == 0);
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
 
     byte = 1;
     BTASSERT(eeprom_soft_write(&eeprom_soft,
                                0,
                                &byte,
                                sizeof(byte)) == sizeof(byte));
+    byte = 2;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               0,
+                               &byte,
+                               sizeof(byte)) == sizeof(byte));
+
+    /* Corrupt the data of the second record, as if the write was
+       interrupted. */
+    flash_buf[8 + 24 + 8 + 3] = 0;
+
+    /* The previous value is found after mount. */
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &byte,
+                              0,
+                              sizeof(byte)) == sizeof(byte));
+    BTASSERTI(byte, ==, 1);
+
+    /* The block is compacted into the second block on write. */
+    byte = 3;
+    BTASSERT(eeprom_soft_write(&eeprom_soft,
+                               0,
+                               &byte,
+                               sizeof(byte)) == sizeof(byte));
+    BTASSERTI(flash_buf[FLASH_SIZE / 2 + 6], ==, 0xc4);
+    BTASSERT(eeprom_soft_mount(&eeprom_soft) == 0);
+    BTASSERT(eeprom_soft_read(&eeprom_soft,
+                              &byte,
+                              0,
+                              sizeof(byte)) == sizeof(byte));
+    BTASSERTI(byte, ==, 3);
 
     return (0);
 }
@@ -394,6 +535,7 @@ ssize_t __wrap_flash_write(struct flash_driver_t *self_p,
     BTASSERT(size <= CHUNK_SIZE);
 
     memcpy(&flash_buf[dst], src_p, size);
+    flash_write_size += size;
 
     return (size);
 }
@@ -433,16 +575,15 @@ int main()
         { test_read_write_low_high, "test_read_write_low_high" },
         { test_read_write_bad_address, "test_read_write_bad_address" },
         { test_mount_corrupt_data, "test_mount_corrupt_data" },
+        { test_write_compaction, "test_write_compaction" },
 #if defined(ARCH_LINUX)
         { test_mount_corrupt_header_valid, "test_mount_corrupt_header_valid" },
         { test_mount_corrupt_header_crc, "test_mount_corrupt_header_crc" },
         { test_mount_flash_read_fails, "test_mount_flash_read_fails" },
         { test_mount_after_write, "test_mount_after_write" },
-        {
-            test_write_flash_read_fails_blank_chunk,
-            "test_write_flash_read_fails_blank_chunk"
-        },
-        { test_write_blank_chunk_not_blank, "test_write_blank_chunk_not_blank" },
+        { test_write_flash_read_fails, "test_write_flash_read_fails" },
+        { test_write_size, "test_write_size" },
+        { test_mount_torn_record, "test_mount_torn_record" },
         { test_format_flash_erase_fails, "test_format_flash_erase_fails" },
 #endif
         { NULL, NULL }
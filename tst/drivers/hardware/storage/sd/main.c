@@ -275,6 +275,40 @@ static int test_read_write(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_read_write_blocks(struct harness_t *harness_p)
+{
+    int i, block, res;
+    static uint8_t blocks[4][SD_BLOCK_SIZE];
+
+    /* Write four blocks in one transfer and read them back, both in
+       one transfer and block by block. */
+    for (block = 0; block < membersof(blocks); block++) {
+        for (i = 0; i < SD_BLOCK_SIZE; i++) {
+            blocks[block][i] = ((3 * block + i) & 0xff);
+        }
+    }
+
+    BTASSERT((res = sd_write_blocks(&sd, 5, &blocks[0][0], 4))
+             == 4 * SD_BLOCK_SIZE,
+             ", res = %d\r\n", res);
+    memset(&blocks[0][0], 0, sizeof(blocks));
+    BTASSERT((res = sd_read_blocks(&sd, &blocks[0][0], 5, 4))
+             == 4 * SD_BLOCK_SIZE,
+             ", res = %d\r\n", res);
+
+    for (block = 0; block < membersof(blocks); block++) {
+        for (i = 0; i < SD_BLOCK_SIZE; i++) {
+            BTASSERT(blocks[block][i] == ((3 * block + i) & 0xff));
+        }
+
+        BTASSERT((res = sd_read_block(&sd, buf, 5 + block)) == SD_BLOCK_SIZE,
+                 ", res = %d\r\n", res);
+        BTASSERT(memcmp(buf, &blocks[block][0], SD_BLOCK_SIZE) == 0);
+    }
+
+    return (0);
+}
+
 static int test_write_performance(struct harness_t *harness_p)
 {
     int i, block, res;
@@ -353,6 +387,7 @@ int main()
         { test_read_cid, "test_read_cid" },
         { test_read_csd, "test_read_csd" },
         { test_read_write, "test_read_write" },
+        { test_read_write_blocks, "test_read_write_blocks" },
         { test_write_performance, "test_write_performance" },
         { test_read_performance, "test_read_performance" },
         { NULL, NULL }
@@ -0,0 +1,504 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#define BLOCKS_MAX                                         16
+
+/* Same layout as the command written by the driver. */
+struct command_t {
+    uint8_t index;
+    uint32_t arg;
+    uint8_t crc;
+};
+
+/* A minimal SDHC card emulated on the SPI byte level. */
+static struct {
+    uint8_t blocks[BLOCKS_MAX][SD_BLOCK_SIZE];
+    struct {
+        uint8_t buf[SD_BLOCK_SIZE + 8];
+        size_t pos;
+        size_t size;
+    } output;
+    int application_command;
+    struct {
+        int active;
+        int single;
+        int gap;
+        uint32_t block;
+        int count;
+        int fail_index;
+        int stops;
+    } read;
+    struct {
+        int active;
+        int single;
+        int receiving;
+        uint32_t block;
+        int count;
+        int fail_index;
+        int stops;
+        uint8_t buf[SD_BLOCK_SIZE + 2];
+        size_t size;
+    } write;
+} card;
+
+static struct spi_driver_t spi;
+static struct sd_driver_t sd;
+
+static uint8_t buf[4][SD_BLOCK_SIZE];
+
+static void card_output_set(const uint8_t *buf_p, size_t size)
+{
+    memcpy(&card.output.buf[0], buf_p, size);
+    card.output.pos = 0;
+    card.output.size = size;
+}
+
+static void card_output_block(void)
+{
+    uint16_t crc;
+
+    crc = crc_xmodem(0, &card.blocks[card.read.block][0], SD_BLOCK_SIZE);
+
+    /* Corrupt the checksum of the block to fail. */
+    if (card.read.count == card.read.fail_index) {
+        crc ^= 1;
+    }
+
+    card.output.buf[0] = 0xfe;
+    memcpy(&card.output.buf[1],
+           &card.blocks[card.read.block][0],
+           SD_BLOCK_SIZE);
+    card.output.buf[SD_BLOCK_SIZE + 1] = (crc >> 8);
+    card.output.buf[SD_BLOCK_SIZE + 2] = crc;
+    card.output.pos = 0;
+    card.output.size = (SD_BLOCK_SIZE + 3);
+
+    card.read.block++;
+    card.read.count++;
+
+    if (card.read.single || (card.read.block == BLOCKS_MAX)) {
+        card.read.active = 0;
+    }
+}
+
+static uint8_t card_get(void)
+{
+    if (card.output.pos < card.output.size) {
+        return (card.output.buf[card.output.pos++]);
+    }
+
+    /* Stream data blocks with one idle byte between them. */
+    if (card.read.active) {
+        if (!card.read.gap) {
+            card.read.gap = 1;
+
+            return (0xff);
+        }
+
+        card.read.gap = 0;
+        card_output_block();
+
+        return (card.output.buf[card.output.pos++]);
+    }
+
+    return (0xff);
+}
+
+static void card_block_received(void)
+{
+    uint8_t response[3];
+    uint16_t crc;
+
+    crc = ((card.write.buf[SD_BLOCK_SIZE] << 8)
+           | card.write.buf[SD_BLOCK_SIZE + 1]);
+
+    if (crc != crc_xmodem(0, &card.write.buf[0], SD_BLOCK_SIZE)) {
+        response[0] = 0x0b;
+    } else if (card.write.count == card.write.fail_index) {
+        response[0] = 0x0d;
+    } else {
+        memcpy(&card.blocks[card.write.block][0],
+               &card.write.buf[0],
+               SD_BLOCK_SIZE);
+        card.write.block++;
+        response[0] = 0x05;
+    }
+
+    /* Data response token followed by two busy bytes. */
+    response[1] = 0x00;
+    response[2] = 0x00;
+    card_output_set(&response[0], sizeof(response));
+
+    card.write.count++;
+    card.write.receiving = 0;
+
+    if (card.write.single) {
+        card.write.active = 0;
+    }
+}
+
+static void card_command(const struct command_t *command_p)
+{
+    static const uint8_t if_cond[] = { 0x01, 0x00, 0x00, 0x01, 0xaa };
+    static const uint8_t ocr[] = { 0x00, 0xc0, 0xff, 0x80, 0x00 };
+    static const uint8_t status[] = { 0x00, 0x00 };
+    static const uint8_t stop[] = { 0xff, 0x00 };
+    uint8_t response;
+    uint32_t arg;
+    int application_command;
+
+    arg = ntohl(command_p->arg);
+    application_command = card.application_command;
+    card.application_command = 0;
+    response = 0x00;
+
+    switch (command_p->index & 0x3f) {
+
+    case 0:
+    case 59:
+        response = 0x01;
+        break;
+
+    case 8:
+        card_output_set(&if_cond[0], sizeof(if_cond));
+        return;
+
+    case 55:
+        card.application_command = 1;
+        response = 0x01;
+        break;
+
+    case 41:
+        if (!application_command) {
+            response = 0x04;
+        }
+
+        break;
+
+    case 58:
+        card_output_set(&ocr[0], sizeof(ocr));
+        return;
+
+    case 13:
+        card_output_set(&status[0], sizeof(status));
+        return;
+
+    case 12:
+        card.read.active = 0;
+        card.read.stops++;
+        card_output_set(&stop[0], sizeof(stop));
+        return;
+
+    case 17:
+    case 18:
+        if (arg >= BLOCKS_MAX) {
+            response = 0x20;
+            break;
+        }
+
+        card.read.active = 1;
+        card.read.single = ((command_p->index & 0x3f) == 17);
+        card.read.gap = 0;
+        card.read.block = arg;
+        card.read.count = 0;
+        break;
+
+    case 24:
+    case 25:
+        if (arg >= BLOCKS_MAX) {
+            response = 0x20;
+            break;
+        }
+
+        card.write.active = 1;
+        card.write.single = ((command_p->index & 0x3f) == 24);
+        card.write.receiving = 0;
+        card.write.block = arg;
+        card.write.count = 0;
+        break;
+
+    default:
+        response = 0x04;
+        break;
+    }
+
+    card_output_set(&response, sizeof(response));
+}
+
+static void card_put(const uint8_t *buf_p, size_t size)
+{
+    static const uint8_t stop[] = { 0xff, 0x00, 0x00 };
+    struct command_t command;
+    size_t left;
+
+    if (card.write.receiving) {
+        left = (sizeof(card.write.buf) - card.write.size);
+
+        if (size > left) {
+            size = left;
+        }
+
+        memcpy(&card.write.buf[card.write.size], buf_p, size);
+        card.write.size += size;
+
+        if (card.write.size == sizeof(card.write.buf)) {
+            card_block_received();
+        }
+    } else if (card.write.active) {
+        if ((buf_p[0] == 0xfe) || (buf_p[0] == 0xfc)) {
+            card.write.receiving = 1;
+            card.write.size = 0;
+        } else if (buf_p[0] == 0xfd) {
+            card.write.active = 0;
+            card.write.stops++;
+            card_output_set(&stop[0], sizeof(stop));
+        }
+    } else if ((size == sizeof(command))
+               && ((buf_p[0] & 0xc0) == 0x40)) {
+        memcpy(&command, buf_p, sizeof(command));
+        card_command(&command);
+    }
+}
+
+static void card_reset(void)
+{
+    memset(&card, 0, sizeof(card));
+    card.read.fail_index = -1;
+    card.write.fail_index = -1;
+}
+
+static void fill(uint8_t *buf_p, int count, int seed)
+{
+    int i;
+
+    for (i = 0; i < count * SD_BLOCK_SIZE; i++) {
+        buf_p[i] = (seed + i + i / SD_BLOCK_SIZE);
+    }
+}
+
+static int test_init(struct harness_t *harness_p)
+{
+    card_reset();
+
+    BTASSERT(sd_init(&sd, &spi) == 0);
+    BTASSERT(sd_start(&sd) == 0);
+
+    return (0);
+}
+
+static int test_read_write_blocks(struct harness_t *harness_p)
+{
+    uint8_t expected[4][SD_BLOCK_SIZE];
+
+    /* Write four blocks in one transfer. */
+    fill(&expected[0][0], 4, 0);
+    BTASSERT(sd_write_blocks(&sd, 2, &expected[0][0], 4)
+             == 4 * SD_BLOCK_SIZE);
+    BTASSERT(card.write.count == 4);
+    BTASSERT(card.write.stops == 1);
+    BTASSERT(memcmp(&card.blocks[2][0],
+                    &expected[0][0],
+                    sizeof(expected)) == 0);
+
+    /* Read them back in one transfer. */
+    memset(&buf[0][0], 0, sizeof(buf));
+    BTASSERT(sd_read_blocks(&sd, &buf[0][0], 2, 4) == 4 * SD_BLOCK_SIZE);
+    BTASSERT(card.read.count == 4);
+    BTASSERT(card.read.stops == 1);
+    BTASSERT(memcmp(&buf[0][0], &expected[0][0], sizeof(buf)) == 0);
+
+    /* The single block functions see the same data. */
+    BTASSERT(sd_read_block(&sd, &buf[0][0], 4) == SD_BLOCK_SIZE);
+    BTASSERT(memcmp(&buf[0][0], &expected[2][0], SD_BLOCK_SIZE) == 0);
+    fill(&buf[0][0], 1, 100);
+    BTASSERT(sd_write_block(&sd, 3, &buf[0][0]) == SD_BLOCK_SIZE);
+    BTASSERT(sd_read_blocks(&sd, &buf[1][0], 3, 1) == SD_BLOCK_SIZE);
+    BTASSERT(memcmp(&buf[1][0], &buf[0][0], SD_BLOCK_SIZE) == 0);
+
+    /* Nothing is transferred for zero blocks. */
+    BTASSERT(sd_read_blocks(&sd, &buf[0][0], 0, 0) == 0);
+    BTASSERT(sd_write_blocks(&sd, 0, &buf[0][0], 0) == 0);
+    BTASSERT(card.read.stops == 2);
+    BTASSERT(card.write.stops == 1);
+
+    return (0);
+}
+
+static int test_read_blocks_error(struct harness_t *harness_p)
+{
+    uint8_t expected[4][SD_BLOCK_SIZE];
+    int res;
+
+    fill(&expected[0][0], 4, 50);
+    memcpy(&card.blocks[8][0], &expected[0][0], sizeof(expected));
+    card.read.stops = 0;
+
+    /* Wrong checksum of the third block. The transmission must still
+       be stopped. */
+    card.read.fail_index = 2;
+    memset(&buf[0][0], 0, sizeof(buf));
+    res = sd_read_blocks(&sd, &buf[0][0], 8, 4);
+    BTASSERTI(res, ==, -SD_ERR_READ_WRONG_DATA_CRC);
+    BTASSERT(card.read.count == 3);
+    BTASSERT(card.read.stops == 1);
+    BTASSERT(card.read.active == 0);
+    BTASSERT(memcmp(&buf[0][0], &expected[0][0], 2 * SD_BLOCK_SIZE) == 0);
+
+    /* The card is usable after the failure. */
+    card.read.fail_index = -1;
+    BTASSERT(sd_read_blocks(&sd, &buf[0][0], 8, 4) == 4 * SD_BLOCK_SIZE);
+    BTASSERT(memcmp(&buf[0][0], &expected[0][0], sizeof(buf)) == 0);
+    BTASSERT(card.read.stops == 2);
+
+    /* Read command rejected by the card. */
+    res = sd_read_blocks(&sd, &buf[0][0], BLOCKS_MAX, 2);
+    BTASSERTI(res, ==, -SD_ERR_READ_COMMAND);
+
+    return (0);
+}
+
+static int test_write_blocks_error(struct harness_t *harness_p)
+{
+    uint8_t zeros[3][SD_BLOCK_SIZE];
+    int res;
+
+    memset(&card.blocks[12][0], 0, 4 * SD_BLOCK_SIZE);
+    memset(&zeros[0][0], 0, sizeof(zeros));
+    card.write.stops = 0;
+
+    /* The second block is rejected. The transmission must still be
+       stopped and the following blocks not written. */
+    card.write.fail_index = 1;
+    fill(&buf[0][0], 4, 200);
+    res = sd_write_blocks(&sd, 12, &buf[0][0], 4);
+    BTASSERTI(res, ==, -SD_ERR_WRITE_BLOCK_TOKEN_DATA_RES_ACCEPTED);
+    BTASSERT(card.write.count == 2);
+    BTASSERT(card.write.stops == 1);
+    BTASSERT(card.write.active == 0);
+    BTASSERT(memcmp(&card.blocks[12][0], &buf[0][0], SD_BLOCK_SIZE) == 0);
+    BTASSERT(memcmp(&card.blocks[13][0], &zeros[0][0], sizeof(zeros)) == 0);
+
+    /* The card is usable after the failure. */
+    card.write.fail_index = -1;
+    BTASSERT(sd_write_blocks(&sd, 12, &buf[0][0], 4) == 4 * SD_BLOCK_SIZE);
+    BTASSERT(memcmp(&card.blocks[12][0], &buf[0][0], sizeof(buf)) == 0);
+    BTASSERT(card.write.stops == 2);
+
+    /* Write command rejected by the card. */
+    res = sd_write_blocks(&sd, BLOCKS_MAX, &buf[0][0], 2);
+    BTASSERTI(res, ==, -SD_ERR_WRITE_BLOCK);
+
+    return (0);
+}
+
+int STUB(spi_start)(struct spi_driver_t *self_p)
+{
+    return (0);
+}
+
+int STUB(spi_take_bus)(struct spi_driver_t *self_p)
+{
+    return (0);
+}
+
+int STUB(spi_give_bus)(struct spi_driver_t *self_p)
+{
+    return (0);
+}
+
+int STUB(spi_select)(struct spi_driver_t *self_p)
+{
+    return (0);
+}
+
+int STUB(spi_deselect)(struct spi_driver_t *self_p)
+{
+    return (0);
+}
+
+ssize_t STUB(spi_read)(struct spi_driver_t *self_p,
+                       void *buf_p,
+                       size_t size)
+{
+    uint8_t *u8buf_p;
+    size_t i;
+
+    u8buf_p = buf_p;
+
+    for (i = 0; i < size; i++) {
+        u8buf_p[i] = card_get();
+    }
+
+    return (size);
+}
+
+ssize_t STUB(spi_write)(struct spi_driver_t *self_p,
+                        const void *buf_p,
+                        size_t size)
+{
+    card_put(buf_p, size);
+
+    return (size);
+}
+
+ssize_t STUB(spi_get)(struct spi_driver_t *self_p, uint8_t *data_p)
+{
+    *data_p = card_get();
+
+    return (1);
+}
+
+ssize_t STUB(spi_put)(struct spi_driver_t *self_p, uint8_t data)
+{
+    card_put(&data, 1);
+
+    return (1);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_init, "test_init" },
+        { test_read_write_blocks, "test_read_write_blocks" },
+        { test_read_blocks_error, "test_read_blocks_error" },
+        { test_write_blocks_error, "test_write_blocks_error" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
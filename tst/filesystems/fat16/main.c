@@ -37,8 +37,13 @@ static struct sd_driver_t sd;
 
 static struct fat16_t fs;
 
+#define BENCHMARK_FILE_SIZE                             65536
+#define BENCHMARK_CHUNK_SIZE                              100
+
 #if defined(ARCH_LINUX)
 static FILE *file_p = NULL;
+static long number_of_block_reads = 0;
+static long number_of_block_writes = 0;
 
 static ssize_t linux_read_block(void *arg_p,
                                 void *dst_p,
@@ -46,6 +51,8 @@ static ssize_t linux_read_block(void *arg_p,
 {
     size_t block_start;
 
+    number_of_block_reads++;
+
     /* Find given block. */
     block_start = (SD_BLOCK_SIZE * src_block);
 
@@ -62,6 +69,8 @@ static ssize_t linux_write_block(void *arg_p,
 {
     size_t block_start;
 
+    number_of_block_writes++;
+
     /* Find given block. */
     block_start = (SD_BLOCK_SIZE * dst_block);
 
@@ -77,6 +86,44 @@ static ssize_t linux_write_block(void *arg_p,
 
     return (SD_BLOCK_SIZE);
 }
+
+static long number_of_multi_block_reads = 0;
+static long number_of_multi_block_writes = 0;
+
+static ssize_t linux_read_blocks(void *arg_p,
+                                 void *dst_p,
+                                 uint32_t src_block,
+                                 size_t count)
+{
+    number_of_multi_block_reads++;
+
+    if (fseek(arg_p, SD_BLOCK_SIZE * src_block, SEEK_SET) != 0) {
+        return (-1);
+    }
+
+    return (fread(dst_p, 1, SD_BLOCK_SIZE * count, arg_p));
+}
+
+static ssize_t linux_write_blocks(void *arg_p,
+                                  uint32_t dst_block,
+                                  const void *src_p,
+                                  size_t count)
+{
+    number_of_multi_block_writes++;
+
+    if (fseek(arg_p, SD_BLOCK_SIZE * dst_block, SEEK_SET) != 0) {
+        return (-1);
+    }
+
+    if (fwrite(src_p, 1, SD_BLOCK_SIZE * count, arg_p)
+        != SD_BLOCK_SIZE * count) {
+        return (-1);
+    }
+
+    fflush(file_p);
+
+    return (SD_BLOCK_SIZE * count);
+}
 #endif
 
 int test_init(struct harness_t *harness_p)
@@ -439,6 +486,343 @@ static int test_seek(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_preallocate(struct harness_t *harness_p)
+{
+    struct fat16_file_t foo;
+    size_t cluster_size;
+    fat_t first_cluster;
+    char buf[128];
+    int i;
+
+    cluster_size = (512 * fs.blocks_per_cluster);
+
+    /* Preallocate five clusters in an empty file. */
+    BTASSERT(fat16_file_open(&fs,
+                             &foo,
+                             "PRE.TXT",
+                             O_CREAT | O_RDWR | O_SYNC | O_TRUNC) == 0);
+    BTASSERT(fat16_file_preallocate(&foo, 5 * cluster_size) == 0);
+    BTASSERT(fat16_file_size(&foo) == 0);
+    first_cluster = foo.first_cluster;
+    BTASSERT(first_cluster != 0);
+
+    /* Preallocating less than already allocated is a no-op. */
+    BTASSERT(fat16_file_preallocate(&foo, 2 * cluster_size) == 0);
+    BTASSERT(foo.first_cluster == first_cluster);
+
+    /* Preallocating more than the volume size fails. */
+    BTASSERT(fat16_file_preallocate(&foo, 0x7fffffff) == -1);
+
+    /* Fill the preallocated clusters. */
+    for (i = 0; i < 5 * cluster_size; i += sizeof(buf)) {
+        memset(&buf[0], (char)(i / cluster_size), sizeof(buf));
+        BTASSERT(fat16_file_write(&foo,
+                                  &buf[0],
+                                  sizeof(buf)) == sizeof(buf));
+    }
+
+    BTASSERT(fat16_file_size(&foo) == 5 * cluster_size);
+    BTASSERT(foo.first_cluster == first_cluster);
+
+    /* The clusters are contiguous. */
+    for (i = 0; i < 5; i++) {
+        BTASSERT(fat16_file_seek(&foo,
+                                 i * cluster_size + 1,
+                                 FAT16_SEEK_SET) == 0);
+        BTASSERT(foo.cur_cluster == first_cluster + i);
+        BTASSERT(fat16_file_read(&foo, &buf[0], 1) == 1);
+        BTASSERT(buf[0] == i);
+    }
+
+    /* Extend the file by preallocating. The extent directly follows
+       the last cluster since it is free. */
+    BTASSERT(fat16_file_preallocate(&foo, 7 * cluster_size) == 0);
+    BTASSERT(fat16_file_size(&foo) == 5 * cluster_size);
+    BTASSERT(fat16_file_seek(&foo, 0, FAT16_SEEK_END) == 0);
+    BTASSERT(fat16_file_write(&foo, "a", 1) == 1);
+    BTASSERT(foo.cur_cluster == first_cluster + 5);
+
+    /* Truncate releases the unused preallocated clusters. */
+    BTASSERT(fat16_file_truncate(&foo, 2 * cluster_size) == 0);
+    BTASSERT(fat16_file_size(&foo) == 2 * cluster_size);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    /* The released clusters are allocated by the next file. */
+    BTASSERT(fat16_file_open(&fs,
+                             &foo,
+                             "PRE2.TXT",
+                             O_CREAT | O_RDWR | O_SYNC | O_TRUNC) == 0);
+    BTASSERT(fat16_file_preallocate(&foo, 5 * cluster_size) == 0);
+    BTASSERT(foo.first_cluster == first_cluster + 2);
+    BTASSERT(fat16_file_truncate(&foo, 0) == 0);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    /* Preallocated clusters in an empty file are released on
+       truncate. */
+    BTASSERT(fat16_file_open(&fs, &foo, "PRE2.TXT", O_RDWR) == 0);
+    BTASSERT(foo.first_cluster == 0);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    BTASSERT(fat16_file_open(&fs, &foo, "PRE.TXT", O_READ) == 0);
+    BTASSERT(fat16_file_size(&foo) == 2 * cluster_size);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    return (0);
+}
+
+static int test_free_cluster_bitmap(struct harness_t *harness_p)
+{
+    struct fat16_file_t foo;
+    size_t cluster_size;
+    size_t size;
+    fat_t first_cluster;
+    char buf[512];
+    size_t i;
+
+    cluster_size = (512 * fs.blocks_per_cluster);
+
+    /* The suite is built with a bitmap that only covers the first
+       clusters of the volume. Allocate clusters on both sides of
+       it. */
+    size = ((8 * CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE + 64)
+            * cluster_size);
+    BTASSERT(fs.cluster_count > 8 * CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE);
+
+    BTASSERT(fat16_file_open(&fs,
+                             &foo,
+                             "BITMAP.TXT",
+                             O_CREAT | O_RDWR | O_SYNC | O_TRUNC) == 0);
+    BTASSERT(fat16_file_preallocate(&foo, size) == 0);
+    first_cluster = foo.first_cluster;
+    BTASSERT(fat16_file_truncate(&foo, 0) == 0);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    /* The bitmap is rebuilt when mounted, and the released clusters
+       are found free both in and after it. */
+    BTASSERT(fat16_unmount(&fs) == 0);
+    BTASSERT(fat16_mount(&fs) == 0);
+
+    BTASSERT(fat16_file_open(&fs, &foo, "BITMAP.TXT", O_RDWR) == 0);
+    BTASSERT(fat16_file_preallocate(&foo, size) == 0);
+    BTASSERT(foo.first_cluster == first_cluster);
+
+    /* Fill the file to reach its last cluster. */
+    memset(&buf[0], 0, sizeof(buf));
+
+    for (i = 0; i < size; i += sizeof(buf)) {
+        BTASSERT(fat16_file_write(&foo,
+                                  &buf[0],
+                                  sizeof(buf)) == sizeof(buf));
+    }
+
+    BTASSERT(foo.first_cluster == first_cluster);
+    BTASSERT(foo.cur_cluster
+             > 8 * CONFIG_FAT16_FREE_CLUSTER_BITMAP_SIZE + 1);
+    BTASSERT(fat16_file_truncate(&foo, 0) == 0);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    return (0);
+}
+
+static int test_multi_block(struct harness_t *harness_p)
+{
+#if defined(ARCH_LINUX)
+    struct fat16_file_t foo;
+    static char buf[8192];
+    static char buf2[2 * 8192];
+    size_t cluster_size;
+    fat_t first_cluster;
+    fat_t last_cluster;
+    int i;
+
+    cluster_size = (512 * fs.blocks_per_cluster);
+
+    for (i = 0; i < sizeof(buf); i++) {
+        buf[i] = (char)(i / 7);
+    }
+
+    BTASSERT(fat16_set_multi_block_callbacks(&fs,
+                                             linux_read_blocks,
+                                             linux_write_blocks) == 0);
+
+    /* Write 8 kB in one call to a new file. All blocks are written
+       in a single transfer as the clusters are allocated
+       contiguously. */
+    BTASSERT(fat16_file_open(&fs,
+                             &foo,
+                             "MULTI.TXT",
+                             O_CREAT | O_RDWR | O_TRUNC) == 0);
+    number_of_multi_block_writes = 0;
+    number_of_block_writes = 0;
+    BTASSERT(fat16_file_write(&foo, &buf[0], sizeof(buf)) == sizeof(buf));
+    BTASSERT(number_of_multi_block_writes == 1);
+    BTASSERT(number_of_block_writes == 0);
+    first_cluster = foo.first_cluster;
+    last_cluster = (first_cluster + sizeof(buf) / cluster_size - 1);
+    BTASSERT(foo.cur_cluster == last_cluster);
+
+    /* Unaligned write through the cache, followed by an aligned
+       write of whole blocks. */
+    BTASSERT(fat16_file_seek(&foo, 100, FAT16_SEEK_SET) == 0);
+    BTASSERT(fat16_file_write(&foo, "hello", 5) == 5);
+    BTASSERT(fat16_file_seek(&foo, 512, FAT16_SEEK_SET) == 0);
+    BTASSERT(fat16_file_write(&foo, &buf[0], 1024) == 1024);
+    memcpy(&buf[512], &buf[0], 1024);
+    memcpy(&buf[100], "hello", 5);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    /* Read it back, first unaligned and then whole blocks. The
+       cached block is not read again. */
+    number_of_multi_block_reads = 0;
+    BTASSERT(fat16_file_open(&fs, &foo, "MULTI.TXT", O_READ) == 0);
+    BTASSERT(fat16_file_read(&foo, &buf2[0], 1) == 1);
+    BTASSERT(fat16_file_read(&foo, &buf2[1], 511) == 511);
+    BTASSERT(fat16_file_read(&foo, &buf2[512], sizeof(buf) - 512)
+             == sizeof(buf) - 512);
+    BTASSERT(number_of_multi_block_reads == 1);
+    BTASSERT(memcmp(&buf[0], &buf2[0], sizeof(buf)) == 0);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    /* Fragment the file by allocating the cluster after its last
+       cluster to another file. A read is split into one transfer per
+       contiguous cluster run. */
+    BTASSERT(fat16_file_open(&fs,
+                             &foo,
+                             "FRAG.TXT",
+                             O_CREAT | O_RDWR | O_TRUNC) == 0);
+
+    /* Allocate clusters until the one after the last cluster of
+       MULTI.TXT is used. */
+    for (i = 0; i < 64; i++) {
+        BTASSERT(fat16_file_write(&foo, &buf[0], cluster_size)
+                 == cluster_size);
+
+        if (foo.cur_cluster >= last_cluster + 1) {
+            break;
+        }
+    }
+
+    BTASSERT(foo.cur_cluster == last_cluster + 1);
+    BTASSERT(fat16_file_close(&foo) == 0);
+    number_of_multi_block_writes = 0;
+    BTASSERT(fat16_file_open(&fs,
+                             &foo,
+                             "MULTI.TXT",
+                             O_WRITE | O_APPEND) == 0);
+    BTASSERT(fat16_file_write(&foo, &buf[0], sizeof(buf)) == sizeof(buf));
+    BTASSERT(number_of_multi_block_writes == 1);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    number_of_multi_block_reads = 0;
+    BTASSERT(fat16_file_open(&fs, &foo, "MULTI.TXT", O_READ) == 0);
+    BTASSERT(fat16_file_size(&foo) == sizeof(buf2));
+    BTASSERT(fat16_file_read(&foo, &buf2[0], sizeof(buf2))
+             == sizeof(buf2));
+    BTASSERT(number_of_multi_block_reads == 2);
+    BTASSERT(memcmp(&buf[0], &buf2[0], sizeof(buf)) == 0);
+    BTASSERT(memcmp(&buf[0], &buf2[sizeof(buf)], sizeof(buf)) == 0);
+    BTASSERT(fat16_file_close(&foo) == 0);
+
+    BTASSERT(fat16_set_multi_block_callbacks(&fs, NULL, NULL) == 0);
+
+    return (0);
+#else
+    return (1);
+#endif
+}
+
+static void benchmark_print(const char *operation_p,
+                            struct time_t *start_p)
+{
+    struct time_t stop;
+    struct time_t diff;
+
+    time_get(&stop);
+    time_subtract(&diff, &stop, start_p);
+
+    std_printf(FSTR("%s: %d bytes in %ld us"),
+               operation_p,
+               BENCHMARK_FILE_SIZE,
+               (long)(diff.seconds * 1000000L + diff.nanoseconds / 1000L));
+#if defined(ARCH_LINUX)
+    std_printf(FSTR(", %ld block reads, %ld block writes"),
+               number_of_block_reads,
+               number_of_block_writes);
+#endif
+    std_printf(FSTR(" (%d cache blocks)\r\n"), CONFIG_FAT16_CACHE_BLOCKS);
+}
+
+static int test_benchmark(struct harness_t *harness_p)
+{
+    struct fat16_file_t file;
+    char buf[BENCHMARK_CHUNK_SIZE];
+    struct time_t start;
+    size_t position;
+    size_t size;
+    size_t i;
+
+#if defined(ARCH_LINUX)
+    number_of_block_reads = 0;
+    number_of_block_writes = 0;
+#endif
+
+    time_get(&start);
+
+    /* Sequential write in chunks that are not aligned to blocks. */
+    BTASSERT(fat16_file_open(&fs,
+                             &file,
+                             "BENCH.TXT",
+                             O_CREAT | O_WRITE | O_TRUNC) == 0);
+
+    for (position = 0; position < BENCHMARK_FILE_SIZE; position += size) {
+        size = MIN(sizeof(buf), BENCHMARK_FILE_SIZE - position);
+
+        for (i = 0; i < size; i++) {
+            buf[i] = (char)((position + i) + ((position + i) >> 9));
+        }
+
+        BTASSERT(fat16_file_write(&file, &buf[0], size) == size);
+    }
+
+    BTASSERT(fat16_file_close(&file) == 0);
+    benchmark_print("write", &start);
+
+#if defined(ARCH_LINUX) && (CONFIG_FAT16_CACHE_BLOCKS >= 4)
+    /* Each data block is written once, and FAT blocks only when
+       flushed. */
+    BTASSERT(number_of_block_writes < (BENCHMARK_FILE_SIZE / 512) + 16);
+#endif
+
+#if defined(ARCH_LINUX)
+    number_of_block_reads = 0;
+    number_of_block_writes = 0;
+#endif
+
+    time_get(&start);
+
+    /* Sequential read. */
+    BTASSERT(fat16_file_open(&fs, &file, "BENCH.TXT", O_READ) == 0);
+
+    for (position = 0; position < BENCHMARK_FILE_SIZE; position += size) {
+        size = MIN(sizeof(buf), BENCHMARK_FILE_SIZE - position);
+        BTASSERT(fat16_file_read(&file, &buf[0], size) == size);
+
+        for (i = 0; i < size; i++) {
+            BTASSERT(buf[i] == (char)((position + i)
+                                      + ((position + i) >> 9)));
+        }
+    }
+
+    BTASSERT(fat16_file_close(&file) == 0);
+    benchmark_print("read", &start);
+
+#if defined(ARCH_LINUX) && (CONFIG_FAT16_CACHE_BLOCKS >= 4)
+    BTASSERT(number_of_block_reads < (BENCHMARK_FILE_SIZE / 512) + 16);
+#endif
+
+    return (0);
+}
+
 static int test_unmount(struct harness_t *harness_p)
 {
     BTASSERT(fat16_unmount(&fs) == 0);
@@ -466,6 +850,10 @@ int main()
         { test_truncate, "test_truncate" },
         { test_append, "test_append" },
         { test_seek, "test_seek" },
+        { test_preallocate, "test_preallocate" },
+        { test_free_cluster_bitmap, "test_free_cluster_bitmap" },
+        { test_multi_block, "test_multi_block" },
+        { test_benchmark, "test_benchmark" },
         { test_unmount, "test_unmount" },
         { NULL, NULL }
     };
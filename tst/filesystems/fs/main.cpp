@@ -522,6 +522,7 @@ static int test_filesystem_spiffs(struct harness_t *harness_p)
     struct fs_stat_t stat;
     struct fs_dir_t dir;
     struct fs_dir_entry_t entry;
+    uint32_t generation;
 
     /* Initiate the config struct. */
     config.hal_read_f = filesystem_spiffs_read;
@@ -567,15 +568,28 @@ static int test_filesystem_spiffs(struct harness_t *harness_p)
                                        &configfs) == 0);
     BTASSERT(fs_filesystem_register(&spiffsfs) == 0);
 
-    /* Perform file operations. */
+    /* Perform file operations. Modifications increment the
+       generation. */
+    generation = fs_get_generation();
     BTASSERT(fs_open(&file, "/spiffsfs/foo.txt", FS_CREAT | FS_RDWR | FS_SYNC) == 0);
     BTASSERT(fs_write(&file, "hello!", 6) == 6);
+    BTASSERT(fs_get_generation() != generation);
     BTASSERT(fs_seek(&file, 0, FS_SEEK_SET) == 0);
     BTASSERT(fs_read(&file, buf, 6) == 6);
     BTASSERT(fs_read(&file, buf, 1) == 0);
     BTASSERT(memcmp(buf, "hello!", 6) == 0);
     BTASSERT(fs_tell(&file) == 6);
+    generation = fs_get_generation();
+    BTASSERT(fs_close(&file) == 0);
+    BTASSERT(fs_get_generation() != generation);
+
+    /* Reading and failed writes do not modify the file. */
+    BTASSERT(fs_open(&file, "/spiffsfs/foo.txt", FS_READ) == 0);
+    BTASSERT(fs_read(&file, buf, 6) == 6);
+    generation = fs_get_generation();
+    BTASSERT(fs_write(&file, "hello!", 6) < 0);
     BTASSERT(fs_close(&file) == 0);
+    BTASSERT(fs_get_generation() == generation);
 
     /* Stat the file foo.txt. */
     BTASSERT(fs_stat("/spiffsfs/foo.txt", &stat) == 0);
@@ -597,7 +611,9 @@ static int test_filesystem_spiffs(struct harness_t *harness_p)
     BTASSERT(fs_dir_close(&dir) == 0);
 
     /* Remove the file 'foo.txt'. */
+    generation = fs_get_generation();
     BTASSERT(fs_remove("/spiffsfs/foo.txt") == 0);
+    BTASSERT(fs_get_generation() != generation);
 
     return (0);
 
@@ -30,6 +30,13 @@
 
 #include "simba.h"
 
+/* RAM backed SPIFFS file system for the static files. */
+#define PHY_SIZE                                       0x10000
+#define PHY_ADDR                                             0
+#define PHYS_ERASE_BLOCK                                  4096
+#define LOG_BLOCK_SIZE                                    4096
+#define LOG_PAGE_SIZE                                      256
+
 extern int ssl_open_counter;
 extern int ssl_close_counter;
 extern int ssl_write_counter;
@@ -43,6 +50,8 @@ extern void socket_stub_input_flush(void);
 extern void socket_stub_output(void *buf_p, size_t size);
 extern void socket_stub_wait_closed(void);
 extern void socket_stub_close_connection(void);
+extern int socket_stub_read_counter;
+extern size_t socket_stub_output_size(void);
 
 static int request_index(struct http_server_connection_t *connection_p,
                          struct http_server_request_t *request_p);
@@ -54,14 +63,36 @@ static int request_websocket_echo(struct http_server_connection_t *connection_p,
                                   struct http_server_request_t *request_p);
 static int request_404_not_found(struct http_server_connection_t *connection_p,
                                  struct http_server_request_t *request_p);
+static int request_chunked(struct http_server_connection_t *connection_p,
+                           struct http_server_request_t *request_p);
+static int request_user_post(struct http_server_connection_t *connection_p,
+                             struct http_server_request_t *request_p);
+static int request_admin_settings(struct http_server_connection_t *connection_p,
+                                  struct http_server_request_t *request_p);
+static int request_takeover(struct http_server_connection_t *connection_p,
+                            struct http_server_request_t *request_p);
 
 static struct http_server_t foo;
 
+static uint8_t fs_storage[PHY_SIZE];
+static struct spiffs_t fs_spiffs;
+static struct spiffs_config_t fs_spiffs_config;
+static uint8_t spiffs_workspace[2 * LOG_PAGE_SIZE];
+static uint8_t spiffs_fdworkspace[240];
+static uint8_t spiffs_cache[1408];
+static struct fs_filesystem_spiffs_config_t filesystem_config;
+static struct fs_filesystem_t filesystem;
+
 static struct http_server_route_t routes[] = {
     { .path_p = "/index.html", .callback = request_index },
     { .path_p = "/auth.html", .callback = request_auth },
     { .path_p = "/form.html", .callback = request_form },
     { .path_p = "/websocket/echo", .callback = request_websocket_echo },
+    { .path_p = "/chunked.html", .callback = request_chunked },
+    { .path_p = "/users/:id/posts/:post", .callback = request_user_post },
+    { .path_p = "/users/admin/settings", .callback = request_admin_settings },
+    { .path_p = "/takeover", .callback = request_takeover },
+    { .path_p = "/static/*", .callback = http_server_static_file },
     { .path_p = NULL, .callback = NULL }
 };
 
@@ -143,6 +174,94 @@ static int request_form(struct http_server_connection_t *connection_p,
     return (http_server_response_write(connection_p, request_p, &response));
 }
 
+/**
+ * Handler for the chunked request. The body is decoded when read from
+ * the connection channel.
+ */
+static int request_chunked(struct http_server_connection_t *connection_p,
+                           struct http_server_request_t *request_p)
+{
+    struct http_server_response_t response;
+    char buf[16];
+
+    /* Verify the request. */
+    BTASSERT(request_p->action == http_server_request_action_post_t);
+    BTASSERT(request_p->headers.content_length.present == 0);
+    BTASSERT(request_p->headers.transfer_encoding.present == 1);
+    BTASSERT(chan_read(connection_p->chan_p, buf, sizeof(buf)) == 9);
+    BTASSERT(strncmp("key=value", buf, 9) == 0);
+    BTASSERT(chan_read(connection_p->chan_p, buf, sizeof(buf)) == 0);
+
+    /* Create the response. */
+    response.code = http_server_response_code_200_ok_t;
+    response.content.type = http_server_content_type_text_html_t;
+    response.content.buf_p = "Chunked!";
+    response.content.size = strlen(response.content.buf_p);
+
+    return (http_server_response_write(connection_p, request_p, &response));
+}
+
+/**
+ * Handler for the user post request, with the user and post in the
+ * path.
+ */
+static int request_user_post(struct http_server_connection_t *connection_p,
+                             struct http_server_request_t *request_p)
+{
+    struct http_server_response_t response;
+    char id[8];
+    char post[8];
+    char content[32];
+    char buf[2];
+
+    BTASSERT(http_server_request_get_param(request_p,
+                                           "id",
+                                           &id[0],
+                                           sizeof(id)) > 0);
+    BTASSERT(http_server_request_get_param(request_p,
+                                           "post",
+                                           &post[0],
+                                           sizeof(post)) > 0);
+    BTASSERT(http_server_request_get_param(request_p,
+                                           "missing",
+                                           &buf[0],
+                                           sizeof(buf)) == -ENOENT);
+    BTASSERT(http_server_request_get_param(request_p,
+                                           "id",
+                                           &buf[0],
+                                           sizeof(buf)) == -ENOMEM);
+
+    /* Create the response. */
+    response.code = http_server_response_code_200_ok_t;
+    response.content.type = http_server_content_type_text_plain_t;
+    response.content.buf_p = &content[0];
+    response.content.size = std_sprintf(&content[0],
+                                        FSTR("User %s, post %s."),
+                                        &id[0],
+                                        &post[0]);
+
+    return (http_server_response_write(connection_p, request_p, &response));
+}
+
+/**
+ * Handler for the admin settings request.
+ */
+static int request_admin_settings(struct http_server_connection_t *connection_p,
+                                  struct http_server_request_t *request_p)
+{
+    struct http_server_response_t response;
+
+    BTASSERT(request_p->params.length == 0);
+
+    /* Create the response. */
+    response.code = http_server_response_code_200_ok_t;
+    response.content.type = http_server_content_type_text_plain_t;
+    response.content.buf_p = "Settings.";
+    response.content.size = strlen(response.content.buf_p);
+
+    return (http_server_response_write(connection_p, request_p, &response));
+}
+
 /**
  * Handler for the websocket echo request. Echo all websocket messages
  * the client sends on the socket.
@@ -182,6 +301,39 @@ static int request_websocket_echo(struct http_server_connection_t *connection_p,
     return (0);
 }
 
+/**
+ * Handler for the takeover request. Switch protocol and answer a ping
+ * read directly from the socket.
+ */
+static int request_takeover(struct http_server_connection_t *connection_p,
+                            struct http_server_request_t *request_p)
+{
+    char buf[4];
+    const char *str_p;
+
+    str_p = "HTTP/1.1 101 Switching Protocols\r\n\r\n";
+
+    if (socket_write(&connection_p->socket, str_p, strlen(str_p))
+        != strlen(str_p)) {
+        return (-1);
+    }
+
+    if (socket_read(&connection_p->socket, &buf[0], sizeof(buf))
+        != sizeof(buf)) {
+        return (-1);
+    }
+
+    if (memcmp(&buf[0], "ping", sizeof(buf)) != 0) {
+        return (-1);
+    }
+
+    if (socket_write(&connection_p->socket, "pong", 4) != 4) {
+        return (-1);
+    }
+
+    return (0);
+}
+
 /**
  * Handler for all requests except those in the route array.
  */
@@ -215,6 +367,94 @@ static int request_404_not_found(struct http_server_connection_t *connection_p,
     return (0);
 }
 
+static int32_t hal_read(struct spiffs_t *fs_p,
+                        uint32_t addr,
+                        uint32_t size,
+                        uint8_t *dst_p)
+{
+    memcpy(dst_p, &fs_storage[addr], size);
+
+    return (0);
+}
+
+static int32_t hal_write(struct spiffs_t *fs_p,
+                         uint32_t addr,
+                         uint32_t size,
+                         uint8_t *src_p)
+{
+    memcpy(&fs_storage[addr], src_p, size);
+
+    return (0);
+}
+
+static int32_t hal_erase(struct spiffs_t *fs_p,
+                         uint32_t addr,
+                         uint32_t size)
+{
+    memset(&fs_storage[addr], -1, size);
+
+    return (0);
+}
+
+static int filesystem_init(void)
+{
+    memset(&fs_storage[0], -1, sizeof(fs_storage));
+
+    fs_spiffs_config.hal_read_f = hal_read;
+    fs_spiffs_config.hal_write_f = hal_write;
+    fs_spiffs_config.hal_erase_f = hal_erase;
+    fs_spiffs_config.phys_size = PHY_SIZE;
+    fs_spiffs_config.phys_addr = PHY_ADDR;
+    fs_spiffs_config.phys_erase_block = PHYS_ERASE_BLOCK;
+    fs_spiffs_config.log_block_size = LOG_BLOCK_SIZE;
+    fs_spiffs_config.log_page_size = LOG_PAGE_SIZE;
+
+    /* The first mount fails, but initializes the runtime variables
+       needed by format. */
+    spiffs_mount(&fs_spiffs,
+                 &fs_spiffs_config,
+                 spiffs_workspace,
+                 spiffs_fdworkspace,
+                 sizeof(spiffs_fdworkspace),
+                 spiffs_cache,
+                 sizeof(spiffs_cache),
+                 NULL);
+    BTASSERT(spiffs_format(&fs_spiffs) == 0);
+    BTASSERT(spiffs_mount(&fs_spiffs,
+                          &fs_spiffs_config,
+                          spiffs_workspace,
+                          spiffs_fdworkspace,
+                          sizeof(spiffs_fdworkspace),
+                          spiffs_cache,
+                          sizeof(spiffs_cache),
+                          NULL) == 0);
+
+    filesystem_config.config_p = &fs_spiffs_config;
+    filesystem_config.workspace_p = spiffs_workspace;
+    filesystem_config.fdworkspace.buf_p = spiffs_fdworkspace;
+    filesystem_config.fdworkspace.size = sizeof(spiffs_fdworkspace);
+    filesystem_config.cache.buf_p = spiffs_cache;
+    filesystem_config.cache.size = sizeof(spiffs_cache);
+    BTASSERT(fs_filesystem_init_spiffs(&filesystem,
+                                       "/fs",
+                                       &fs_spiffs,
+                                       &filesystem_config) == 0);
+    BTASSERT(fs_filesystem_register(&filesystem) == 0);
+
+    return (0);
+}
+
+static int write_file(const char *path_p, const char *buf_p, size_t size)
+{
+    struct fs_file_t file;
+
+    BTASSERT(fs_open(&file, path_p, FS_WRITE | FS_CREAT | FS_TRUNC) == 0);
+    BTASSERT(fs_write(&file, buf_p, size) == size);
+    BTASSERT(fs_close(&file) == 0);
+
+    return (0);
+}
+
 static int test_start(struct harness_t *harness_p)
 {
     static struct http_server_listener_t listener = {
@@ -245,10 +485,11 @@ static int test_start(struct harness_t *harness_p)
         }
     };
 
+    BTASSERT(filesystem_init() == 0);
     BTASSERT(http_server_init(&foo,
                               &listener,
                               connections,
-                              NULL,
+                              "/fs/www",
                               routes,
                               request_404_not_found) == 0);
 
@@ -292,6 +533,7 @@ static int test_request_index(struct harness_t *harness_p)
     buf[strlen(str_p)] = '\0';
     BTASSERT(strcmp(buf, str_p) == 0);
 
+    socket_stub_close_connection();
     socket_stub_wait_closed();
 
     return (0);
@@ -326,6 +568,7 @@ static int test_request_index_with_query_string(struct harness_t *harness_p)
     buf[strlen(str_p)] = '\0';
     BTASSERT(strcmp(buf, str_p) == 0);
 
+    socket_stub_close_connection();
     socket_stub_wait_closed();
 
     return (0);
@@ -361,6 +604,7 @@ static int test_request_auth(struct harness_t *harness_p)
     buf[strlen(str_p)] = '\0';
     BTASSERT(strcmp(buf, str_p) == 0);
 
+    socket_stub_close_connection();
     socket_stub_wait_closed();
 
     return (0);
@@ -398,6 +642,7 @@ static int test_request_form(struct harness_t *harness_p)
     buf[strlen(str_p)] = '\0';
     BTASSERT(strcmp(buf, str_p) == 0);
 
+    socket_stub_close_connection();
     socket_stub_wait_closed();
 
     return (0);
@@ -490,6 +735,281 @@ static int test_request_no_route(struct harness_t *harness_p)
     buf[strlen(str_p)] = '\0';
     BTASSERT(strcmp(buf, str_p) == 0);
 
+    socket_stub_close_connection();
+    socket_stub_wait_closed();
+
+    return (0);
+}
+
+static int test_request_route_params(struct harness_t *harness_p)
+{
+    char *str_p;
+    char buf[256];
+
+    socket_stub_accept();
+
+    /* Parameters in the path. */
+    str_p =
+        "GET /users/42/posts/7?order=new HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    str_p =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 16\r\n"
+        "\r\n"
+        "User 42, post 7.";
+    socket_stub_output(buf, strlen(str_p));
+    buf[strlen(str_p)] = '\0';
+    BTASSERT(strcmp(buf, str_p) == 0);
+
+    /* An exact segment is preferred over a parameter. */
+    str_p =
+        "GET /users/admin/settings HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    str_p =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 9\r\n"
+        "\r\n"
+        "Settings.";
+    socket_stub_output(buf, strlen(str_p));
+    buf[strlen(str_p)] = '\0';
+    BTASSERT(strcmp(buf, str_p) == 0);
+
+    /* The parameter matches if the rest of the path does not match
+       below the exact segment. */
+    str_p =
+        "GET /users/admin/posts/1 HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    str_p =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 19\r\n"
+        "\r\n"
+        "User admin, post 1.";
+    socket_stub_output(buf, strlen(str_p));
+    buf[strlen(str_p)] = '\0';
+    BTASSERT(strcmp(buf, str_p) == 0);
+
+    /* Partial and too long paths do not match. */
+    str_p =
+        "GET /users/42 HTTP/1.1\r\n"
+        "\r\n"
+        "GET /users/42/posts/7/x HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    str_p =
+        "HTTP/1.1 404 Not Found\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 50\r\n"
+        "\r\n"
+        "The requested page '/users/42' could not be found.";
+    socket_stub_output(buf, strlen(str_p));
+    buf[strlen(str_p)] = '\0';
+    BTASSERT(strcmp(buf, str_p) == 0);
+    str_p =
+        "HTTP/1.1 404 Not Found\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 60\r\n"
+        "\r\n"
+        "The requested page '/users/42/posts/7/x' could not be found.";
+    socket_stub_output(buf, strlen(str_p));
+    buf[strlen(str_p)] = '\0';
+    BTASSERT(strcmp(buf, str_p) == 0);
+
+    socket_stub_close_connection();
+    socket_stub_wait_closed();
+
+    return (0);
+}
+
+static int test_route_table_full(struct harness_t *harness_p)
+{
+    static struct http_server_t server;
+    static struct http_server_listener_t listener;
+    static struct http_server_connection_t connections[] = {
+        {
+            .thrd = {
+                .name_p = NULL
+            }
+        }
+    };
+    static char paths[CONFIG_HTTP_SERVER_ROUTE_NODES_MAX + 1][8];
+    static struct http_server_route_t many_routes[membersof(paths) + 1];
+    static struct http_server_route_t bad_routes[] = {
+        { .path_p = "/static/*/index.html", .callback = request_index },
+        { .path_p = NULL, .callback = NULL }
+    };
+    int i;
+
+    for (i = 0; i < membersof(paths); i++) {
+        std_sprintf(&paths[i][0], FSTR("/%d"), i);
+        many_routes[i].path_p = &paths[i][0];
+        many_routes[i].callback = request_index;
+    }
+
+    many_routes[i].path_p = NULL;
+
+    BTASSERT(http_server_init(&server,
+                              &listener,
+                              connections,
+                              NULL,
+                              many_routes,
+                              request_404_not_found) == -ENOMEM);
+
+    /* A wildcard must be the last segment. */
+    BTASSERT(http_server_init(&server,
+                              &listener,
+                              connections,
+                              NULL,
+                              bad_routes,
+                              request_404_not_found) == -EINVAL);
+
+    return (0);
+}
+
+static int test_request_static_file(struct harness_t *harness_p)
+{
+    static char big[1500];
+    static char buf[sizeof(big) + 256];
+    char *str_p;
+    char etag[24];
+    char header[128];
+    size_t size;
+    int i;
+
+    for (i = 0; i < sizeof(big); i++) {
+        big[i] = ('a' + (i % 26));
+    }
+
+    str_p = "var a = 1;\n";
+    BTASSERT(write_file("/fs/www/static/app.js", str_p, strlen(str_p)) == 0);
+    BTASSERT(write_file("/fs/www/static/big.txt", big, sizeof(big)) == 0);
+
+    socket_stub_accept();
+
+    /* The file is sent with its entity tag. */
+    str_p =
+        "GET /static/app.js?v=2 HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    std_sprintf(&etag[0],
+                FSTR("\"b-%lx\""),
+                (unsigned long)crc_32(0, "var a = 1;\n", 11));
+    size = std_sprintf(&header[0],
+                       FSTR("HTTP/1.1 200 OK\r\n"
+                            "Content-Type: application/javascript\r\n"
+                            "Content-Length: 11\r\n"
+                            "ETag: %s\r\n"
+                            "\r\n"
+                            "var a = 1;\n"),
+                       &etag[0]);
+    socket_stub_output(buf, size);
+    BTASSERT(memcmp(buf, &header[0], size) == 0);
+
+    /* Not modified. */
+    size = std_sprintf(&buf[0],
+                       FSTR("GET /static/app.js HTTP/1.1\r\n"
+                            "If-None-Match: %s\r\n"
+                            "\r\n"),
+                       &etag[0]);
+    socket_stub_input(buf, size);
+    size = std_sprintf(&header[0],
+                       FSTR("HTTP/1.1 304 Not Modified\r\n"
+                            "ETag: %s\r\n"
+                            "\r\n"),
+                       &etag[0]);
+    socket_stub_output(buf, size);
+    BTASSERT(memcmp(buf, &header[0], size) == 0);
+
+    /* The file is modified. */
+    str_p = "var a = 12;\n";
+    BTASSERT(write_file("/fs/www/static/app.js", str_p, strlen(str_p)) == 0);
+    size = std_sprintf(&buf[0],
+                       FSTR("GET /static/app.js HTTP/1.1\r\n"
+                            "If-None-Match: %s\r\n"
+                            "\r\n"),
+                       &etag[0]);
+    socket_stub_input(buf, size);
+    std_sprintf(&etag[0],
+                FSTR("\"c-%lx\""),
+                (unsigned long)crc_32(0, str_p, strlen(str_p)));
+    size = std_sprintf(&header[0],
+                       FSTR("HTTP/1.1 200 OK\r\n"
+                            "Content-Type: application/javascript\r\n"
+                            "Content-Length: 12\r\n"
+                            "ETag: %s\r\n"
+                            "\r\n"
+                            "var a = 12;\n"),
+                       &etag[0]);
+    socket_stub_output(buf, size);
+    BTASSERT(memcmp(buf, &header[0], size) == 0);
+
+    /* The file is modified without changing its size. */
+    str_p = "var a = 13;\n";
+    BTASSERT(write_file("/fs/www/static/app.js", str_p, strlen(str_p)) == 0);
+    size = std_sprintf(&buf[0],
+                       FSTR("GET /static/app.js HTTP/1.1\r\n"
+                            "If-None-Match: %s\r\n"
+                            "\r\n"),
+                       &etag[0]);
+    socket_stub_input(buf, size);
+    std_sprintf(&etag[0],
+                FSTR("\"c-%lx\""),
+                (unsigned long)crc_32(0, str_p, strlen(str_p)));
+    size = std_sprintf(&header[0],
+                       FSTR("HTTP/1.1 200 OK\r\n"
+                            "Content-Type: application/javascript\r\n"
+                            "Content-Length: 12\r\n"
+                            "ETag: %s\r\n"
+                            "\r\n"
+                            "var a = 13;\n"),
+                       &etag[0]);
+    socket_stub_output(buf, size);
+    BTASSERT(memcmp(buf, &header[0], size) == 0);
+
+    /* A file larger than the chunk size. */
+    str_p =
+        "GET /static/big.txt HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    std_sprintf(&etag[0],
+                FSTR("\"5dc-%lx\""),
+                (unsigned long)crc_32(0, big, sizeof(big)));
+    size = std_sprintf(&header[0],
+                       FSTR("HTTP/1.1 200 OK\r\n"
+                            "Content-Type: text/plain\r\n"
+                            "Content-Length: 1500\r\n"
+                            "ETag: %s\r\n"
+                            "\r\n"),
+                       &etag[0]);
+    socket_stub_output(buf, size + sizeof(big));
+    BTASSERT(memcmp(buf, &header[0], size) == 0);
+    BTASSERT(memcmp(&buf[size], big, sizeof(big)) == 0);
+
+    /* Missing files and files outside the root path. */
+    str_p =
+        "GET /static/missing.js HTTP/1.1\r\n"
+        "\r\n"
+        "GET /static/../secret.txt HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    str_p =
+        "HTTP/1.1 404 Not Found\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 0\r\n"
+        "\r\n"
+        "HTTP/1.1 404 Not Found\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 0\r\n"
+        "\r\n";
+    socket_stub_output(buf, strlen(str_p));
+    BTASSERT(memcmp(buf, str_p, strlen(str_p)) == 0);
+
+    socket_stub_close_connection();
     socket_stub_wait_closed();
 
     return (0);
@@ -568,6 +1088,305 @@ static int test_request_header_field_too_long(struct harness_t *harness_p)
     return (0);
 }
 
+static const char index_response[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/html\r\n"
+    "Content-Length: 8\r\n"
+    "\r\n"
+    "Welcome!";
+
+/**
+ * Read a response from the server and compare it to given expected
+ * response.
+ */
+static int read_response(const char *expected_p)
+{
+    char buf[256];
+
+    socket_stub_output(buf, strlen(expected_p));
+    buf[strlen(expected_p)] = '\0';
+    BTASSERT(strcmp(buf, expected_p) == 0);
+
+    return (0);
+}
+
+static int test_request_keep_alive(struct harness_t *harness_p)
+{
+    char *str_p;
+
+    socket_stub_accept();
+
+    /* Two requests on the same connection. */
+    str_p =
+        "GET /index.html HTTP/1.1\r\n"
+        "User-Agent: TestcaseRequestIndex\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response(&index_response[0]) == 0);
+
+    str_p =
+        "POST /form.html HTTP/1.1\r\n"
+        "Content-Type: application/x-www-form-urlencoded\r\n"
+        "Content-Length: 9\r\n"
+        "\r\n"
+        "key=value";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response("HTTP/1.1 200 OK\r\n"
+                           "Content-Type: text/html\r\n"
+                           "Content-Length: 5\r\n"
+                           "\r\n"
+                           "Form!") == 0);
+
+    socket_stub_close_connection();
+    socket_stub_wait_closed();
+
+    return (0);
+}
+
+static int test_request_pipelining(struct harness_t *harness_p)
+{
+    char *str_p;
+
+    socket_stub_accept();
+
+    /* Three requests written at once. The body of the second request
+       is not read by its route callback, and is skipped by the
+       server. */
+    str_p =
+        "GET /index.html HTTP/1.1\r\n"
+        "\r\n"
+        "POST /missing.html HTTP/1.1\r\n"
+        "Content-Length: 9\r\n"
+        "\r\n"
+        "key=value"
+        "GET /index.html HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response(&index_response[0]) == 0);
+    BTASSERT(read_response("HTTP/1.1 404 Not Found\r\n"
+                           "Content-Type: text/plain\r\n"
+                           "Content-Length: 54\r\n"
+                           "\r\n"
+                           "The requested page '/missing.html' could "
+                           "not be found.") == 0);
+    BTASSERT(read_response(&index_response[0]) == 0);
+
+    socket_stub_close_connection();
+    socket_stub_wait_closed();
+
+    return (0);
+}
+
+static int test_request_chunked(struct harness_t *harness_p)
+{
+    char *str_p;
+
+    socket_stub_accept();
+
+    str_p =
+        "POST /chunked.html HTTP/1.1\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "\r\n"
+        "4\r\n"
+        "key=\r\n"
+        "5;name=value\r\n"
+        "value\r\n"
+        "0\r\n"
+        "Trailer: foo\r\n"
+        "\r\n"
+        "GET /index.html HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response("HTTP/1.1 200 OK\r\n"
+                           "Content-Type: text/html\r\n"
+                           "Content-Length: 8\r\n"
+                           "\r\n"
+                           "Chunked!") == 0);
+    BTASSERT(read_response(&index_response[0]) == 0);
+
+    socket_stub_close_connection();
+    socket_stub_wait_closed();
+
+    return (0);
+}
+
+static int test_request_connection_close(struct harness_t *harness_p)
+{
+    char *str_p;
+
+    /* The server closes the connection when asked to. */
+    socket_stub_accept();
+
+    str_p =
+        "GET /index.html HTTP/1.1\r\n"
+        "Connection: close\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response(&index_response[0]) == 0);
+    socket_stub_wait_closed();
+
+    /* HTTP/1.0 connections are not persistent. */
+    socket_stub_accept();
+
+    str_p =
+        "GET /index.html HTTP/1.0\r\n"
+        "Connection: keep-alive\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response(&index_response[0]) == 0);
+    socket_stub_wait_closed();
+
+    return (0);
+}
+
+static int test_request_idle_timeout(struct harness_t *harness_p)
+{
+    char *str_p;
+    struct time_t start;
+    struct time_t stop;
+
+    socket_stub_accept();
+
+    str_p =
+        "GET /index.html HTTP/1.1\r\n"
+        "\r\n";
+    socket_stub_input(str_p, strlen(str_p));
+    BTASSERT(read_response(&index_response[0]) == 0);
+
+    /* The server closes the idle connection. */
+    time_get(&start);
+    socket_stub_wait_closed();
+    time_get(&stop);
+    time_subtract(&stop, &stop, &start);
+    std_printf(OSTR("Idle connection closed after %lu ms.\r\n"),
+               (unsigned long)(stop.seconds * 1000
+                               + stop.nanoseconds / 1000000));
+    BTASSERT(stop.seconds * 1000 + stop.nanoseconds / 1000000
+             >= CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS - 10);
+
+    return (0);
+}
+
+static int test_request_takeover(struct harness_t *harness_p)
+{
+    int i;
+    char *requests[2];
+    char *str_p;
+
+    /* A protocol upgrade, and a body without a length read from the
+       socket by the route callback. */
+    requests[0] =
+        "GET /takeover HTTP/1.1\r\n"
+        "Upgrade: ping\r\n"
+        "Connection: Upgrade\r\n"
+        "\r\n";
+    requests[1] =
+        "POST /takeover HTTP/1.1\r\n"
+        "\r\n";
+
+    for (i = 0; i < membersof(requests); i++) {
+        socket_stub_accept();
+        socket_stub_input(requests[i], strlen(requests[i]));
+        BTASSERT(read_response("HTTP/1.1 101 Switching Protocols\r\n"
+                               "\r\n") == 0);
+
+        /* The server must not read the request following the ping
+           from the connection taken over by the route callback. */
+        str_p =
+            "ping"
+            "GET /index.html HTTP/1.1\r\n"
+            "\r\n";
+        socket_stub_input(str_p, strlen(str_p));
+        BTASSERT(read_response("pong") == 0);
+        socket_stub_wait_closed();
+        BTASSERT(socket_stub_output_size() == 0);
+        socket_stub_input_flush();
+    }
+
+    return (0);
+}
+
+/**
+ * Measure the number of handled requests per second, with a new
+ * connection per request and with a persistent connection.
+ */
+static int test_benchmark(struct harness_t *harness_p)
+{
+    int i;
+    int keep_alive;
+    int reads;
+    char *str_p;
+    struct time_t start;
+    struct time_t stop;
+    unsigned long ms;
+
+    thrd_set_log_mask(foo.listener_p->thrd.id_p, LOG_UPTO(INFO));
+    thrd_set_log_mask(foo.connections_p[0].thrd.id_p, LOG_UPTO(INFO));
+
+    for (keep_alive = 0; keep_alive < 2; keep_alive++) {
+        if (keep_alive == 1) {
+            str_p =
+                "GET /index.html HTTP/1.1\r\n"
+                "User-Agent: Benchmark\r\n"
+                "\r\n";
+            socket_stub_accept();
+        } else {
+            str_p =
+                "GET /index.html HTTP/1.1\r\n"
+                "User-Agent: Benchmark\r\n"
+                "Connection: close\r\n"
+                "\r\n";
+        }
+
+        reads = socket_stub_read_counter;
+        time_get(&start);
+
+        for (i = 0; i < 1000; i++) {
+            if (keep_alive == 0) {
+                socket_stub_accept();
+            }
+
+            socket_stub_input(str_p, strlen(str_p));
+            BTASSERT(read_response(&index_response[0]) == 0);
+
+            if (keep_alive == 0) {
+                socket_stub_wait_closed();
+            }
+        }
+
+        time_get(&stop);
+        reads = (socket_stub_read_counter - reads);
+
+        if (keep_alive == 1) {
+            socket_stub_close_connection();
+            socket_stub_wait_closed();
+        }
+
+        time_subtract(&stop, &stop, &start);
+        ms = (stop.seconds * 1000 + stop.nanoseconds / 1000000);
+
+        if (ms == 0) {
+            ms = 1;
+        }
+
+        std_printf(OSTR("%s: %lu requests per second, "
+                        "%d socket reads per 1000 requests.\r\n"),
+                   (keep_alive == 1
+                    ? "persistent connection"
+                    : "connection per request"),
+                   1000000UL / ms,
+                   reads);
+
+        /* One socket read per request. */
+        BTASSERT(reads <= 1000 + keep_alive);
+    }
+
+    thrd_set_log_mask(foo.listener_p->thrd.id_p, LOG_UPTO(DEBUG));
+    thrd_set_log_mask(foo.connections_p[0].thrd.id_p, LOG_UPTO(DEBUG));
+
+    return (0);
+}
+
 static int test_stop(struct harness_t *harness_p)
 {
     BTASSERT(http_server_stop(&foo) == 0);
@@ -634,11 +1453,11 @@ static int test_https_stop(struct harness_t *harness_p)
 #if CONFIG_HTTP_SERVER_SSL == 1
     BTASSERT(http_server_stop(&foo) == 0);
 
-    BTASSERT(ssl_open_counter == 6);
-    BTASSERT(ssl_close_counter == 6);
-    BTASSERT(ssl_write_counter == 9);
-    BTASSERT(ssl_read_counter == 730);
-    BTASSERT(ssl_size_counter == 0);
+    BTASSERT(ssl_open_counter == 8);
+    BTASSERT(ssl_close_counter == 8);
+    BTASSERT(ssl_write_counter == 12);
+    BTASSERT(ssl_read_counter == 18);
+    BTASSERT(ssl_size_counter == 34);
 
     return (0);
 #else
@@ -657,8 +1476,18 @@ int main()
         { test_request_form, "test_request_form" },
         { test_request_websocket, "test_request_websocket" },
         { test_request_no_route, "test_request_no_route" },
+        { test_request_route_params, "test_request_route_params" },
+        { test_route_table_full, "test_route_table_full" },
+        { test_request_static_file, "test_request_static_file" },
         { test_request_url_too_long, "test_request_url_too_long" },
         { test_request_header_field_too_long, "test_request_header_field_too_long" },
+        { test_request_keep_alive, "test_request_keep_alive" },
+        { test_request_pipelining, "test_request_pipelining" },
+        { test_request_chunked, "test_request_chunked" },
+        { test_request_connection_close, "test_request_connection_close" },
+        { test_request_idle_timeout, "test_request_idle_timeout" },
+        { test_request_takeover, "test_request_takeover" },
+        { test_benchmark, "test_benchmark" },
         { test_stop, "test_stop" },
         { test_https_start, "test_https_start" },
 #if CONFIG_HTTP_SERVER_SSL == 1
@@ -668,6 +1497,8 @@ int main()
         { test_request_form, "test_https_request_form" },
         { test_request_websocket, "test_https_request_websocket" },
         { test_request_no_route, "test_https_request_no_route" },
+        { test_request_keep_alive, "test_https_request_keep_alive" },
+        { test_request_pipelining, "test_https_request_pipelining" },
 #endif
         { test_https_stop, "test_https_stop" },
         { NULL, NULL }
@@ -36,11 +36,21 @@ static char qinputbuf[256];
 static char qoutputbuf[256];
 static struct event_t accept_events;
 static struct event_t closed_events;
+static struct socket_t *accepted_socket_p;
+static int input_closed;
+int socket_stub_read_counter;
+const char *socket_stub_bind_address_p = "127.0.0.1";
 
 static ssize_t read(void *self_p,
                     void *buf_p,
                     size_t size)
 {
+    socket_stub_read_counter++;
+
+    if (input_closed == 1) {
+        return (0);
+    }
+
     return (queue_read(&qinput, buf_p, size));
 }
 
@@ -53,7 +63,27 @@ static ssize_t write(void *self_p,
 
 static size_t size(void *self_p)
 {
-    return (0);
+    if (input_closed == 1) {
+        return (1);
+    }
+
+    return (chan_size(&qinput));
+}
+
+/**
+ * Resume the connection thread if it is polling the accepted socket.
+ */
+static void resume_poller(void)
+{
+    sys_lock();
+
+    if ((accepted_socket_p != NULL)
+        && (accepted_socket_p->base.reader_p != NULL)) {
+        thrd_resume_isr(accepted_socket_p->base.reader_p, 0);
+        accepted_socket_p->base.reader_p = NULL;
+    }
+
+    sys_unlock();
 }
 
 int socket_module_init()
@@ -91,7 +121,8 @@ int socket_bind(struct socket_t *self_p,
 {
     char buf[16];
 
-    BTASSERT(strcmp(inet_ntoa(&local_addr_p->ip, &buf[0]), "127.0.0.1") == 0);
+    BTASSERT(strcmp(inet_ntoa(&local_addr_p->ip, &buf[0]),
+                    socket_stub_bind_address_p) == 0);
 
     return (0);
 }
@@ -114,9 +145,10 @@ int socket_accept(struct socket_t *self_p,
     uint32_t mask;
 
     chan_init(&accepted_p->base, read, write, size);
-    
+
     mask = 0x1;
     event_read(&accept_events, &mask, sizeof(mask));
+    accepted_socket_p = accepted_p;
 
     return (0);
 }
@@ -153,6 +185,11 @@ ssize_t socket_read(struct socket_t *self_p,
     return (read(NULL, buf_p, size));
 }
 
+ssize_t socket_size(struct socket_t *self_p)
+{
+    return (size(NULL));
+}
+
 void socket_stub_init()
 {
     queue_init(&qinput, qinputbuf, sizeof(qinputbuf));
@@ -165,12 +202,16 @@ void socket_stub_accept()
 {
     uint32_t mask;
 
+    input_closed = 0;
     mask = 0x1;
     event_write(&accept_events, &mask, sizeof(mask));
 }
 
 void socket_stub_input(void *buf_p, size_t size)
 {
+    /* The poller checks the size again when resumed, after the
+       input has been written. */
+    resume_poller();
     chan_write(&qinput, buf_p, size);
 }
 
@@ -179,6 +220,11 @@ void socket_stub_output(void *buf_p, size_t size)
     chan_read(&qoutput, buf_p, size);
 }
 
+size_t socket_stub_output_size(void)
+{
+    return (chan_size(&qoutput));
+}
+
 void socket_stub_input_flush()
 {
     char c;
@@ -198,6 +244,8 @@ void socket_stub_wait_closed()
 
 void socket_stub_close_connection(void)
 {
+    input_closed = 1;
+    resume_poller();
     queue_stop(&qinput);
     queue_start(&qinput);
 }
@@ -0,0 +1,435 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#define PORT                                            47010
+#define NUMBER_OF_CONNECTIONS  CONFIG_HTTP_SERVER_CONNECTIONS_MAX
+
+static int request_index(struct http_server_connection_t *connection_p,
+                         struct http_server_request_t *request_p);
+static int request_echo(struct http_server_connection_t *connection_p,
+                        struct http_server_request_t *request_p);
+static int request_404_not_found(struct http_server_connection_t *connection_p,
+                                 struct http_server_request_t *request_p);
+
+static const char request[] =
+    "GET /index.html HTTP/1.1\r\n"
+    "\r\n";
+
+static const char response[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/html\r\n"
+    "Content-Length: 8\r\n"
+    "\r\n"
+    "Welcome!";
+
+static struct http_server_t server;
+
+static struct http_server_route_t routes[] = {
+    { .path_p = "/index.html", .callback = request_index },
+    { .path_p = "/echo", .callback = request_echo },
+    { .path_p = NULL, .callback = NULL }
+};
+
+static THRD_STACK(listener_stack, 4096);
+
+static struct http_server_listener_t listener = {
+    .address_p = "127.0.0.1",
+    .port = PORT,
+    .thrd = {
+        .name_p = "http_listener",
+        .stack = {
+            .buf_p = listener_stack,
+            .size = sizeof(listener_stack)
+        }
+    }
+};
+
+static struct http_server_connection_t connections[NUMBER_OF_CONNECTIONS];
+
+/* One more client than there are server connections. */
+static struct socket_t clients[NUMBER_OF_CONNECTIONS + 1];
+
+static int request_index(struct http_server_connection_t *connection_p,
+                         struct http_server_request_t *request_p)
+{
+    struct http_server_response_t response;
+
+    response.code = http_server_response_code_200_ok_t;
+    response.content.type = http_server_content_type_text_html_t;
+    response.content.buf_p = "Welcome!";
+    response.content.size = strlen(response.content.buf_p);
+
+    return (http_server_response_write(connection_p, request_p, &response));
+}
+
+/**
+ * Respond with the request body.
+ */
+static int request_echo(struct http_server_connection_t *connection_p,
+                        struct http_server_request_t *request_p)
+{
+    struct http_server_response_t response;
+    char buf[256];
+    ssize_t size;
+
+    if (request_p->headers.content_length.value > sizeof(buf)) {
+        return (-1);
+    }
+
+    size = chan_read(connection_p->chan_p,
+                     &buf[0],
+                     request_p->headers.content_length.value);
+
+    if (size != request_p->headers.content_length.value) {
+        return (-1);
+    }
+
+    response.code = http_server_response_code_200_ok_t;
+    response.content.type = http_server_content_type_text_plain_t;
+    response.content.buf_p = &buf[0];
+    response.content.size = size;
+
+    return (http_server_response_write(connection_p, request_p, &response));
+}
+
+static int request_404_not_found(struct http_server_connection_t *connection_p,
+                                 struct http_server_request_t *request_p)
+{
+    struct http_server_response_t response;
+
+    response.code = http_server_response_code_404_not_found_t;
+    response.content.type = http_server_content_type_text_plain_t;
+    response.content.buf_p = "";
+    response.content.size = 0;
+
+    return (http_server_response_write(connection_p, request_p, &response));
+}
+
+static int client_connect(struct socket_t *client_p)
+{
+    struct inet_addr_t addr;
+
+    BTASSERT(inet_aton("127.0.0.1", &addr.ip) == 0);
+    addr.port = PORT;
+
+    BTASSERT(socket_open_tcp(client_p) == 0);
+    BTASSERT(socket_connect(client_p, &addr) == 0);
+
+    return (0);
+}
+
+static int client_write_request(struct socket_t *client_p)
+{
+    BTASSERT(socket_write(client_p,
+                          &request[0],
+                          strlen(request)) == strlen(request));
+
+    return (0);
+}
+
+static int client_read_response(struct socket_t *client_p)
+{
+    char buf[sizeof(response)];
+
+    BTASSERT(socket_read(client_p,
+                         &buf[0],
+                         strlen(response)) == strlen(response));
+    BTASSERT(memcmp(&buf[0], &response[0], strlen(response)) == 0);
+
+    return (0);
+}
+
+/**
+ * Returns true(1) if given client connection has been closed by the
+ * server.
+ */
+static int client_is_closed(struct socket_t *client_p)
+{
+    char buf[1];
+
+    return (socket_read(client_p, &buf[0], sizeof(buf)) == 0);
+}
+
+static int test_start(struct harness_t *harness_p)
+{
+    BTASSERT(http_server_init_multiplexed(&server,
+                                          &listener,
+                                          &connections[0],
+                                          membersof(connections),
+                                          NULL,
+                                          routes,
+                                          request_404_not_found) == 0);
+    BTASSERT(http_server_start(&server) == 0);
+
+    /* Let the listener start listening. */
+    thrd_sleep_ms(50);
+
+    std_printf(OSTR("%d connections use %u bytes of RAM.\r\n"),
+               NUMBER_OF_CONNECTIONS,
+               (unsigned int)sizeof(connections));
+
+    return (0);
+}
+
+static int test_many_connections(struct harness_t *harness_p)
+{
+    int i;
+    int round;
+
+    for (i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+        BTASSERT(client_connect(&clients[i]) == 0);
+    }
+
+    /* All clients send a request before any response is read. */
+    for (round = 0; round < 2; round++) {
+        for (i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+            BTASSERT(client_write_request(&clients[i]) == 0);
+        }
+
+        for (i = NUMBER_OF_CONNECTIONS - 1; i >= 0; i--) {
+            BTASSERT(client_read_response(&clients[i]) == 0);
+        }
+    }
+
+    return (0);
+}
+
+static int test_pipelining(struct harness_t *harness_p)
+{
+    char buf[2 * sizeof(request)];
+
+    memcpy(&buf[0], &request[0], strlen(request));
+    memcpy(&buf[strlen(request)], &request[0], strlen(request));
+    BTASSERT(socket_write(&clients[0],
+                          &buf[0],
+                          2 * strlen(request)) == 2 * strlen(request));
+    BTASSERT(client_read_response(&clients[0]) == 0);
+    BTASSERT(client_read_response(&clients[0]) == 0);
+
+    return (0);
+}
+
+static int test_least_recently_used(struct harness_t *harness_p)
+{
+    int i;
+
+    /* Make the first client the least recently used. */
+    thrd_sleep_ms(50);
+
+    for (i = 1; i < NUMBER_OF_CONNECTIONS; i++) {
+        BTASSERT(client_write_request(&clients[i]) == 0);
+        BTASSERT(client_read_response(&clients[i]) == 0);
+    }
+
+    /* One connection too many. The first client is disconnected. */
+    BTASSERT(client_connect(&clients[NUMBER_OF_CONNECTIONS]) == 0);
+    BTASSERT(client_write_request(&clients[NUMBER_OF_CONNECTIONS]) == 0);
+    BTASSERT(client_read_response(&clients[NUMBER_OF_CONNECTIONS]) == 0);
+    BTASSERT(client_is_closed(&clients[0]) == 1);
+    BTASSERT(socket_close(&clients[0]) == 0);
+
+    return (0);
+}
+
+static int test_idle_timeout(struct harness_t *harness_p)
+{
+    int i;
+
+    thrd_sleep_ms(CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS + 200);
+
+    for (i = 1; i < NUMBER_OF_CONNECTIONS + 1; i++) {
+        BTASSERT(client_is_closed(&clients[i]) == 1);
+        BTASSERT(socket_close(&clients[i]) == 0);
+    }
+
+    return (0);
+}
+
+static int test_partial_request(struct harness_t *harness_p)
+{
+    size_t size;
+    char buf[70];
+
+    BTASSERT(client_connect(&clients[0]) == 0);
+    BTASSERT(client_connect(&clients[1]) == 0);
+
+    /* The first client sends half of its request. The server does
+       not wait for the rest of it before serving the second
+       client. */
+    size = (strlen(request) / 2);
+    BTASSERT(socket_write(&clients[0], &request[0], size) == size);
+    thrd_sleep_ms(50);
+    BTASSERT(client_write_request(&clients[1]) == 0);
+    BTASSERT(client_read_response(&clients[1]) == 0);
+
+    /* The rest of the request. */
+    BTASSERT(socket_write(&clients[0],
+                          &request[size],
+                          strlen(request) - size) == strlen(request) - size);
+    BTASSERT(client_read_response(&clients[0]) == 0);
+
+    /* A request with a body received in two parts. */
+    BTASSERT(socket_write(&clients[0],
+                          "POST /echo HTTP/1.1\r\n"
+                          "Content-Length: 6\r\n"
+                          "\r\n"
+                          "foo",
+                          45) == 45);
+    thrd_sleep_ms(50);
+    BTASSERT(client_write_request(&clients[1]) == 0);
+    BTASSERT(client_read_response(&clients[1]) == 0);
+    BTASSERT(socket_write(&clients[0], "bar", 3) == 3);
+    BTASSERT(socket_read(&clients[0], &buf[0], 70) == 70);
+    BTASSERT(memcmp(&buf[0],
+                    "HTTP/1.1 200 OK\r\n"
+                    "Content-Type: text/plain\r\n"
+                    "Content-Length: 6\r\n"
+                    "\r\n"
+                    "foobar",
+                    70) == 0);
+
+    BTASSERT(socket_close(&clients[0]) == 0);
+    BTASSERT(socket_close(&clients[1]) == 0);
+
+    return (0);
+}
+
+static int test_partial_request_timeout(struct harness_t *harness_p)
+{
+    size_t size;
+    char buf[200];
+
+    BTASSERT(client_connect(&clients[0]) == 0);
+    BTASSERT(client_connect(&clients[1]) == 0);
+
+    /* A partial request is not completed in time. */
+    size = (strlen(request) / 2);
+    BTASSERT(socket_write(&clients[0], &request[0], size) == size);
+    thrd_sleep_ms(CONFIG_HTTP_SERVER_KEEP_ALIVE_TIMEOUT_MS + 200);
+    BTASSERT(client_is_closed(&clients[0]) == 1);
+    BTASSERT(socket_close(&clients[0]) == 0);
+    BTASSERT(client_is_closed(&clients[1]) == 1);
+    BTASSERT(socket_close(&clients[1]) == 0);
+
+    /* A request not fitting in the request buffer, of which the end
+       is never received. */
+    BTASSERT(client_connect(&clients[0]) == 0);
+    BTASSERT(client_connect(&clients[1]) == 0);
+    memset(&buf[0], 'a', sizeof(buf));
+    BTASSERT(socket_write(&clients[0],
+                          "POST /echo HTTP/1.1\r\n"
+                          "Content-Length: 200\r\n"
+                          "\r\n",
+                          44) == 44);
+    BTASSERT(socket_write(&clients[0], &buf[0], 150) == 150);
+    thrd_sleep_ms(50);
+
+    /* The second client is served after the request timeout. */
+    BTASSERT(client_write_request(&clients[1]) == 0);
+    BTASSERT(client_read_response(&clients[1]) == 0);
+    BTASSERT(client_is_closed(&clients[0]) == 1);
+    BTASSERT(socket_close(&clients[0]) == 0);
+    BTASSERT(socket_close(&clients[1]) == 0);
+
+    return (0);
+}
+
+/**
+ * Measure the number of handled requests per second with all
+ * connections open.
+ */
+static int test_benchmark(struct harness_t *harness_p)
+{
+    int i;
+    int j;
+    struct time_t start;
+    struct time_t stop;
+    unsigned long ms;
+
+    for (i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+        BTASSERT(client_connect(&clients[i]) == 0);
+    }
+
+    time_get(&start);
+
+    for (j = 0; j < 50; j++) {
+        for (i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+            BTASSERT(client_write_request(&clients[i]) == 0);
+        }
+
+        for (i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+            BTASSERT(client_read_response(&clients[i]) == 0);
+        }
+    }
+
+    time_get(&stop);
+    time_subtract(&stop, &stop, &start);
+    ms = (stop.seconds * 1000 + stop.nanoseconds / 1000000);
+
+    if (ms == 0) {
+        ms = 1;
+    }
+
+    std_printf(OSTR("%lu requests per second on %d connections.\r\n"),
+               (50UL * NUMBER_OF_CONNECTIONS * 1000UL) / ms,
+               NUMBER_OF_CONNECTIONS);
+
+    for (i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+        BTASSERT(socket_close(&clients[i]) == 0);
+    }
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_start, "test_start" },
+        { test_many_connections, "test_many_connections" },
+        { test_pipelining, "test_pipelining" },
+        { test_least_recently_used, "test_least_recently_used" },
+        { test_idle_timeout, "test_idle_timeout" },
+        { test_partial_request, "test_partial_request" },
+        { test_partial_request_timeout, "test_partial_request_timeout" },
+        { test_benchmark, "test_benchmark" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+    socket_module_init();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
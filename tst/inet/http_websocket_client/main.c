@@ -142,6 +142,41 @@ static int test_read(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_read_masked(struct harness_t *harness_p)
+{
+    int i;
+    static const uint8_t masking_key[4] = { 0x12, 0x34, 0x56, 0x78 };
+
+    /* Two masked frames of 5 and 100 bytes, read into an unaligned
+       buffer in two parts crossing the frame boundary. */
+    buf[0] = 0x02; /* BINARY. */
+    buf[1] = 0x85; /* MASK and 5 bytes payload. */
+    memcpy(&buf[2], &masking_key[0], 4);
+
+    for (i = 0; i < 5; i++) {
+        buf[6 + i] = (i ^ masking_key[i % 4]);
+    }
+
+    buf[11] = 0x80; /* FIN & CONTINUATION. */
+    buf[12] = 0xe4; /* MASK and 100 bytes payload. */
+    memcpy(&buf[13], &masking_key[0], 4);
+
+    for (i = 0; i < 100; i++) {
+        buf[17 + i] = ((5 + i) ^ masking_key[i % 4]);
+    }
+
+    socket_stub_input(buf, 117);
+
+    BTASSERT(http_websocket_client_read(&foo, &buf[1], 50) == 50);
+    BTASSERT(http_websocket_client_read(&foo, &buf[51], 55) == 55);
+
+    for (i = 0; i < 105; i++) {
+        BTASSERTI(buf[1 + i], ==, i);
+    }
+
+    return (0);
+}
+
 static int test_write(struct harness_t *harness_p)
 {
     buf[0] = 'f';
@@ -224,6 +259,21 @@ static int test_write(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_write_chunk(struct harness_t *harness_p)
+{
+    BTASSERT(http_websocket_client_write_begin(&foo,
+                                               HTTP_TYPE_TEXT,
+                                               6) == 0);
+    BTASSERTI(http_websocket_client_write_chunk(&foo, "foo", 3), ==, 3);
+    BTASSERTI(http_websocket_client_write_chunk(&foo, "bar", 3), ==, 3);
+
+    /* Verify the output data. */
+    socket_stub_output(buf, 6 + 6);
+    BTASSERT(memcmp(buf, "\x81\x86\x00\x00\x00\x00" "foobar", 12) == 0);
+
+    return (0);
+}
+
 static int test_disconnect(struct harness_t *harness_p)
 {
     BTASSERT(http_websocket_client_disconnect(&foo) == 0);
@@ -237,7 +287,9 @@ int main()
     struct harness_testcase_t harness_testcases[] = {
         { test_connect, "test_connect" },
         { test_read, "test_read" },
+        { test_read_masked, "test_read_masked" },
         { test_write, "test_write" },
+        { test_write_chunk, "test_write_chunk" },
         { test_disconnect, "test_disconnect" },
         { NULL, NULL }
     };
@@ -33,6 +33,7 @@
 extern void socket_stub_init(void);
 extern void socket_stub_input(void *buf_p, size_t size);
 extern void socket_stub_output(void *buf_p, size_t size);
+extern int socket_stub_get_number_of_writes(void);
 
 static struct socket_t socket;
 static struct http_websocket_server_t server;
@@ -226,6 +227,104 @@ static int test_read(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_read_masked_long(struct harness_t *harness_p)
+{
+    int type;
+    int i;
+    static const uint8_t masking_key[4] = { 0x12, 0x34, 0x56, 0x78 };
+
+    /* A payload long enough to be unmasked a word at a time, read
+       into an unaligned buffer. */
+    buf[0] = 0x82; /* FIN & BINARY. */
+    buf[1] = 0xfe; /* MASK and 2 bytes payload length. */
+    buf[2] = 0x00; /* Payload length 0. */
+    buf[3] = 0xc8; /* Payload length 1. */
+    memcpy(&buf[4], &masking_key[0], 4);
+
+    for (i = 0; i < 200; i++) {
+        buf[8 + i] = (i ^ masking_key[i % 4]);
+    }
+
+    socket_stub_input(buf, 208);
+
+    BTASSERT(http_websocket_server_read(&server,
+                                        &type,
+                                        &buf[1],
+                                        sizeof(buf) - 1) == 200);
+    BTASSERT(type == HTTP_TYPE_BINARY);
+
+    for (i = 0; i < 200; i++) {
+        BTASSERTI(buf[1 + i], ==, i);
+    }
+
+    return (0);
+}
+
+static int test_read_chunk(struct harness_t *harness_p)
+{
+    int type;
+    int i;
+    static const uint8_t masking_key[4] = { 0x01, 0x02, 0x03, 0x04 };
+
+    /* A message in two frames, 7 and 50 bytes. */
+    buf[0] = 0x01; /* TEXT. */
+    buf[1] = 0x87; /* MASK and 7 bytes payload. */
+    memcpy(&buf[2], &masking_key[0], 4);
+
+    for (i = 0; i < 7; i++) {
+        buf[6 + i] = (('a' + i) ^ masking_key[i % 4]);
+    }
+
+    buf[13] = 0x80; /* FIN & CONTINUATION. */
+    buf[14] = 0xb2; /* MASK and 50 bytes payload. */
+    memcpy(&buf[15], &masking_key[0], 4);
+
+    for (i = 0; i < 50; i++) {
+        buf[19 + i] = (('a' + 7 + i) ^ masking_key[i % 4]);
+    }
+
+    socket_stub_input(buf, 69);
+
+    BTASSERT(http_websocket_server_read_begin(&server, &type) == 0);
+    BTASSERT(type == HTTP_TYPE_TEXT);
+
+    /* A chunk ends at the end of a frame. */
+    BTASSERTI(http_websocket_server_read_chunk(&server, buf, 5), ==, 5);
+    BTASSERTI(http_websocket_server_read_chunk(&server, &buf[5], 5), ==, 2);
+    BTASSERTI(http_websocket_server_read_chunk(&server,
+                                               &buf[7],
+                                               100), ==, 50);
+    BTASSERTI(http_websocket_server_read_chunk(&server, buf, 5), ==, 0);
+
+    for (i = 0; i < 57; i++) {
+        BTASSERTI(buf[i], ==, 'a' + i);
+    }
+
+    /* Start reading a message, and drop the rest of it when the next
+       message is read. */
+    buf[0] = 0x82;  /* FIN & BINARY. */
+    buf[1] = 0x64;  /* 100 bytes unmasked payload. */
+    memset(&buf[2], 'x', 100);
+    buf[102] = 0x81; /* FIN & TEXT. */
+    buf[103] = 0x02; /* 2 bytes unmasked payload. */
+    buf[104] = 'o';
+    buf[105] = 'k';
+    socket_stub_input(buf, 106);
+
+    BTASSERT(http_websocket_server_read_begin(&server, &type) == 0);
+    BTASSERT(type == HTTP_TYPE_BINARY);
+    BTASSERTI(http_websocket_server_read_chunk(&server, buf, 3), ==, 3);
+    BTASSERT(memcmp(buf, "xxx", 3) == 0);
+
+    BTASSERT(http_websocket_server_read_begin(&server, &type) == 0);
+    BTASSERT(type == HTTP_TYPE_TEXT);
+    BTASSERTI(http_websocket_server_read_chunk(&server, buf, 10), ==, 2);
+    BTASSERT(memcmp(buf, "ok", 2) == 0);
+    BTASSERTI(http_websocket_server_read_chunk(&server, buf, 10), ==, 0);
+
+    return (0);
+}
+
 static int test_write(struct harness_t *harness_p)
 {
     buf[0] = 'f';
@@ -296,6 +395,40 @@ static int test_write(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_write_chunk(struct harness_t *harness_p)
+{
+    int number_of_writes;
+
+    /* The header and a small payload are written at once. */
+    number_of_writes = socket_stub_get_number_of_writes();
+    BTASSERT(http_websocket_server_write(&server,
+                                         HTTP_TYPE_TEXT,
+                                         "foo",
+                                         3) == 3);
+    BTASSERTI(socket_stub_get_number_of_writes(), ==, number_of_writes + 1);
+    socket_stub_output(buf, 5);
+    BTASSERT(memcmp(buf, "\x81\x03" "foo", 5) == 0);
+
+    /* A message written in three chunks. */
+    BTASSERT(http_websocket_server_write_begin(&server,
+                                               HTTP_TYPE_TEXT,
+                                               9) == 0);
+    BTASSERTI(http_websocket_server_write_chunk(&server, "abc", 3), ==, 3);
+    BTASSERTI(http_websocket_server_write_chunk(&server, "def", 3), ==, 3);
+    BTASSERTI(http_websocket_server_write_chunk(&server, "ghi", 3), ==, 3);
+    socket_stub_output(buf, 11);
+    BTASSERT(memcmp(buf, "\x81\x09" "abcdefghi", 11) == 0);
+
+    /* An empty message. */
+    BTASSERT(http_websocket_server_write_begin(&server,
+                                               HTTP_TYPE_BINARY,
+                                               0) == 0);
+    socket_stub_output(buf, 2);
+    BTASSERT(memcmp(buf, "\x82\x00", 2) == 0);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_t harness;
@@ -305,7 +438,10 @@ int main()
         { test_handshake_key_missing, "test_handshake_key_missing" },
         { test_handshake_bad_action, "test_handshake_bad_action" },
         { test_read, "test_read" },
+        { test_read_masked_long, "test_read_masked_long" },
+        { test_read_chunk, "test_read_chunk" },
         { test_write, "test_write" },
+        { test_write_chunk, "test_write_chunk" },
         { NULL, NULL }
     };
 
@@ -32,6 +32,7 @@
 
 static struct queue_t qinput;
 static struct queue_t qoutput;
+static int number_of_writes = 0;
 
 #if defined(ARCH_LINUX)
 static char qinputbuf[131072];
@@ -52,6 +53,8 @@ static ssize_t write(void *self_p,
                      const void *buf_p,
                      size_t size)
 {
+    number_of_writes++;
+
     return (chan_write(&qoutput, buf_p, size));
 }
 
@@ -156,3 +159,8 @@ void socket_stub_output(void *buf_p, size_t size)
 {
     chan_read(&qoutput, buf_p, size);
 }
+
+int socket_stub_get_number_of_writes()
+{
+    return (number_of_writes);
+}
@@ -30,6 +30,18 @@
 
 #include "simba.h"
 
+/* Number of messages and simulated one way latency used in the
+   throughput benchmark. */
+#define BENCHMARK_MESSAGES                                 32
+#define BENCHMARK_LATENCY_MS                               20
+
+/* RAM backed SPIFFS file system for the outbox. */
+#define PHY_SIZE                                       0x10000
+#define PHY_ADDR                                             0
+#define PHYS_ERASE_BLOCK                                  4096
+#define LOG_BLOCK_SIZE                                    4096
+#define LOG_PAGE_SIZE                                      256
+
 struct message_t {
     void *buf_p;
     size_t size;
@@ -40,14 +52,121 @@ static struct queue_t qout;
 static struct queue_t qin;
 static struct queue_t qserverout;
 static struct queue_t qserverin;
-static char qoutbuf[64];
-static char qinbuf[64];
+static char qoutbuf[256];
+static char qinbuf[256];
 static char qserveroutbuf[64];
 static char qserverinbuf[64];
 static struct thrd_t *self_p;
+static int qout_writes;
+static int qout_writes_fail;
+
+static uint8_t fs_storage[PHY_SIZE];
+static struct spiffs_t fs_spiffs;
+static struct spiffs_config_t fs_spiffs_config;
+static uint8_t spiffs_workspace[2 * LOG_PAGE_SIZE];
+static uint8_t spiffs_fdworkspace[240];
+static uint8_t spiffs_cache[1408];
+static struct fs_filesystem_spiffs_config_t filesystem_config;
+static struct fs_filesystem_t filesystem;
+static struct mqtt_client_outbox_t outbox;
+static uint8_t outbox_buf[128];
 
 THRD_STACK(stack, 1024);
 THRD_STACK(server_stack, 512);
+THRD_STACK(broker_stack, 1024);
+THRD_STACK(publisher_stack, 1024);
+
+static int32_t hal_read(struct spiffs_t *fs_p,
+                        uint32_t addr,
+                        uint32_t size,
+                        uint8_t *dst_p)
+{
+    memcpy(dst_p, &fs_storage[addr], size);
+
+    return (0);
+}
+
+static int32_t hal_write(struct spiffs_t *fs_p,
+                         uint32_t addr,
+                         uint32_t size,
+                         uint8_t *src_p)
+{
+    memcpy(&fs_storage[addr], src_p, size);
+
+    return (0);
+}
+
+static int32_t hal_erase(struct spiffs_t *fs_p,
+                         uint32_t addr,
+                         uint32_t size)
+{
+    memset(&fs_storage[addr], -1, size);
+
+    return (0);
+}
+
+static int filesystem_init(void)
+{
+    memset(&fs_storage[0], -1, sizeof(fs_storage));
+
+    fs_spiffs_config.hal_read_f = hal_read;
+    fs_spiffs_config.hal_write_f = hal_write;
+    fs_spiffs_config.hal_erase_f = hal_erase;
+    fs_spiffs_config.phys_size = PHY_SIZE;
+    fs_spiffs_config.phys_addr = PHY_ADDR;
+    fs_spiffs_config.phys_erase_block = PHYS_ERASE_BLOCK;
+    fs_spiffs_config.log_block_size = LOG_BLOCK_SIZE;
+    fs_spiffs_config.log_page_size = LOG_PAGE_SIZE;
+
+    /* The first mount fails, but initializes the runtime variables
+       needed by format. */
+    spiffs_mount(&fs_spiffs,
+                 &fs_spiffs_config,
+                 spiffs_workspace,
+                 spiffs_fdworkspace,
+                 sizeof(spiffs_fdworkspace),
+                 spiffs_cache,
+                 sizeof(spiffs_cache),
+                 NULL);
+    BTASSERT(spiffs_format(&fs_spiffs) == 0);
+    BTASSERT(spiffs_mount(&fs_spiffs,
+                          &fs_spiffs_config,
+                          spiffs_workspace,
+                          spiffs_fdworkspace,
+                          sizeof(spiffs_fdworkspace),
+                          spiffs_cache,
+                          sizeof(spiffs_cache),
+                          NULL) == 0);
+
+    filesystem_config.config_p = &fs_spiffs_config;
+    filesystem_config.workspace_p = spiffs_workspace;
+    filesystem_config.fdworkspace.buf_p = spiffs_fdworkspace;
+    filesystem_config.fdworkspace.size = sizeof(spiffs_fdworkspace);
+    filesystem_config.cache.buf_p = spiffs_cache;
+    filesystem_config.cache.size = sizeof(spiffs_cache);
+    BTASSERT(fs_filesystem_init_spiffs(&filesystem,
+                                       "/fs",
+                                       &fs_spiffs,
+                                       &filesystem_config) == 0);
+    BTASSERT(fs_filesystem_register(&filesystem) == 0);
+
+    return (0);
+}
+
+/**
+ * Count the transport writes made by the client. The write with
+ * number `qout_writes_fail` fails, if non-zero.
+ */
+static ssize_t qout_write(void *chan_p, const void *buf_p, size_t size)
+{
+    qout_writes++;
+
+    if (qout_writes == qout_writes_fail) {
+        return (-EIO);
+    }
+
+    return (queue_write(chan_p, buf_p, size));
+}
 
 static void *server_main(void *arg_p)
 {
@@ -100,6 +219,107 @@ static size_t on_publish(struct mqtt_client_t *client_p,
     return (0);
 }
 
+static struct sem_t publish_complete_sem;
+static int publish_complete_count;
+static int publish_complete_count_max;
+static int publish_complete_res;
+
+static void on_publish_complete(struct mqtt_client_t *client_p,
+                                struct mqtt_application_message_t *message_p,
+                                int res)
+{
+    publish_complete_count++;
+
+    if (res != 0) {
+        publish_complete_res = res;
+    }
+
+    if (publish_complete_count == publish_complete_count_max) {
+        sem_give(&publish_complete_sem, 1);
+    }
+}
+
+/* Largest number of publish packets the broker stand-in has read
+   before acknowledging the first of them, for the synchronous and
+   asynchronous benchmark halves. */
+static int broker_burst_max[2];
+
+/**
+ * Broker stand-in acknowledging QoS 1 publish packets. Each burst of
+ * packets is acknowledged after the simulated latency.
+ */
+static int broker_read_publish(uint16_t *packet_id_p)
+{
+    uint8_t buf[128];
+    size_t topic_size;
+
+    if (chan_read(&qout, &buf[0], 2) != 2) {
+        return (-1);
+    }
+
+    if ((buf[0] != ((3 << 4) | (1 << 1))) || (buf[1] > sizeof(buf))) {
+        return (-1);
+    }
+
+    if (chan_read(&qout, &buf[2], buf[1]) != buf[1]) {
+        return (-1);
+    }
+
+    topic_size = ((buf[2] << 8) | buf[3]);
+    *packet_id_p = ((buf[4 + topic_size] << 8) | buf[5 + topic_size]);
+
+    return (0);
+}
+
+static void *broker_main(void *arg_p)
+{
+    int count;
+    int i;
+    int length;
+    uint16_t packet_ids[CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW];
+    uint8_t buf[4];
+
+    thrd_set_name("mqtt_broker");
+
+    count = 0;
+
+    while (count < 2 * BENCHMARK_MESSAGES) {
+        length = 0;
+
+        if (broker_read_publish(&packet_ids[length++]) != 0) {
+            break;
+        }
+
+        thrd_sleep_ms(BENCHMARK_LATENCY_MS);
+
+        while ((chan_size(&qout) > 0) && (length < membersof(packet_ids))) {
+            if (broker_read_publish(&packet_ids[length++]) != 0) {
+                break;
+            }
+        }
+
+        i = (count >= BENCHMARK_MESSAGES);
+
+        if (length > broker_burst_max[i]) {
+            broker_burst_max[i] = length;
+        }
+
+        for (i = 0; i < length; i++) {
+            buf[0] = (4 << 4);
+            buf[1] = 2;
+            buf[2] = (packet_ids[i] >> 8);
+            buf[3] = packet_ids[i];
+            chan_write(&qin, &buf[0], sizeof(buf));
+        }
+
+        count += length;
+    }
+
+    thrd_suspend(NULL);
+
+    return (NULL);
+}
+
 static int on_error(struct mqtt_client_t *client_p,
                     int error)
 {
@@ -108,11 +328,153 @@ static int on_error(struct mqtt_client_t *client_p,
     return (0);
 }
 
+/**
+ * Ping the client to make sure all messages written by the server so
+ * far have been handled.
+ */
+static int server_ping(void)
+{
+    struct message_t message;
+    static uint8_t pingresp[2] = { (13 << 4), 0 };
+    uint8_t buf[2];
+
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    message.buf_p = pingresp;
+    message.size = sizeof(pingresp);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    BTASSERT(mqtt_client_ping(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+    BTASSERT(buf[0] == (12 << 4));
+
+    return (0);
+}
+
+static char dispatched[32];
+static size_t dispatched_size;
+
+/**
+ * Record that given subscription was called, and read one byte of
+ * the payload, if any is left.
+ */
+static size_t dispatch_record(char id, void *chin_p)
+{
+    dispatched[dispatched_size++] = id;
+
+    if (chan_size(chin_p) > 0) {
+        chan_read(chin_p, &dispatched[dispatched_size++], 1);
+    }
+
+    dispatched[dispatched_size] = '\0';
+
+    return (0);
+}
+
+static size_t on_publish_1(struct mqtt_client_t *client_p,
+                           const char *topic_p,
+                           void *chin_p,
+                           size_t size)
+{
+    return (dispatch_record('1', chin_p));
+}
+
+static size_t on_publish_2(struct mqtt_client_t *client_p,
+                           const char *topic_p,
+                           void *chin_p,
+                           size_t size)
+{
+    return (dispatch_record('2', chin_p));
+}
+
+static size_t on_publish_3(struct mqtt_client_t *client_p,
+                           const char *topic_p,
+                           void *chin_p,
+                           size_t size)
+{
+    return (dispatch_record('3', chin_p));
+}
+
+static size_t on_publish_4(struct mqtt_client_t *client_p,
+                           const char *topic_p,
+                           void *chin_p,
+                           size_t size)
+{
+    return (dispatch_record('4', chin_p));
+}
+
+static size_t on_publish_5(struct mqtt_client_t *client_p,
+                           const char *topic_p,
+                           void *chin_p,
+                           size_t size)
+{
+    return (dispatch_record('5', chin_p));
+}
+
+static struct mqtt_client_subscription_t added_subscription;
+
+/**
+ * Add a subscription from the callback.
+ */
+static size_t on_publish_add(struct mqtt_client_t *client_p,
+                             const char *topic_p,
+                             void *chin_p,
+                             size_t size)
+{
+    mqtt_client_subscription_init(&added_subscription, "added", on_publish_1);
+
+    if (mqtt_client_subscription_add(client_p, &added_subscription) != 0) {
+        return (1);
+    }
+
+    return (dispatch_record('6', chin_p));
+}
+
+/**
+ * Let the server publish given QoS 0 message.
+ */
+static int server_write_publish(const char *topic_p, const char *payload_p)
+{
+    struct message_t message;
+    static uint8_t buf[64];
+    size_t topic_size;
+    size_t payload_size;
+
+    topic_size = strlen(topic_p);
+    payload_size = strlen(payload_p);
+    buf[0] = (3 << 4);
+    buf[1] = (2 + topic_size + payload_size);
+    buf[2] = 0;
+    buf[3] = topic_size;
+    memcpy(&buf[4], topic_p, topic_size);
+    memcpy(&buf[4 + topic_size], payload_p, payload_size);
+    message.buf_p = buf;
+    message.size = (4 + topic_size + payload_size);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    dispatched_size = 0;
+    dispatched[0] = '\0';
+
+    return (0);
+}
+
+/**
+ * Let the server publish given QoS 0 message and wait for it to be
+ * dispatched.
+ */
+static int server_publish(const char *topic_p, const char *payload_p)
+{
+    BTASSERT(server_write_publish(topic_p, payload_p) == 0);
+
+    return (server_ping());
+}
+
 static int test_init(struct harness_t *harness_p)
 {
     struct thrd_t *thrd_p;
 
     BTASSERT(queue_init(&qout, qoutbuf, sizeof(qoutbuf)) == 0);
+    qout.base.write = qout_write;
     BTASSERT(queue_init(&qin, qinbuf, sizeof(qinbuf)) == 0);
     BTASSERT(queue_init(&qserverout, qserveroutbuf, sizeof(qserveroutbuf)) == 0);
     BTASSERT(queue_init(&qserverin, qserverinbuf, sizeof(qserverinbuf)) == 0);
@@ -123,6 +485,16 @@ static int test_init(struct harness_t *harness_p)
                               &qin,
                               on_publish,
                               on_error) == 0);
+    BTASSERT(mqtt_client_set_on_publish_complete(&client,
+                                                 on_publish_complete) == 0);
+    BTASSERT(sem_init(&publish_complete_sem, 1, 1) == 0);
+    BTASSERT(filesystem_init() == 0);
+    BTASSERT(mqtt_client_outbox_init(&client,
+                                     &outbox,
+                                     "/fs/outbox",
+                                     outbox_buf,
+                                     sizeof(outbox_buf)) == 0);
+    BTASSERT(outbox.count == 0);
 
     thrd_p = thrd_spawn(mqtt_client_main,
                         &client,
@@ -511,6 +883,322 @@ static int test_incoming_publish_qos2(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_incoming_pubrel(struct harness_t *harness_p)
+{
+    uint8_t buf[20];
+    struct message_t message;
+
+    /* Prepare the server to send the publish message again, followed
+       by the release message. */
+    buf[0] = ((3 << 4) | (1 << 3) | (2 << 1)); /* DUP and QoS 2. */
+    buf[1] = 14;
+    buf[2] = 0;
+    buf[3] = 7;
+    buf[4] = 'f';
+    buf[5] = 'o';
+    buf[6] = 'o';
+    buf[7] = '/';
+    buf[8] = 'b';
+    buf[9] = 'a';
+    buf[10] = 'r';
+    buf[11] = 0;
+    buf[12] = 1;
+    buf[13] = 'f';
+    buf[14] = 'i';
+    buf[15] = 'e';
+    buf[16] = ((6 << 4) | 2);
+    buf[17] = 2;
+    buf[18] = 0;
+    buf[19] = 1;
+    message.buf_p = buf;
+    message.size = 20;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    /* Prepare the server to receive the REC and COMP messages. */
+    message.buf_p = NULL;
+    message.size = 8;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    published_message_size = 0;
+
+    BTASSERT(queue_read(&qserverout, buf, 8) == 8);
+    BTASSERT(buf[0] == (5 << 4));
+    BTASSERT(buf[1] == 2);
+    BTASSERT(buf[2] == 0);
+    BTASSERT(buf[3] == 1);
+    BTASSERT(buf[4] == (7 << 4));
+    BTASSERT(buf[5] == 2);
+    BTASSERT(buf[6] == 0);
+    BTASSERT(buf[7] == 1);
+
+    /* The duplicate was not delivered to the application. */
+    BTASSERT(published_message_size == 0);
+
+    return (0);
+}
+
+static int test_subscriptions(struct harness_t *harness_p)
+{
+    struct mqtt_client_topic_node_t nodes[8];
+    struct mqtt_client_subscription_t subscriptions[5];
+    struct mqtt_client_subscription_t subscription;
+    int i;
+
+    BTASSERT(mqtt_client_subscriptions_init(&client,
+                                            &nodes[0],
+                                            membersof(nodes)) == 0);
+
+    BTASSERT(mqtt_client_subscription_init(&subscriptions[0],
+                                           "foo/bar",
+                                           on_publish_1) == 0);
+    BTASSERT(mqtt_client_subscription_init(&subscriptions[1],
+                                           "foo/+",
+                                           on_publish_2) == 0);
+    BTASSERT(mqtt_client_subscription_init(&subscriptions[2],
+                                           "foo/#",
+                                           on_publish_3) == 0);
+    BTASSERT(mqtt_client_subscription_init(&subscriptions[3],
+                                           "#",
+                                           on_publish_4) == 0);
+    BTASSERT(mqtt_client_subscription_init(&subscriptions[4],
+                                           "+/+/baz",
+                                           on_publish_5) == 0);
+
+    /* Add them in reverse order, the dispatch order does not depend
+       on it. */
+    for (i = 4; i >= 0; i--) {
+        BTASSERT(mqtt_client_subscription_add(&client,
+                                              &subscriptions[i]) == 0);
+    }
+
+    /* Invalid filters. */
+    BTASSERT(mqtt_client_subscription_init(&subscription,
+                                           "foo/#/bar",
+                                           on_publish_1) == 0);
+    BTASSERT(mqtt_client_subscription_add(&client, &subscription) == -EINVAL);
+    BTASSERT(mqtt_client_subscription_init(&subscription,
+                                           "foo/ba+",
+                                           on_publish_1) == 0);
+    BTASSERT(mqtt_client_subscription_add(&client, &subscription) == -EINVAL);
+    BTASSERT(mqtt_client_subscription_init(&subscription,
+                                           "",
+                                           on_publish_1) == 0);
+    BTASSERT(mqtt_client_subscription_add(&client, &subscription) == -EINVAL);
+
+    /* All eight nodes are used. */
+    BTASSERT(mqtt_client_subscription_init(&subscription,
+                                           "fie/fum",
+                                           on_publish_1) == 0);
+    BTASSERT(mqtt_client_subscription_add(&client, &subscription) == -ENOMEM);
+
+    /* The payload is given to the subscriptions, most specific
+       first. Each callback reads one byte of the whole payload. */
+    BTASSERT(server_publish("foo/bar", "xyz") == 0);
+    BTASSERTM(&dispatched[0], "1x2x3x4x", 9);
+
+    /* A multi level wildcard also matches the parent level. */
+    BTASSERT(server_publish("foo", "q") == 0);
+    BTASSERTM(&dispatched[0], "3q4q", 5);
+
+    /* A payload larger than the buffer is streamed to the
+       subscriptions. Unread payload is discarded. */
+    BTASSERT(server_publish("a/b/baz", "abcdef") == 0);
+    BTASSERTM(&dispatched[0], "5a4b", 5);
+
+    BTASSERT(server_publish("foo/fie/fum", "") == 0);
+    BTASSERTM(&dispatched[0], "34", 3);
+
+    /* Wildcards do not match topics starting with '$'. The
+       on-publish callback is called instead. */
+    BTASSERT(server_write_publish("$SYS/baz/baz", "z") == 0);
+    thrd_suspend(NULL);
+    BTASSERT(server_ping() == 0);
+    BTASSERTM(&dispatched[0], "", 1);
+    BTASSERTM(&published_topic[0], "$SYS/baz/baz", 13);
+    BTASSERT(published_message_size == 1);
+    BTASSERTM(&published_message[0], "z", 1);
+
+    /* Removing a subscription frees its unused nodes. */
+    BTASSERT(mqtt_client_subscription_remove(&client,
+                                             &subscriptions[0]) == 0);
+    BTASSERT(mqtt_client_subscription_remove(&client,
+                                             &subscriptions[0]) == -ENOENT);
+    BTASSERT(server_publish("foo/bar", "xyz") == 0);
+    BTASSERTM(&dispatched[0], "2x3x4x", 7);
+
+    BTASSERT(mqtt_client_subscription_init(&subscription,
+                                           "fie",
+                                           on_publish_1) == 0);
+    BTASSERT(mqtt_client_subscription_add(&client, &subscription) == 0);
+    BTASSERT(server_publish("fie", "") == 0);
+    BTASSERTM(&dispatched[0], "14", 3);
+    BTASSERT(mqtt_client_subscription_remove(&client, &subscription) == 0);
+
+    for (i = 1; i < 5; i++) {
+        BTASSERT(mqtt_client_subscription_remove(&client,
+                                                 &subscriptions[i]) == 0);
+    }
+
+    /* All nodes are free again. */
+    BTASSERT(client.subscriptions.root.children_p == NULL);
+
+    /* A callback may add a subscription. */
+    BTASSERT(mqtt_client_subscription_init(&subscription,
+                                           "add",
+                                           on_publish_add) == 0);
+    BTASSERT(mqtt_client_subscription_add(&client, &subscription) == 0);
+    BTASSERT(server_publish("add", "y") == 0);
+    BTASSERTM(&dispatched[0], "6y", 3);
+    BTASSERT(server_publish("added", "z") == 0);
+    BTASSERTM(&dispatched[0], "1z", 3);
+    BTASSERT(mqtt_client_subscription_remove(&client, &subscription) == 0);
+    BTASSERT(mqtt_client_subscription_remove(&client,
+                                             &added_subscription) == 0);
+    BTASSERT(client.subscriptions.root.children_p == NULL);
+
+    return (0);
+}
+
+static int test_publish_qos2(struct harness_t *harness_p)
+{
+    struct mqtt_application_message_t foobar;
+    struct message_t message;
+    uint8_t buf[16];
+    uint8_t pubrec[4];
+    uint8_t pubcomp[4];
+
+    /* Prepare the server to receive the publish message. */
+    message.buf_p = NULL;
+    message.size = 16;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    /* Prepare the server to send the publish received message. */
+    pubrec[0] = (5 << 4);
+    pubrec[1] = 2;
+    pubrec[2] = 0;
+    pubrec[3] = 2;
+    message.buf_p = pubrec;
+    message.size = 4;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    /* Prepare the server to receive the publish release message. */
+    message.buf_p = NULL;
+    message.size = 4;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    /* Prepare the server to send the publish complete message. */
+    pubcomp[0] = (7 << 4);
+    pubcomp[1] = 2;
+    pubcomp[2] = 0;
+    pubcomp[3] = 2;
+    message.buf_p = pubcomp;
+    message.size = 4;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    /* Publish a message without waiting for it to be delivered. */
+    foobar.topic.buf_p = "foo/bar";
+    foobar.topic.size = 7;
+    foobar.payload.buf_p = "fie";
+    foobar.payload.size = 3;
+    foobar.qos = mqtt_qos_2_t;
+
+    publish_complete_count = 0;
+    publish_complete_count_max = 1;
+    publish_complete_res = 0;
+
+    BTASSERT(mqtt_client_publish_async(&client, &foobar) == 0);
+
+    BTASSERT(queue_read(&qserverout, buf, 16) == 16);
+    BTASSERT(buf[0] == ((3 << 4) | (2 << 1)));
+    BTASSERT(buf[1] == 14);
+    BTASSERT(buf[11] == 0);
+    BTASSERT(buf[12] == 2);
+
+    BTASSERT(queue_read(&qserverout, buf, 4) == 4);
+    BTASSERT(buf[0] == ((6 << 4) | 2));
+    BTASSERT(buf[1] == 2);
+    BTASSERT(buf[2] == 0);
+    BTASSERT(buf[3] == 2);
+
+    /* Wait for the publish complete message. */
+    BTASSERT(sem_take(&publish_complete_sem, NULL) == 0);
+    BTASSERT(publish_complete_count == 1);
+    BTASSERT(publish_complete_res == 0);
+
+    return (0);
+}
+
+static int test_publish_throughput(struct harness_t *harness_p)
+{
+    struct mqtt_application_message_t foobar;
+    struct time_t start;
+    struct time_t stop;
+    struct time_t diff;
+    long sync_ms;
+    long async_ms;
+    int i;
+
+    BTASSERT(thrd_spawn(broker_main,
+                        NULL,
+                        0,
+                        broker_stack,
+                        sizeof(broker_stack)) != NULL);
+
+    foobar.topic.buf_p = "foo/bar";
+    foobar.topic.size = 7;
+    foobar.payload.buf_p = "0123456789abcdef";
+    foobar.payload.size = 16;
+    foobar.qos = mqtt_qos_1_t;
+
+    /* One message per round trip. */
+    time_get(&start);
+
+    for (i = 0; i < BENCHMARK_MESSAGES; i++) {
+        BTASSERT(mqtt_client_publish(&client, &foobar) == 0);
+    }
+
+    time_get(&stop);
+    time_subtract(&diff, &stop, &start);
+    sync_ms = (diff.seconds * 1000L + diff.nanoseconds / 1000000L);
+
+    /* A full in-flight window per round trip. */
+    publish_complete_count = 0;
+    publish_complete_count_max = BENCHMARK_MESSAGES;
+    publish_complete_res = 0;
+
+    time_get(&start);
+
+    for (i = 0; i < BENCHMARK_MESSAGES; i++) {
+        BTASSERT(mqtt_client_publish_async(&client, &foobar) == 0);
+    }
+
+    BTASSERT(sem_take(&publish_complete_sem, NULL) == 0);
+
+    time_get(&stop);
+    time_subtract(&diff, &stop, &start);
+    async_ms = (diff.seconds * 1000L + diff.nanoseconds / 1000000L);
+
+    std_printf(FSTR("%d QoS 1 messages, %d ms latency, window %d\r\n"
+                    "mqtt_client_publish():       %ld ms\r\n"
+                    "mqtt_client_publish_async(): %ld ms\r\n"),
+               BENCHMARK_MESSAGES,
+               BENCHMARK_LATENCY_MS,
+               CONFIG_MQTT_CLIENT_INFLIGHT_WINDOW,
+               sync_ms,
+               async_ms);
+
+    BTASSERT(publish_complete_count == BENCHMARK_MESSAGES);
+    BTASSERT(publish_complete_res == 0);
+
+    /* Each synchronous publish waits for its acknowledgement, while
+       later asynchronous publishes are on the wire before the first
+       acknowledgement is received. */
+    BTASSERT(broker_burst_max[0] == 1);
+    BTASSERT(broker_burst_max[1] > 1);
+
+    return (0);
+}
+
 static int test_disconnect(struct harness_t *harness_p)
 {
     struct message_t message;
@@ -531,6 +1219,414 @@ static int test_disconnect(struct harness_t *harness_p)
     return (0);
 }
 
+static int server_connect(uint8_t *buf_p)
+{
+    struct message_t message;
+    static uint8_t connack[4] = { 0x20, 2, 0, 0 };
+
+    message.buf_p = NULL;
+    message.size = 14;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    message.buf_p = connack;
+    message.size = sizeof(connack);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    BTASSERT(mqtt_client_connect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf_p, 14) == 14);
+    BTASSERT(buf_p[0] == 0x10);
+
+    return (0);
+}
+
+/**
+ * Acknowledge given packet identifiers, and ping the client to make
+ * sure the acknowledgements have been handled.
+ */
+static int server_puback(uint8_t *buf_p, uint16_t *packet_ids_p, int length)
+{
+    struct message_t message;
+    int i;
+
+    for (i = 0; i < length; i++) {
+        buf_p[4 * i] = (4 << 4);
+        buf_p[4 * i + 1] = 2;
+        buf_p[4 * i + 2] = (packet_ids_p[i] >> 8);
+        buf_p[4 * i + 3] = packet_ids_p[i];
+    }
+
+    message.buf_p = buf_p;
+    message.size = (4 * length);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    return (server_ping());
+}
+
+static struct sem_t publisher_sem;
+static int publisher_res;
+
+static void *publisher_main(void *arg_p)
+{
+    thrd_set_name("publisher");
+
+    publisher_res = mqtt_client_publish(&client, arg_p);
+    sem_give(&publisher_sem, 1);
+
+    thrd_suspend(NULL);
+
+    return (NULL);
+}
+
+static int test_publish_concurrent(struct harness_t *harness_p)
+{
+    struct mqtt_application_message_t foobar;
+    struct message_t message;
+    uint8_t buf[16];
+    uint16_t packet_id;
+
+    foobar.topic.buf_p = "foo/bar";
+    foobar.topic.size = 7;
+    foobar.payload.buf_p = "fie";
+    foobar.payload.size = 3;
+    foobar.qos = mqtt_qos_1_t;
+
+    sem_init(&publisher_sem, 1, 1);
+    publisher_res = 1;
+
+    /* Publish a message from another thread and leave it in
+       flight. */
+    message.buf_p = NULL;
+    message.size = 16;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(thrd_spawn(publisher_main,
+                        &foobar,
+                        0,
+                        publisher_stack,
+                        sizeof(publisher_stack)) != NULL);
+    BTASSERT(queue_read(&qserverout, buf, 16) == 16);
+    BTASSERT(buf[0] == ((3 << 4) | (1 << 1)));
+    packet_id = ((buf[11] << 8) | buf[12]);
+
+    /* The ping result is not given to the waiting publisher. */
+    BTASSERT(server_ping() == 0);
+    BTASSERT(publisher_res == 1);
+
+    /* The publisher gets the result of its own message. */
+    BTASSERT(server_puback(&buf[0], &packet_id, 1) == 0);
+    BTASSERT(sem_take(&publisher_sem, NULL) == 0);
+    BTASSERT(publisher_res == 0);
+
+    return (0);
+}
+
+static int test_outbox(struct harness_t *harness_p)
+{
+    static struct mqtt_client_t client2;
+    static struct mqtt_client_outbox_t outbox2;
+    static uint8_t outbox2_buf[32];
+    struct mqtt_application_message_t messages[3];
+    struct message_t message;
+    uint8_t buf[64];
+    uint8_t *packet_p;
+    uint16_t packet_ids[3];
+    int i;
+
+    for (i = 0; i < membersof(messages); i++) {
+        messages[i].topic.buf_p = "foo/bar";
+        messages[i].topic.size = 7;
+        messages[i].payload.buf_p = &"m0m1m2"[2 * i];
+        messages[i].payload.size = 2;
+        messages[i].qos = mqtt_qos_1_t;
+    }
+
+    /* Messages published while disconnected are stored in the
+       outbox. */
+    BTASSERT(mqtt_client_publish(&client, &messages[0]) == 0);
+
+    publish_complete_count = 0;
+    publish_complete_count_max = 2;
+    publish_complete_res = 0;
+    BTASSERT(mqtt_client_publish_async(&client, &messages[1]) == 0);
+    BTASSERT(mqtt_client_publish_async(&client, &messages[2]) == 0);
+    BTASSERT(sem_take(&publish_complete_sem, NULL) == 0);
+    BTASSERT(publish_complete_res == 0);
+    BTASSERT(outbox.count == 3);
+
+    /* The outbox file survives a restart. */
+    BTASSERT(mqtt_client_outbox_init(&client2,
+                                     &outbox2,
+                                     "/fs/outbox",
+                                     outbox2_buf,
+                                     sizeof(outbox2_buf)) == 0);
+    BTASSERT(outbox2.count == 3);
+    BTASSERT(fs_close(&outbox2.file) == 0);
+
+    /* Prepare the server to receive the stored messages after the
+       connect message. */
+    message.buf_p = NULL;
+    message.size = 45;
+    qout_writes = 0;
+    BTASSERT(server_connect(&buf[0]) == 0);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(queue_read(&qserverout, buf, 45) == 45);
+
+    /* Two writes for the connect message and one for all stored
+       messages. */
+    BTASSERTI(qout_writes, ==, 3);
+
+    for (i = 0; i < 3; i++) {
+        packet_p = &buf[15 * i];
+        BTASSERT(packet_p[0] == ((3 << 4) | (1 << 1)));
+        BTASSERT(packet_p[1] == 13);
+        BTASSERTM(&packet_p[4], "foo/bar", 7);
+        packet_ids[i] = ((packet_p[11] << 8) | packet_p[12]);
+        BTASSERTM(&packet_p[13], messages[i].payload.buf_p, 2);
+    }
+
+    BTASSERT(server_puback(&buf[0], &packet_ids[0], 3) == 0);
+    BTASSERT(outbox.count == 0);
+
+    /* Publish a message and disconnect before it is acknowledged. */
+    message.buf_p = NULL;
+    message.size = 15;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    publish_complete_count = 0;
+    publish_complete_count_max = 1;
+    BTASSERT(mqtt_client_publish_async(&client, &messages[0]) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 15) == 15);
+    BTASSERT(buf[0] == ((3 << 4) | (1 << 1)));
+
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_disconnect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+
+    /* The message was moved to the outbox. */
+    BTASSERT(sem_take(&publish_complete_sem, NULL) == 0);
+    BTASSERT(publish_complete_res == 0);
+    BTASSERT(outbox.count == 1);
+
+    /* It is sent again with the duplicate flag set after
+       reconnecting. */
+    message.buf_p = NULL;
+    message.size = 15;
+    BTASSERT(server_connect(&buf[0]) == 0);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(queue_read(&qserverout, buf, 15) == 15);
+    BTASSERT(buf[0] == ((3 << 4) | (1 << 3) | (1 << 1)));
+    BTASSERTM(&buf[13], "m0", 2);
+    packet_ids[0] = ((buf[11] << 8) | buf[12]);
+
+    BTASSERT(server_puback(&buf[0], &packet_ids[0], 1) == 0);
+    BTASSERT(outbox.count == 0);
+
+    /* Disconnect. */
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_disconnect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+
+    return (0);
+}
+
+static int test_outbox_released(struct harness_t *harness_p)
+{
+    struct mqtt_application_message_t foobar;
+    struct message_t message;
+    uint8_t buf[16];
+    uint8_t pubrec[4];
+
+    foobar.topic.buf_p = "foo/bar";
+    foobar.topic.size = 7;
+    foobar.payload.buf_p = "m3";
+    foobar.payload.size = 2;
+    foobar.qos = mqtt_qos_2_t;
+
+    BTASSERT(server_connect(&buf[0]) == 0);
+
+    /* Publish a QoS 2 message and release it. */
+    message.buf_p = NULL;
+    message.size = 15;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+
+    publish_complete_count = 0;
+    publish_complete_count_max = 1;
+    publish_complete_res = 0;
+    BTASSERT(mqtt_client_publish_async(&client, &foobar) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 15) == 15);
+    BTASSERT(buf[0] == ((3 << 4) | (2 << 1)));
+
+    pubrec[0] = (5 << 4);
+    pubrec[1] = 2;
+    pubrec[2] = buf[11];
+    pubrec[3] = buf[12];
+    message.buf_p = pubrec;
+    message.size = sizeof(pubrec);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    message.buf_p = NULL;
+    message.size = 4;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(queue_read(&qserverout, buf, 4) == 4);
+    BTASSERT(buf[0] == ((6 << 4) | 2));
+
+    /* Disconnect before the publish complete message is received. The
+       server has the message, so it is not stored in the outbox. */
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_disconnect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+
+    BTASSERT(sem_take(&publish_complete_sem, NULL) == 0);
+    BTASSERT(publish_complete_res == 0);
+    BTASSERT(outbox.count == 0);
+
+    /* Nothing is published after reconnecting. */
+    BTASSERT(server_connect(&buf[0]) == 0);
+    BTASSERT(server_ping() == 0);
+
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_disconnect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+
+    return (0);
+}
+
+static int test_outbox_write_error(struct harness_t *harness_p)
+{
+    struct mqtt_application_message_t messages[3];
+    struct message_t message;
+    uint8_t buf[64];
+    uint8_t *packet_p;
+    uint16_t packet_ids[4];
+    int i;
+
+    for (i = 0; i < membersof(messages); i++) {
+        messages[i].topic.buf_p = "foo/bar";
+        messages[i].topic.size = 7;
+        messages[i].payload.buf_p = &"m0m1m2"[2 * i];
+        messages[i].payload.size = 2;
+        messages[i].qos = mqtt_qos_1_t;
+    }
+
+    /* Store three messages while disconnected. */
+    for (i = 0; i < membersof(messages); i++) {
+        BTASSERT(mqtt_client_publish(&client, &messages[i]) == 0);
+    }
+
+    BTASSERT(outbox.count == 3);
+
+    /* Sending the stored messages after the connect message fails. */
+    qout_writes = 0;
+    qout_writes_fail = 3;
+    BTASSERT(server_connect(&buf[0]) == 0);
+    BTASSERT(server_ping() == 0);
+    qout_writes_fail = 0;
+
+    /* The in-flight entries are released. */
+    for (i = 0; i < membersof(client.inflight.entries); i++) {
+        BTASSERT(client.inflight.entries[i].state == 0);
+    }
+
+    BTASSERT(outbox.count == 3);
+
+    /* All messages are sent, in order, when the next one is
+       stored. */
+    message.buf_p = NULL;
+    message.size = 60;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_publish(&client, &messages[0]) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 60) == 60);
+
+    for (i = 0; i < 4; i++) {
+        packet_p = &buf[15 * i];
+        BTASSERT(packet_p[0] == ((3 << 4) | (1 << 1)));
+        BTASSERTM(&packet_p[13], messages[i % 3].payload.buf_p, 2);
+        packet_ids[i] = ((packet_p[11] << 8) | packet_p[12]);
+    }
+
+    BTASSERT(server_puback(&buf[0], &packet_ids[0], 4) == 0);
+    BTASSERT(outbox.count == 0);
+
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_disconnect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+
+    return (0);
+}
+
+static int test_outbox_restart(struct harness_t *harness_p)
+{
+    struct mqtt_application_message_t messages[3];
+    struct message_t message;
+    uint8_t buf[64];
+    uint8_t *packet_p;
+    uint16_t packet_ids[3];
+    int i;
+
+    for (i = 0; i < membersof(messages); i++) {
+        messages[i].topic.buf_p = "foo/bar";
+        messages[i].topic.size = 7;
+        messages[i].payload.buf_p = &"m0m1m2"[2 * i];
+        messages[i].payload.size = 2;
+        messages[i].qos = mqtt_qos_1_t;
+    }
+
+    /* Store two messages while disconnected. */
+    BTASSERT(mqtt_client_publish(&client, &messages[0]) == 0);
+    BTASSERT(mqtt_client_publish(&client, &messages[1]) == 0);
+    BTASSERT(outbox.count == 2);
+
+    /* Restart, and store one more message. */
+    BTASSERT(fs_close(&outbox.file) == 0);
+    BTASSERT(mqtt_client_outbox_init(&client,
+                                     &outbox,
+                                     "/fs/outbox",
+                                     outbox_buf,
+                                     sizeof(outbox_buf)) == 0);
+    BTASSERT(outbox.count == 2);
+    BTASSERT(mqtt_client_publish(&client, &messages[2]) == 0);
+    BTASSERT(outbox.count == 3);
+
+    /* The messages stored before the restart may have been sent, so
+       they are sent again with the duplicate flag set. */
+    message.buf_p = NULL;
+    message.size = 45;
+    BTASSERT(server_connect(&buf[0]) == 0);
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(queue_read(&qserverout, buf, 45) == 45);
+
+    for (i = 0; i < 3; i++) {
+        packet_p = &buf[15 * i];
+
+        if (i < 2) {
+            BTASSERT(packet_p[0] == ((3 << 4) | (1 << 3) | (1 << 1)));
+        } else {
+            BTASSERT(packet_p[0] == ((3 << 4) | (1 << 1)));
+        }
+
+        BTASSERTM(&packet_p[13], messages[i].payload.buf_p, 2);
+        packet_ids[i] = ((packet_p[11] << 8) | packet_p[12]);
+    }
+
+    BTASSERT(server_puback(&buf[0], &packet_ids[0], 3) == 0);
+    BTASSERT(outbox.count == 0);
+
+    message.buf_p = NULL;
+    message.size = 2;
+    BTASSERT(queue_write(&qserverin, &message, sizeof(message)) == sizeof(message));
+    BTASSERT(mqtt_client_disconnect(&client) == 0);
+    BTASSERT(queue_read(&qserverout, buf, 2) == 2);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_t harness;
@@ -543,7 +1639,16 @@ int main()
         { test_incoming_publish_qos0, "test_incoming_publish_qos0" },
         { test_incoming_publish_qos1, "test_incoming_publish_qos1" },
         { test_incoming_publish_qos2, "test_incoming_publish_qos2" },
+        { test_incoming_pubrel, "test_incoming_pubrel" },
+        { test_subscriptions, "test_subscriptions" },
+        { test_publish_qos2, "test_publish_qos2" },
+        { test_publish_concurrent, "test_publish_concurrent" },
+        { test_publish_throughput, "test_publish_throughput" },
         { test_disconnect, "test_disconnect" },
+        { test_outbox, "test_outbox" },
+        { test_outbox_released, "test_outbox_released" },
+        { test_outbox_write_error, "test_outbox_write_error" },
+        { test_outbox_restart, "test_outbox_restart" },
         { NULL, NULL }
     };
 
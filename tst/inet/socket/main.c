@@ -30,14 +30,201 @@
 
 #include "simba.h"
 
-int test_init(struct harness_t *harness_p)
+#define TCP_PORT                                        47001
+#define UDP_PORT                                        47002
+#define CLOSED_PORT                                     47003
+#define CLOSE_PORT                                      47004
+
+static THRD_STACK(server_stack, 2048);
+static THRD_STACK(reader_stack, 2048);
+
+static struct socket_t listener;
+static struct sem_t server_ready_sem;
+static struct socket_t reader_socket;
+static ssize_t reader_res;
+static struct sem_t reader_done_sem;
+
+static void *reader_main(void *arg_p)
+{
+    char buf[4];
+
+    reader_res = socket_read(&reader_socket, &buf[0], sizeof(buf));
+    sem_give(&reader_done_sem, 1);
+
+    return (NULL);
+}
+
+static int test_init(struct harness_t *harness_p)
 {
     struct socket_t socket;
 
     BTASSERT(socket_open(&socket,
-                         SOCKET_DOMAIN_AF_INET,
+                         SOCKET_DOMAIN_INET,
                          SOCKET_TYPE_DGRAM,
                          0) == 0);
+    BTASSERT(socket_close(&socket) == 0);
+
+    return (0);
+}
+
+static void *tcp_echo_server_main(void *arg_p)
+{
+    struct inet_addr_t addr;
+    struct socket_t client;
+    char buf[64];
+    ssize_t size;
+
+    inet_aton("127.0.0.1", &addr.ip);
+    addr.port = TCP_PORT;
+
+    socket_open_tcp(&listener);
+    socket_bind(&listener, &addr);
+    socket_listen(&listener, 5);
+    sem_give(&server_ready_sem, 1);
+
+    if (socket_accept(&listener, &client, &addr) != 0) {
+        return (NULL);
+    }
+
+    /* Echo everything until the client closes the connection. */
+    while (1) {
+        size = socket_read(&client, &buf[0], 1);
+
+        if (size != 1) {
+            break;
+        }
+
+        socket_write(&client, &buf[0], size);
+    }
+
+    socket_close(&client);
+    socket_close(&listener);
+
+    return (NULL);
+}
+
+static int test_tcp(struct harness_t *harness_p)
+{
+    struct socket_t socket;
+    struct inet_addr_t addr;
+    char buf[16];
+
+    sem_init(&server_ready_sem, 1, 1);
+    BTASSERT(thrd_spawn(tcp_echo_server_main,
+                        NULL,
+                        0,
+                        server_stack,
+                        sizeof(server_stack)) != NULL);
+    sem_take(&server_ready_sem, NULL);
+
+    BTASSERT(inet_aton("127.0.0.1", &addr.ip) == 0);
+    addr.port = TCP_PORT;
+
+    BTASSERT(socket_open_tcp(&socket) == 0);
+    BTASSERT(socket_connect(&socket, &addr) == 0);
+
+    /* Blocking read of a full buffer. */
+    BTASSERT(socket_write(&socket, "hello", 5) == 5);
+    BTASSERT(socket_read(&socket, &buf[0], 5) == 5);
+    BTASSERT(memcmp(&buf[0], "hello", 5) == 0);
+
+    /* Poll for data. */
+    BTASSERT(socket_write(&socket, "!", 1) == 1);
+    BTASSERT(chan_poll(&socket, NULL) == &socket);
+    BTASSERT(socket_size(&socket) == 1);
+    BTASSERT(socket_read(&socket, &buf[0], 1) == 1);
+    BTASSERT(buf[0] == '!');
+
+    BTASSERT(socket_close(&socket) == 0);
+
+    return (0);
+}
+
+static int test_tcp_connection_refused(struct harness_t *harness_p)
+{
+    struct socket_t socket;
+    struct inet_addr_t addr;
+
+    BTASSERT(inet_aton("127.0.0.1", &addr.ip) == 0);
+    addr.port = CLOSED_PORT;
+
+    BTASSERT(socket_open_tcp(&socket) == 0);
+    BTASSERT(socket_connect(&socket, &addr) == -ECONNREFUSED);
+    BTASSERT(socket_close(&socket) == 0);
+
+    return (0);
+}
+
+static int test_udp(struct harness_t *harness_p)
+{
+    struct socket_t server;
+    struct socket_t client;
+    struct inet_addr_t addr;
+    struct inet_addr_t remote_addr;
+    struct time_t timeout;
+    char buf[16];
+
+    BTASSERT(inet_aton("127.0.0.1", &addr.ip) == 0);
+    addr.port = UDP_PORT;
+
+    BTASSERT(socket_open_udp(&server) == 0);
+    BTASSERT(socket_bind(&server, &addr) == 0);
+    BTASSERT(socket_open_udp(&client) == 0);
+
+    /* Nothing to read yet. */
+    timeout.seconds = 0;
+    timeout.nanoseconds = 50000000;
+    BTASSERT(chan_poll(&server, &timeout) == NULL);
+
+    BTASSERT(socket_sendto(&client, "ping", 4, 0, &addr) == 4);
+    BTASSERT(socket_recvfrom(&server,
+                             &buf[0],
+                             sizeof(buf),
+                             0,
+                             &remote_addr) == 4);
+    BTASSERT(memcmp(&buf[0], "ping", 4) == 0);
+
+    /* Reply to the sender. */
+    BTASSERT(socket_sendto(&server, "pong", 4, 0, &remote_addr) == 4);
+    BTASSERT(chan_poll(&client, NULL) == &client);
+    BTASSERT(socket_recvfrom(&client, &buf[0], sizeof(buf), 0, NULL) == 4);
+    BTASSERT(memcmp(&buf[0], "pong", 4) == 0);
+
+    BTASSERT(socket_close(&client) == 0);
+    BTASSERT(socket_close(&server) == 0);
+
+    return (0);
+}
+
+static int test_close_wakes_reader(struct harness_t *harness_p)
+{
+    struct inet_addr_t addr;
+
+    inet_aton("127.0.0.1", &addr.ip);
+    addr.port = CLOSE_PORT;
+
+    BTASSERT(socket_open_udp(&reader_socket) == 0);
+    BTASSERT(socket_bind(&reader_socket, &addr) == 0);
+
+    sem_init(&reader_done_sem, 1, 1);
+    reader_res = 1;
+    BTASSERT(thrd_spawn(reader_main,
+                        NULL,
+                        -1,
+                        reader_stack,
+                        sizeof(reader_stack)) != NULL);
+
+    /* Let the reader block in the read call. */
+    thrd_sleep_ms(10);
+    BTASSERTI(reader_res, ==, 1);
+
+    /* Closing the socket fails the blocked read. */
+    BTASSERT(socket_close(&reader_socket) == 0);
+    BTASSERT(sem_take(&reader_done_sem, NULL) == 0);
+    BTASSERTI(reader_res, <, 0);
+
+    /* Closing it again fails. */
+    BTASSERT(socket_close(&reader_socket) == -1);
 
     return (0);
 }
@@ -47,10 +234,15 @@ int main()
     struct harness_t harness;
     struct harness_testcase_t harness_testcases[] = {
         { test_init, "test_init" },
+        { test_tcp, "test_tcp" },
+        { test_tcp_connection_refused, "test_tcp_connection_refused" },
+        { test_udp, "test_udp" },
+        { test_close_wakes_reader, "test_close_wakes_reader" },
         { NULL, NULL }
     };
 
     sys_start();
+    socket_module_init();
 
     harness_init(&harness);
     harness_run(&harness, harness_testcases);
@@ -30,6 +30,28 @@
 
 #include "simba.h"
 
+/**
+ * Assert that given counter has given value.
+ */
+static int assert_counter(const char *path_p, const char *expected_p)
+{
+    char command[64];
+    char buf[32];
+    struct queue_t queue;
+    ssize_t size;
+
+    BTASSERT(queue_init(&queue, &buf[0], sizeof(buf)) == 0);
+    strcpy(&command[0], path_p);
+    BTASSERT(fs_call(&command[0], NULL, &queue, NULL) == 0);
+    size = queue_size(&queue);
+    BTASSERTI(size, ==, strlen(expected_p));
+    BTASSERT(queue_read(&queue, &command[0], size) == size);
+    command[size] = '\0';
+    BTASSERTM(&command[0], expected_p, size);
+
+    return (0);
+}
+
 static int test_init(struct harness_t *harness)
 {
     /* This function may be called multiple times. */
@@ -233,7 +255,108 @@ static int test_errors(struct harness_t *harness_p)
                              &socket,
                              0,
                              NULL) == -1);
-    
+
+    BTASSERT(ssl_context_destroy(&context) == 0);
+
+    return (0);
+}
+
+static int test_session_resumption(struct harness_t *harness_p)
+{
+    struct ssl_context_t context;
+    struct ssl_socket_t ssl_socket;
+    struct socket_t socket;
+    char command[64];
+
+    strcpy(&command[0], "/inet/ssl/handshakes/full 0");
+    BTASSERT(fs_call(&command[0], NULL, NULL, NULL) == 0);
+    strcpy(&command[0], "/inet/ssl/handshakes/resumed 0");
+    BTASSERT(fs_call(&command[0], NULL, NULL, NULL) == 0);
+
+    BTASSERT(ssl_context_init(&context, ssl_protocol_tls_v1_0) == 0);
+
+    /* A full handshake the first time. */
+    BTASSERT(ssl_socket_open(&ssl_socket,
+                             &context,
+                             &socket,
+                             0,
+                             "resume_foo") == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/full",
+                            "0000000000000001\r\n") == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/resumed",
+                            "0000000000000000\r\n") == 0);
+
+    /* The session is resumed when reconnecting to the same
+       server. */
+    BTASSERT(ssl_socket_open(&ssl_socket,
+                             &context,
+                             &socket,
+                             0,
+                             "resume_foo") == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/full",
+                            "0000000000000001\r\n") == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/resumed",
+                            "0000000000000001\r\n") == 0);
+
+    /* A full handshake with another server. */
+    BTASSERT(ssl_socket_open(&ssl_socket,
+                             &context,
+                             &socket,
+                             0,
+                             "resume_bar") == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/full",
+                            "0000000000000002\r\n") == 0);
+
+    /* No session is stored without a hostname. */
+    BTASSERT(ssl_socket_open(&ssl_socket, &context, &socket, 0, NULL) == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/full",
+                            "0000000000000003\r\n") == 0);
+
+    /* The sessions are removed when the context is destroyed. */
+    BTASSERT(ssl_context_destroy(&context) == 0);
+    BTASSERT(ssl_context_init(&context, ssl_protocol_tls_v1_0) == 0);
+    BTASSERT(ssl_socket_open(&ssl_socket,
+                             &context,
+                             &socket,
+                             0,
+                             "resume_foo") == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/full",
+                            "0000000000000004\r\n") == 0);
+    BTASSERT(assert_counter("/inet/ssl/handshakes/resumed",
+                            "0000000000000001\r\n") == 0);
+
+    BTASSERT(ssl_context_destroy(&context) == 0);
+
+    return (0);
+}
+
+static int test_socket_heap(struct harness_t *harness_p)
+{
+    struct ssl_context_t context;
+    struct ssl_socket_t ssl_socket;
+    struct socket_t socket;
+    size_t used_max;
+
+    BTASSERT(ssl_context_init(&context, ssl_protocol_tls_v1_0) == 0);
+
+    /* Both buffers allocated in the handshake stub are counted. */
+    BTASSERT(ssl_socket_open(&ssl_socket, &context, &socket, 0, NULL) == 0);
+    used_max = ssl_socket_get_handshake_heap_used_max(&ssl_socket);
+    BTASSERT(used_max >= 600);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+
+    /* The heap is empty when the next socket is opened. */
+    BTASSERT(ssl_socket_open(&ssl_socket, &context, &socket, 0, NULL) == 0);
+    BTASSERTI(ssl_socket_get_handshake_heap_used_max(&ssl_socket), ==, used_max);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+
+    BTASSERT(ssl_context_destroy(&context) == 0);
+
     return (0);
 }
 
@@ -246,6 +369,8 @@ int main()
         { test_server, "test_server" },
         { test_client_server_context, "test_client_server_context" },
         { test_errors, "test_errors" },
+        { test_session_resumption, "test_session_resumption" },
+        { test_socket_heap, "test_socket_heap" },
         { NULL, NULL }
     };
 
@@ -41,6 +41,23 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/timing.h"
+#include "mbedtls/ssl_cache.h"
+#include "mbedtls/ssl_ticket.h"
+#include "mbedtls/ssl_internal.h"
+
+static mbedtls_ssl_handshake_params handshake;
+static int session_set = 0;
+static void *(*calloc_fn)(size_t, size_t) = NULL;
+static void (*free_fn)(void *) = NULL;
+
+int mbedtls_platform_set_calloc_free(void *(*calloc_func)(size_t, size_t),
+                                     void (*free_func)(void *))
+{
+    calloc_fn = calloc_func;
+    free_fn = free_func;
+
+    return (0);
+}
 
 void mbedtls_ssl_cookie_init(mbedtls_ssl_cookie_ctx *ctx_p)
 {
@@ -49,6 +66,8 @@ void mbedtls_ssl_cookie_init(mbedtls_ssl_cookie_ctx *ctx_p)
 void mbedtls_ssl_init(mbedtls_ssl_context *ssl_p)
 {
     ssl_p->hostname = NULL;
+    ssl_p->state = MBEDTLS_SSL_HELLO_REQUEST;
+    ssl_p->handshake = NULL;
 }
 
 void mbedtls_ssl_config_init(mbedtls_ssl_config *conf_p)
@@ -154,19 +173,142 @@ void mbedtls_ssl_set_bio(mbedtls_ssl_context *ssl_p,
     ssl_p->f_recv = f_recv;
 }
 
-int mbedtls_ssl_handshake(mbedtls_ssl_context *ssl_p)
+int mbedtls_ssl_handshake_step(mbedtls_ssl_context *ssl_p)
 {
     static int counter = 0;
+    void *buf_p;
+    void *buf2_p;
+
+    /* The handshake is performed in two steps, the last one being
+       the wrapup. */
+    if (ssl_p->state == MBEDTLS_SSL_HANDSHAKE_WRAPUP) {
+        ssl_p->state = MBEDTLS_SSL_HANDSHAKE_OVER;
+
+        return (0);
+    }
 
     counter++;
 
     if (counter == 5) {
         return (-1);
     }
-    
+
+    /* Allocate and free a few buffers, as mbedTLS does. */
+    if (calloc_fn != NULL) {
+        buf_p = calloc_fn(4, 100);
+        BTASSERT(buf_p != NULL);
+        BTASSERT(((uint8_t *)buf_p)[399] == 0);
+        buf2_p = calloc_fn(1, 200);
+        BTASSERT(buf2_p != NULL);
+        free_fn(buf_p);
+        free_fn(buf2_p);
+    }
+
+    /* Resume the session if one was set. */
+    handshake.resume = session_set;
+    session_set = 0;
+    ssl_p->handshake = &handshake;
+    ssl_p->state = MBEDTLS_SSL_HANDSHAKE_WRAPUP;
+
+    return (0);
+}
+
+void mbedtls_ssl_session_init(mbedtls_ssl_session *session_p)
+{
+}
+
+void mbedtls_ssl_session_free(mbedtls_ssl_session *session_p)
+{
+}
+
+int mbedtls_ssl_get_session(const mbedtls_ssl_context *ssl_p,
+                            mbedtls_ssl_session *session_p)
+{
     return (0);
 }
 
+int mbedtls_ssl_set_session(mbedtls_ssl_context *ssl_p,
+                            const mbedtls_ssl_session *session_p)
+{
+    session_set = 1;
+
+    return (0);
+}
+
+void mbedtls_ssl_cache_init(mbedtls_ssl_cache_context *cache_p)
+{
+}
+
+void mbedtls_ssl_cache_set_max_entries(mbedtls_ssl_cache_context *cache_p,
+                                       int max)
+{
+}
+
+int mbedtls_ssl_cache_get(void *data_p, mbedtls_ssl_session *session_p)
+{
+    return (1);
+}
+
+int mbedtls_ssl_cache_set(void *data_p, const mbedtls_ssl_session *session_p)
+{
+    return (0);
+}
+
+void mbedtls_ssl_cache_free(mbedtls_ssl_cache_context *cache_p)
+{
+}
+
+void mbedtls_ssl_conf_session_cache(mbedtls_ssl_config *conf_p,
+                                    void *p_cache,
+                                    int (*f_get_cache)(void *,
+                                                       mbedtls_ssl_session *),
+                                    int (*f_set_cache)(void *,
+                                                       const mbedtls_ssl_session *))
+{
+}
+
+void mbedtls_ssl_ticket_init(mbedtls_ssl_ticket_context *ctx_p)
+{
+}
+
+int mbedtls_ssl_ticket_setup(mbedtls_ssl_ticket_context *ctx_p,
+                             int (*f_rng)(void *, unsigned char *, size_t),
+                             void *p_rng,
+                             mbedtls_cipher_type_t cipher,
+                             uint32_t lifetime)
+{
+    return (0);
+}
+
+int mbedtls_ssl_ticket_write(void *p_ticket,
+                             const mbedtls_ssl_session *session_p,
+                             unsigned char *start_p,
+                             const unsigned char *end_p,
+                             size_t *tlen_p,
+                             uint32_t *lifetime_p)
+{
+    return (-1);
+}
+
+int mbedtls_ssl_ticket_parse(void *p_ticket,
+                             mbedtls_ssl_session *session_p,
+                             unsigned char *buf_p,
+                             size_t len)
+{
+    return (-1);
+}
+
+void mbedtls_ssl_ticket_free(mbedtls_ssl_ticket_context *ctx_p)
+{
+}
+
+void mbedtls_ssl_conf_session_tickets_cb(mbedtls_ssl_config *conf_p,
+                                         mbedtls_ssl_ticket_write_t *f_ticket_write,
+                                         mbedtls_ssl_ticket_parse_t *f_ticket_parse,
+                                         void *p_ticket)
+{
+}
+
 void mbedtls_ssl_free(mbedtls_ssl_context *ssl_p)
 {
 }
@@ -40,6 +40,109 @@ extern void socket_stub_close_connection(void);
 static struct tftp_server_t server;
 static THRD_STACK(listener_stack, 2048);
 
+static int create_file(const char *path_p, size_t size)
+{
+    struct fs_file_t file;
+    uint8_t byte;
+    size_t i;
+
+    BTASSERT(fs_open(&file, path_p, FS_WRITE | FS_CREAT | FS_TRUNC) == 0);
+
+    byte = 0;
+
+    for (i = 0; i < size; i++) {
+        BTASSERT(fs_write(&file, &byte, 1) == 1);
+        byte++;
+    }
+
+    BTASSERT(fs_close(&file) == 0);
+
+    return (0);
+}
+
+/**
+ * Read a data packet with given block number and verify its contents.
+ */
+static int read_data(uint16_t block_number,
+                     size_t blksize,
+                     size_t file_size)
+{
+    uint8_t buf[4 + CONFIG_TFTP_SERVER_BLKSIZE_MAX];
+    size_t offset;
+    size_t size;
+    size_t i;
+
+    offset = ((block_number - 1) * blksize);
+    size = MIN(blksize, file_size - offset);
+    socket_stub_output(&buf[0], 4 + size);
+    BTASSERTI(buf[0], ==, 0);
+    BTASSERTI(buf[1], ==, 3);
+    BTASSERTI((buf[2] << 8) | buf[3], ==, block_number);
+
+    for (i = 0; i < size; i++) {
+        BTASSERTI(buf[4 + i], ==, (uint8_t)(offset + i));
+    }
+
+    return (0);
+}
+
+static void input_ack(int socket, uint8_t *buf_p, uint16_t block_number)
+{
+    buf_p[0] = 0;
+    buf_p[1] = 4;
+    buf_p[2] = (block_number >> 8);
+    buf_p[3] = block_number;
+    socket_stub_input(socket, buf_p, 4);
+}
+
+/**
+ * Read given file as a client with given block and window sizes. The
+ * client waits a while before acknowledging each window, to simulate
+ * the round trip time of a network.
+ */
+static int read_file(int socket,
+                     const char *request_p,
+                     size_t request_size,
+                     const char *oack_p,
+                     size_t oack_size,
+                     size_t blksize,
+                     size_t windowsize,
+                     size_t file_size)
+{
+    uint8_t buf[32];
+    uint16_t block_number;
+    uint16_t last_block_number;
+    size_t i;
+
+    socket_stub_input(0, (void *)request_p, request_size);
+
+    /* Acknowledge the negotiated options. */
+    if (oack_p != NULL) {
+        socket_stub_output(&buf[0], oack_size);
+        BTASSERTM(&buf[0], oack_p, oack_size);
+        input_ack(socket, &buf[0], 0);
+    }
+
+    last_block_number = (file_size / blksize + 1);
+    block_number = 0;
+
+    while (block_number < last_block_number) {
+        for (i = 0;
+             (i < windowsize) && (block_number < last_block_number);
+             i++) {
+            block_number++;
+            BTASSERT(read_data(block_number, blksize, file_size) == 0);
+        }
+
+        thrd_sleep_ms(10);
+        input_ack(socket, &buf[0], block_number);
+    }
+
+    thrd_sleep_ms(10);
+
+    return (0);
+}
+
 static int test_start(struct harness_t *harness_p)
 {
     struct inet_addr_t addr;
@@ -372,6 +475,195 @@ static int test_bad_request(struct harness_t *harness_p)
     return (0);
 }
 
+static int test_read_options(struct harness_t *harness_p)
+{
+    static const char request[] =
+        "\x00""\x01""win.txt""\x00""octet""\x00"
+        "BLKSIZE""\x00""512""\x00"
+        "windowsize""\x00""4""\x00"
+        "foo""\x00""bar""\x00"
+        "blksize""\x00""bad""\x00";
+    static const char oack[] =
+        "\x00""\x06""blksize""\x00""512""\x00"
+        "windowsize""\x00""4""\x00";
+    uint8_t buf[32];
+    uint16_t block_number;
+
+    BTASSERT(create_file("win.txt", 4000) == 0);
+
+    /* Input read request packet with options. Unknown options and
+       bad values are ignored. */
+    socket_stub_input(0, (void *)&request[0], sizeof(request) - 1);
+
+    /* Wait for the option acknowledgement packet and acknowledge
+       it. */
+    socket_stub_output(&buf[0], sizeof(oack) - 1);
+    BTASSERTM(&buf[0], &oack[0], sizeof(oack) - 1);
+    input_ack(6, &buf[0], 0);
+
+    /* The first window. */
+    for (block_number = 1; block_number <= 4; block_number++) {
+        BTASSERT(read_data(block_number, 512, 4000) == 0);
+    }
+
+    /* Block 3 was lost. Blocks 3 and 4 are transmitted again,
+       followed by two new blocks. */
+    input_ack(6, &buf[0], 2);
+
+    for (block_number = 3; block_number <= 6; block_number++) {
+        BTASSERT(read_data(block_number, 512, 4000) == 0);
+    }
+
+    /* The last window has two blocks. */
+    input_ack(6, &buf[0], 6);
+    BTASSERT(read_data(7, 512, 4000) == 0);
+    BTASSERT(read_data(8, 512, 4000) == 0);
+
+    /* Input last acknowlegement packet. */
+    input_ack(6, &buf[0], 8);
+
+    thrd_sleep_ms(10);
+
+    return (0);
+}
+
+static int test_write_options(struct harness_t *harness_p)
+{
+    static const char request[] =
+        "\x00""\x02""wopt.txt""\x00""octet""\x00"
+        "windowsize""\x00""2""\x00"
+        "blksize""\x00""100""\x00";
+    static const char oack[] =
+        "\x00""\x06""blksize""\x00""100""\x00"
+        "windowsize""\x00""2""\x00";
+    static uint8_t blocks[4][104];
+    struct fs_file_t file;
+    uint8_t buf[32];
+    uint8_t byte;
+    int i;
+    int j;
+
+    byte = 0;
+
+    for (i = 0; i < 4; i++) {
+        blocks[i][0] = 0;
+        blocks[i][1] = 3;
+        blocks[i][2] = 0;
+        blocks[i][3] = (i + 1);
+
+        for (j = 0; j < 100; j++) {
+            blocks[i][4 + j] = byte;
+            byte++;
+        }
+    }
+
+    /* Input write request packet with options. */
+    socket_stub_input(0, (void *)&request[0], sizeof(request) - 1);
+
+    /* Options are acknowledged instead of block zero. */
+    socket_stub_output(&buf[0], sizeof(oack) - 1);
+    BTASSERTM(&buf[0], &oack[0], sizeof(oack) - 1);
+
+    /* The first window is acknowledged once. */
+    socket_stub_input(7, &blocks[0][0], 104);
+    socket_stub_input(7, &blocks[1][0], 104);
+
+    socket_stub_output(&buf[0], 4);
+    BTASSERTM(&buf[0], "\x00""\x04""\x00""\x02", 4);
+
+    /* Block 3 was lost. The last received block is acknowledged
+       once. */
+    socket_stub_input(7, &blocks[3][0], 54);
+
+    socket_stub_output(&buf[0], 4);
+    BTASSERTM(&buf[0], "\x00""\x04""\x00""\x02", 4);
+
+    socket_stub_input(7, &blocks[3][0], 54);
+
+    /* The last block is not full. */
+    socket_stub_input(7, &blocks[2][0], 104);
+    socket_stub_input(7, &blocks[3][0], 54);
+
+    socket_stub_output(&buf[0], 4);
+    BTASSERTM(&buf[0], "\x00""\x04""\x00""\x04", 4);
+
+    thrd_sleep_ms(10);
+
+    /* Verify the contents of the file created by the TFTP server. */
+    BTASSERT(fs_open(&file, "wopt.txt", FS_READ) == 0);
+
+    byte = 0;
+
+    for (i = 0; i < 350; i++) {
+        BTASSERT(fs_read(&file, &buf[0], 1) == 1);
+        BTASSERTI(buf[0], ==, byte);
+        byte++;
+    }
+
+    BTASSERT(fs_read(&file, &buf[0], 1) == 0);
+    BTASSERT(fs_close(&file) == 0);
+
+    return (0);
+}
+
+static int test_benchmark(struct harness_t *harness_p)
+{
+    static const char request[] =
+        "\x00""\x01""bench.txt""\x00""octet""\x00";
+    static const char request_options[] =
+        "\x00""\x01""bench.txt""\x00""octet""\x00"
+        "blksize""\x00""1428""\x00"
+        "windowsize""\x00""8""\x00";
+    static const char oack[] =
+        "\x00""\x06""blksize""\x00""1428""\x00"
+        "windowsize""\x00""8""\x00";
+    struct time_t start;
+    struct time_t stop;
+    struct time_t lock_step;
+    struct time_t windowed;
+
+    BTASSERT(create_file("bench.txt", 32768) == 0);
+
+    /* Default block size, one block per acknowledgement. */
+    time_get(&start);
+    BTASSERT(read_file(8,
+                       &request[0],
+                       sizeof(request) - 1,
+                       NULL,
+                       0,
+                       512,
+                       1,
+                       32768) == 0);
+    time_get(&stop);
+    time_subtract(&lock_step, &stop, &start);
+
+    /* Negotiated block and window sizes. */
+    time_get(&start);
+    BTASSERT(read_file(9,
+                       &request_options[0],
+                       sizeof(request_options) - 1,
+                       &oack[0],
+                       sizeof(oack) - 1,
+                       1428,
+                       8,
+                       32768) == 0);
+    time_get(&stop);
+    time_subtract(&windowed, &stop, &start);
+
+    std_printf(OSTR("Transfer rate with a 10 ms round trip time: %lu "
+                    "bytes/s in lock-step mode, and %lu bytes/s with "
+                    "block size 1428 and window size 8.\r\n"),
+               32768000ul / (lock_step.seconds * 1000ul
+                             + lock_step.nanoseconds / 1000000ul),
+               32768000ul / (windowed.seconds * 1000ul
+                             + windowed.nanoseconds / 1000000ul));
+
+    BTASSERT(time_compare(&windowed, &lock_step)
+             == time_compare_less_than_t);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_t harness;
@@ -382,6 +674,9 @@ int main()
         { test_read_timeout, "test_read_timeout" },
         { test_write_timeout, "test_write_timeout" },
         { test_bad_request, "test_bad_request" },
+        { test_read_options, "test_read_options" },
+        { test_write_options, "test_write_options" },
+        { test_benchmark, "test_benchmark" },
         { NULL, NULL }
     };
 
@@ -37,7 +37,7 @@ static char qoutputbuf[256];
 static struct event_t accept_events;
 static struct event_t closed_events;
 
-static struct socket_t *sockets[8];
+static struct socket_t *sockets[16];
 static int number_of_sockets = 0;
 
 static ssize_t read(void *self_p,
@@ -49,9 +49,12 @@ static ssize_t read(void *self_p,
 
     queue_read(&qinput, &ref_buf_p, sizeof(ref_buf_p));
     queue_read(&qinput, &ref_size, sizeof(ref_size));
+
+    /* Datagrams are truncated. */
+    size = MIN(size, ref_size);
     memcpy(buf_p, ref_buf_p, size);
 
-    return (ref_size);
+    return (size);
 }
 
 static ssize_t write(void *self_p,
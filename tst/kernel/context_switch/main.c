@@ -0,0 +1,168 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#if CONFIG_LINUX_THRD_COROUTINES == 1
+#    define NUMBER_OF_ROUNDS                          1000000
+#else
+#    define NUMBER_OF_ROUNDS                            50000
+#endif
+
+static THRD_STACK(pong_stack, 1024);
+static THRD_STACK(stack_stack, 1024);
+static struct thrd_t *main_thrd_p;
+static struct thrd_t *pong_thrd_p;
+static const void *stack_bottom_p;
+
+static void *pong_main(void *arg_p)
+{
+    thrd_set_name("pong");
+
+    while (1) {
+        thrd_suspend(NULL);
+        thrd_resume(main_thrd_p, 0);
+    }
+
+    return (NULL);
+}
+
+static void *stack_main(void *arg_p)
+{
+    char buf[256];
+
+    thrd_set_name("stack");
+
+    memset(&buf[0], 0, sizeof(buf));
+    stack_bottom_p = thrd_get_bottom_of_stack(thrd_self());
+    thrd_suspend(NULL);
+
+    return (NULL);
+}
+
+static int test_ping_pong(struct harness_t *harness_p)
+{
+    int round;
+    struct time_t start;
+    struct time_t stop;
+    struct time_t diff;
+    long elapsed_us;
+
+    main_thrd_p = thrd_self();
+    pong_thrd_p = thrd_spawn(pong_main,
+                             NULL,
+                             0,
+                             pong_stack,
+                             sizeof(pong_stack));
+    BTASSERT(pong_thrd_p != NULL);
+
+    /* Let the pong thread start and suspend. */
+    thrd_sleep_ms(20);
+
+    time_get(&start);
+
+    /* Two context switches per round. */
+    for (round = 0; round < NUMBER_OF_ROUNDS; round++) {
+        thrd_resume(pong_thrd_p, 0);
+        thrd_suspend(NULL);
+    }
+
+    time_get(&stop);
+    time_subtract(&diff, &stop, &start);
+    elapsed_us = (diff.seconds * 1000000L + diff.nanoseconds / 1000L);
+
+    std_printf(FSTR("port: %s, %d rounds\r\n"
+                    "elapsed time: %ld us\r\n"
+                    "context switch: %ld ns\r\n"
+                    "context switches per second: %ld\r\n"),
+               (CONFIG_LINUX_THRD_COROUTINES == 1
+                ? "coroutines"
+                : "host threads"),
+               NUMBER_OF_ROUNDS,
+               elapsed_us,
+               (long)((1000LL * elapsed_us) / (2 * NUMBER_OF_ROUNDS)),
+               (long)((2000000LL * NUMBER_OF_ROUNDS) / (elapsed_us + 1)));
+
+    return (0);
+}
+
+static int test_stack(struct harness_t *harness_p)
+{
+    struct thrd_t *thrd_p;
+    const char *top_p;
+
+    thrd_p = thrd_spawn(stack_main,
+                        NULL,
+                        -1,
+                        stack_stack,
+                        sizeof(stack_stack));
+    BTASSERT(thrd_p != NULL);
+    thrd_sleep_ms(20);
+
+    /* The stack grows downwards from the top of the stack buffer. */
+    BTASSERT(stack_bottom_p > (const void *)&thrd_p[1]);
+
+#if CONFIG_LINUX_THRD_COROUTINES == 1
+    top_p = thrd_get_top_of_stack(thrd_p);
+    BTASSERT(top_p == &stack_stack[sizeof(stack_stack)]);
+    BTASSERT(stack_bottom_p < (const void *)(top_p - sizeof(char[256])));
+
+    /* The bottom of a suspended thread is its saved stack pointer. */
+#    if defined(__x86_64__)
+    BTASSERT(thrd_get_bottom_of_stack(thrd_p) != NULL);
+    BTASSERT(thrd_get_bottom_of_stack(thrd_p) > (const void *)&thrd_p[1]);
+    BTASSERT(thrd_get_bottom_of_stack(thrd_p) < (const void *)top_p);
+#    endif
+#else
+    (void)top_p;
+#endif
+
+    BTASSERT(thrd_resume(thrd_p, 0) == 0);
+    BTASSERT(thrd_join(thrd_p) == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_ping_pong, "test_ping_pong" },
+        { test_stack, "test_stack" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
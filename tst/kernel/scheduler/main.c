@@ -0,0 +1,230 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#define NUMBER_OF_ORDER_THREADS                             6
+#define NUMBER_OF_WORKERS                                  32
+#define NUMBER_OF_ROUNDS                                 2000
+
+struct order_thread_t {
+    int id;
+    int prio;
+    struct thrd_t *thrd_p;
+    THRD_STACK(stack, 1024);
+};
+
+struct worker_t {
+    struct thrd_t *thrd_p;
+    THRD_STACK(stack, 1024);
+};
+
+static struct order_thread_t order_threads[NUMBER_OF_ORDER_THREADS];
+static int order[NUMBER_OF_ORDER_THREADS];
+static int order_length;
+
+static struct worker_t workers[NUMBER_OF_WORKERS];
+static THRD_STACK(tail_stack, 1024);
+static struct thrd_t *main_thrd_p;
+
+static void *order_thread_main(void *arg_p)
+{
+    struct order_thread_t *self_p;
+
+    self_p = arg_p;
+
+    while (1) {
+        order[order_length++] = self_p->id;
+        thrd_suspend(NULL);
+    }
+
+    return (NULL);
+}
+
+static void *worker_main(void *arg_p)
+{
+    while (1) {
+        thrd_suspend(NULL);
+    }
+
+    return (NULL);
+}
+
+/**
+ * The lowest priority thread in the benchmark. It runs after all
+ * workers and resumes the main thread.
+ */
+static void *tail_main(void *arg_p)
+{
+    while (1) {
+        thrd_suspend(NULL);
+        thrd_resume(main_thrd_p, 0);
+    }
+
+    return (NULL);
+}
+
+static int test_ready_order(struct harness_t *harness_p)
+{
+    int i;
+    static const int prios[NUMBER_OF_ORDER_THREADS] = {
+        5, 3, 5, 1, 3, -128
+    };
+    static const int expected_spawn_order[NUMBER_OF_ORDER_THREADS] = {
+        5, 3, 1, 4, 0, 2
+    };
+    static const int resume_order[NUMBER_OF_ORDER_THREADS] = {
+        2, 4, 0, 1, 3, 5
+    };
+    static const int expected_resume_order[NUMBER_OF_ORDER_THREADS] = {
+        5, 3, 4, 1, 2, 0
+    };
+
+    /* Highest priority first, and first in first out among threads
+       with the same priority. The main thread has priority zero. */
+    order_length = 0;
+
+    for (i = 0; i < NUMBER_OF_ORDER_THREADS; i++) {
+        order_threads[i].id = i;
+        order_threads[i].prio = prios[i];
+        order_threads[i].thrd_p = thrd_spawn(order_thread_main,
+                                             &order_threads[i],
+                                             prios[i],
+                                             order_threads[i].stack,
+                                             sizeof(order_threads[i].stack));
+        BTASSERT(order_threads[i].thrd_p != NULL);
+    }
+
+    /* Only the priority -128 thread preempts the main thread. */
+    thrd_yield();
+    BTASSERTI(order_length, ==, 1);
+
+    thrd_sleep_ms(20);
+    BTASSERTI(order_length, ==, NUMBER_OF_ORDER_THREADS);
+    BTASSERTM(&order[0],
+              &expected_spawn_order[0],
+              sizeof(order));
+
+    /* Resume all threads at once and let them run. */
+    order_length = 0;
+
+    sys_lock();
+
+    for (i = 0; i < NUMBER_OF_ORDER_THREADS; i++) {
+        thrd_resume_isr(order_threads[resume_order[i]].thrd_p, 0);
+    }
+
+    sys_unlock();
+
+    thrd_sleep_ms(20);
+    BTASSERTI(order_length, ==, NUMBER_OF_ORDER_THREADS);
+    BTASSERTM(&order[0],
+              &expected_resume_order[0],
+              sizeof(order));
+
+    return (0);
+}
+
+static int test_resume_latency(struct harness_t *harness_p)
+{
+    int i;
+    int round;
+    struct thrd_t *tail_p;
+    struct time_t start;
+    struct time_t stop;
+    struct time_t diff;
+    long elapsed_us;
+
+    main_thrd_p = thrd_self();
+
+    /* Workers with mixed priorities, all lower than the main thread
+       and higher than the tail thread. */
+    for (i = 0; i < NUMBER_OF_WORKERS; i++) {
+        workers[i].thrd_p = thrd_spawn(worker_main,
+                                       NULL,
+                                       1 + (7 * i) % 64,
+                                       workers[i].stack,
+                                       sizeof(workers[i].stack));
+        BTASSERT(workers[i].thrd_p != NULL);
+    }
+
+    tail_p = thrd_spawn(tail_main, NULL, 120, tail_stack, sizeof(tail_stack));
+    BTASSERT(tail_p != NULL);
+
+    /* Let all threads start and suspend. */
+    thrd_sleep_ms(50);
+
+    time_get(&start);
+
+    for (round = 0; round < NUMBER_OF_ROUNDS; round++) {
+        sys_lock();
+
+        for (i = 0; i < NUMBER_OF_WORKERS; i++) {
+            thrd_resume_isr(workers[i].thrd_p, 0);
+        }
+
+        thrd_resume_isr(tail_p, 0);
+        thrd_suspend_isr(NULL);
+        sys_unlock();
+    }
+
+    time_get(&stop);
+    time_subtract(&diff, &stop, &start);
+    elapsed_us = (diff.seconds * 1000000L + diff.nanoseconds / 1000L);
+
+    std_printf(FSTR("ready queue: %s, %d threads, %d rounds\r\n"
+                    "elapsed time: %ld us\r\n"
+                    "resume-to-run latency: %ld ns\r\n"),
+               (CONFIG_THRD_READY_BITMAP == 1 ? "bitmap" : "sorted list"),
+               NUMBER_OF_WORKERS + 1,
+               NUMBER_OF_ROUNDS,
+               elapsed_us,
+               (long)((1000LL * elapsed_us)
+                      / (NUMBER_OF_ROUNDS * (NUMBER_OF_WORKERS + 1))));
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_ready_order, "test_ready_order" },
+        { test_resume_latency, "test_resume_latency" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
@@ -0,0 +1,193 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2017, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+#include <sys/resource.h>
+#include <limits.h>
+
+#define ATTEMPTS_MAX                                        5
+
+static struct event_t event;
+
+static void callback(void *arg_p)
+{
+    uint32_t mask;
+
+    mask = 0x1;
+    event_write_isr(&event, &mask, sizeof(mask));
+}
+
+static long elapsed_us(struct time_t *start_p)
+{
+    struct time_t stop;
+    struct time_t elapsed;
+
+    sys_uptime(&stop);
+    time_subtract(&elapsed, &stop, start_p);
+
+    return (1000000L * elapsed.seconds + elapsed.nanoseconds / 1000);
+}
+
+static long cpu_time_us(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return (1000000L * (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+            + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+static int test_sleep_us(struct harness_t *harness_p)
+{
+    int i;
+    int attempt;
+    long elapsed;
+    long shortest;
+    struct time_t start;
+    static const long sleeps[] = { 100, 500, 2000 };
+
+    for (i = 0; i < membersof(sleeps); i++) {
+        /* The host may not run the process for a few milliseconds at
+           any time, so check the shortest of a few sleeps. */
+        shortest = LONG_MAX;
+
+        for (attempt = 0; attempt < ATTEMPTS_MAX; attempt++) {
+            sys_uptime(&start);
+            thrd_sleep_us(sleeps[i]);
+            elapsed = elapsed_us(&start);
+            BTASSERTI(elapsed, >=, sleeps[i]);
+
+            if (elapsed < shortest) {
+                shortest = elapsed;
+            }
+        }
+
+        std_printf(OSTR("Slept %ld us for %ld us.\r\n"), shortest, sleeps[i]);
+
+        BTASSERTI(shortest, <, sleeps[i] + 5000);
+    }
+
+    return (0);
+}
+
+static int test_timer(struct harness_t *harness_p)
+{
+    uint32_t mask;
+    int attempt;
+    long elapsed;
+    long shortest;
+    struct timer_t timer;
+    struct time_t start;
+    struct time_t timeout = {
+        .seconds = 0,
+        .nanoseconds = 300000
+    };
+
+    event_init(&event);
+    BTASSERT(timer_init(&timer, &timeout, callback, NULL, 0) == 0);
+    shortest = LONG_MAX;
+
+    for (attempt = 0; attempt < ATTEMPTS_MAX; attempt++) {
+        sys_uptime(&start);
+        BTASSERT(timer_start(&timer) == 0);
+
+        mask = 0x1;
+        BTASSERT(event_read(&event, &mask, sizeof(mask)) == sizeof(mask));
+        elapsed = elapsed_us(&start);
+        BTASSERTI(elapsed, >=, 300);
+
+        if (elapsed < shortest) {
+            shortest = elapsed;
+        }
+    }
+
+    std_printf(OSTR("Timer expired after %ld us.\r\n"), shortest);
+
+    BTASSERTI(shortest, <, 5000);
+
+    return (0);
+}
+
+static int test_uptime(struct harness_t *harness_p)
+{
+    int i;
+    struct time_t prev;
+    struct time_t now;
+    struct time_t elapsed;
+
+    /* Uptime is continuous even if ticks are not processed. */
+    sys_uptime(&prev);
+
+    for (i = 0; i < 1000; i++) {
+        time_busy_wait_us(10);
+        sys_uptime(&now);
+        time_subtract(&elapsed, &now, &prev);
+        BTASSERT(elapsed.seconds >= 0);
+        BTASSERT(elapsed.nanoseconds >= 0);
+        prev = now;
+    }
+
+    return (0);
+}
+
+static int test_idle(struct harness_t *harness_p)
+{
+    long cpu_time;
+
+    cpu_time = cpu_time_us();
+    thrd_sleep_ms(500);
+    cpu_time = (cpu_time_us() - cpu_time);
+
+    std_printf(OSTR("CPU time %ld us during 500 ms of idle.\r\n"), cpu_time);
+
+    BTASSERTI(cpu_time, <, 25000);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_t harness;
+    struct harness_testcase_t harness_testcases[] = {
+        { test_sleep_us, "test_sleep_us" },
+        { test_timer, "test_timer" },
+        { test_uptime, "test_uptime" },
+        { test_idle, "test_idle" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_init(&harness);
+    harness_run(&harness, harness_testcases);
+
+    return (0);
+}
@@ -207,6 +207,73 @@ int test_multiple_timers(struct harness_t *harness_p)
     return (0);
 }
 
+static int expired_count;
+static int expired[64];
+
+static void many_timers_callback(void *arg_p)
+{
+    uint32_t mask;
+
+    expired[expired_count] = (long)arg_p;
+    expired_count++;
+
+    if (expired_count == membersof(expired)) {
+        mask = 0x1;
+        event_write_isr(&event, &mask, sizeof(mask));
+    }
+}
+
+int test_many_timers(struct harness_t *harness_p)
+{
+    int i;
+    uint32_t mask;
+    struct timer_t timers[128];
+    struct time_t timeout;
+
+    event_init(&event);
+    expired_count = 0;
+
+    /* Timeouts from 10 to 1280 ms, started in non-sorted order. */
+    for (i = 0; i < membersof(timers); i++) {
+        timeout.seconds = 0;
+        timeout.nanoseconds = (10000000L * (1 + (i * 37) % 128));
+        BTASSERT(timer_init(&timers[i],
+                            &timeout,
+                            many_timers_callback,
+                            (void *)(long)i,
+                            0) == 0);
+        BTASSERT(timer_start(&timers[i]) == 0);
+    }
+
+    /* Stop every other timer. */
+    for (i = 1; i < membersof(timers); i += 2) {
+        BTASSERT(timer_stop(&timers[i]) == 1);
+    }
+
+    mask = 0x1;
+    event_read(&event, &mask, sizeof(mask));
+
+    BTASSERTI(expired_count, ==, membersof(expired));
+
+    /* Only started timers expired, sorted by timeout. */
+    for (i = 0; i < membersof(expired); i++) {
+        BTASSERTI(expired[i] % 2, ==, 0);
+
+        if (i > 0) {
+            BTASSERTI(timers[expired[i - 1]].timeout,
+                      <=,
+                      timers[expired[i]].timeout);
+        }
+    }
+
+    /* All timers are stopped. */
+    for (i = 0; i < membersof(timers); i++) {
+        BTASSERT(timer_stop(&timers[i]) == 0);
+    }
+
+    return (0);
+}
+
 int main()
 {
     struct harness_t harness;
@@ -215,6 +282,7 @@ int main()
         { test_periodic, "test_periodic" },
 #if !defined(BOARD_ARDUINO_NANO) && !defined(BOARD_ARDUINO_UNO) && !defined(BOARD_ARDUINO_PRO_MICRO)
         { test_multiple_timers, "test_multiple_timers" },
+        { test_many_timers, "test_many_timers" },
 #endif
         { NULL, NULL }
     };